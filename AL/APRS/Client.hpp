@@ -134,10 +134,11 @@ namespace AL::APRS
 		// @throw AL::Exception
 		virtual Void SetBlocking(Bool set) = 0;
 
+		// value is valid until the next call to Read
 		// @throw AL::Exception
 		// @return 0 on connection closed
 		// @return -1 if would block
-		virtual int Read(String& value) = 0;
+		virtual int Read(StringView& value) = 0;
 
 		// @throw AL::Exception
 		// @return AL::False on connection closed
@@ -151,8 +152,18 @@ namespace AL::APRS
 		{
 			static constexpr String::Char EOL[] = { '\r', '\n' };
 
+			// APRS-IS lines are limited to 512 bytes, a full feed delivers many per receive
+			static constexpr size_t READ_BUFFER_SIZE = 0x4000;
+
 			Network::TcpSocket socket;
 
+			// [readBufferStart, readBufferEnd) has been received but not yet returned by Read
+			// - readBufferScan is where the search for the next EOL resumes
+			String::Char       readBuffer[READ_BUFFER_SIZE];
+			size_t             readBufferStart = 0;
+			size_t             readBufferScan  = 0;
+			size_t             readBufferEnd   = 0;
+
 		public:
 			Connection_APRS_IS()
 				: socket(
@@ -226,6 +237,10 @@ namespace AL::APRS
 					socket
 				);
 
+				readBufferStart = 0;
+				readBufferScan  = 0;
+				readBufferEnd   = 0;
+
 				return True;
 			}
 
@@ -244,80 +259,75 @@ namespace AL::APRS
 				socket.SetBlocking(set);
 			}
 
+			// Lines are returned without EOL as views into the receive buffer
+			// - Partial lines remain buffered until the rest has been received
 			// @throw AL::Exception
 			// @return 0 on connection closed
 			// @return -1 if would block
-			virtual int Read(String& value) override
+			virtual int Read(StringView& value) override
 			{
 				AL_ASSERT(
 					IsConnected(),
 					"Connection_APRS_IS not connected"
 				);
 
-				String::Char buffer[2];
-				size_t       numberOfBytesReceived;
-				auto         buffer_Update = [&buffer]()
+				while (!ReadLine(value))
 				{
-					if ((buffer[0] == EOL[0]) && (buffer[1] == EOL[1]))
+					if (readBufferStart == readBufferEnd)
 					{
-
-						return False;
+						readBufferStart = 0;
+						readBufferScan  = 0;
+						readBufferEnd   = 0;
 					}
-
-					buffer[0] = buffer[1];
-
-					return True;
-				};
-
-				try
-				{
-					if (!Network::SocketExtensions::TryReceiveAll(socket, &buffer[1], 1, numberOfBytesReceived))
+					else if (readBufferEnd == READ_BUFFER_SIZE)
 					{
-						Disconnect();
+						if (readBufferStart == 0)
+						{
 
-						return 0;
-					}
+							throw Exception(
+								"Error reading Network::TcpSocket: Line exceeds read buffer"
+							);
+						}
 
-					if (numberOfBytesReceived == 0)
-					{
+						// moves the partial line to the front of the buffer
+						memmove(
+							&readBuffer[0],
+							&readBuffer[readBufferStart],
+							readBufferEnd - readBufferStart
+						);
 
-						return -1;
+						readBufferScan  -= readBufferStart;
+						readBufferEnd   -= readBufferStart;
+						readBufferStart  = 0;
 					}
 
-					value.Clear();
-
-					value.Append(
-						buffer[1]
-					);
-
-					buffer_Update();
+					size_t numberOfBytesReceived;
 
-					do
+					try
 					{
-						if (!Network::SocketExtensions::ReceiveAll(socket, &buffer[1], 1, numberOfBytesReceived))
+						if (!socket.Receive(&readBuffer[readBufferEnd], READ_BUFFER_SIZE - readBufferEnd, numberOfBytesReceived))
 						{
 							Disconnect();
 
 							return 0;
 						}
+					}
+					catch (Exception& exception)
+					{
 
-						value.Append(
-							buffer[1]
+						throw Exception(
+							Move(exception),
+							"Error reading Network::TcpSocket"
 						);
-					} while (buffer_Update());
+					}
 
-					value.Erase(
-						value.GetLength() - 2,
-						2
-					);
-				}
-				catch (Exception& exception)
-				{
+					if (numberOfBytesReceived == 0)
+					{
 
-					throw Exception(
-						Move(exception),
-						"Error reading Network::TcpSocket"
-					);
+						return -1;
+					}
+
+					readBufferEnd += numberOfBytesReceived;
 				}
 
 				return 1;
@@ -354,6 +364,42 @@ namespace AL::APRS
 
 				return True;
 			}
+
+		private:
+			Bool ReadLine(StringView& value)
+			{
+				while (readBufferScan < readBufferEnd)
+				{
+					auto lpEOL = static_cast<const String::Char*>(
+						::std::memchr(&readBuffer[readBufferScan], EOL[1], readBufferEnd - readBufferScan)
+					);
+
+					if (lpEOL == nullptr)
+					{
+						readBufferScan = readBufferEnd;
+
+						break;
+					}
+
+					auto eolEnd    = static_cast<size_t>(lpEOL - &readBuffer[0]) + 1;
+					readBufferScan = eolEnd;
+
+					// a lone LF is part of the line
+					if (((eolEnd - readBufferStart) >= 2) && (readBuffer[eolEnd - 2] == EOL[0]))
+					{
+						value = StringView(
+							&readBuffer[readBufferStart],
+							eolEnd - readBufferStart - 2
+						);
+
+						readBufferStart = eolEnd;
+
+						return True;
+					}
+				}
+
+				return False;
+			}
 		};
 
 		class Connection_KISS
@@ -1079,6 +1125,9 @@ namespace AL::APRS
 
 			IKISSConnection* lpConnection = nullptr;
 
+			// last frame returned by Read
+			String           line;
+
 		public:
 			Connection_KISS()
 			{
@@ -1203,29 +1252,31 @@ namespace AL::APRS
 			// @throw AL::Exception
 			// @return 0 on connection closed
 			// @return -1 if would block
-			virtual int Read(String& value) override
+			virtual int Read(StringView& value) override
 			{
 				AL_ASSERT(
 					IsConnected(),
 					"Connection_KISS not connected"
 				);
 
-				String source, tocall, path;
+				String source, tocall, path, content;
 
-				switch (ReadFrame(source, tocall, path, value))
+				switch (ReadFrame(source, tocall, path, content))
 				{
 					case 0:  return 0;
 					case -1: return -1;
 				}
 
-				value = String::Format(
+				line = String::Format(
 					"%s>%s,%s:%s",
 					source.GetCString(),
 					tocall.GetCString(),
 					path.GetCString(),
-					value.GetCString()
+					content.GetCString()
 				);
 
+				value = line;
+
 				return 1;
 			}
 
@@ -2028,7 +2079,7 @@ namespace AL::APRS
 		// @return AL::False on connection closed
 		Bool Update(TimeSpan delta)
 		{
-			String line;
+			StringView line;
 
 			switch (Connection_Read(line))
 			{
@@ -2040,7 +2091,7 @@ namespace AL::APRS
 			{
 				Regex::MatchCollection matches;
 
-				if (Regex::Match(matches, "^# logresp ([^ ]+) ([^ ,]+)", line))
+				if (Regex::Match(matches, "^# logresp ([^ ]+) ([^ ,]+)", line.ToString()))
 				{
 					if (!matches[2].Compare("verified", True))
 					{
@@ -2065,7 +2116,7 @@ namespace AL::APRS
 				catch (const Exception&)
 				{
 					OnReceiveInvalidData.Execute(
-						line
+						line.ToString()
 					);
 
 					return True;
@@ -2629,9 +2680,10 @@ namespace AL::APRS
 				return 0;
 			}
 
-			int result;
+			int        result;
+			StringView response;
 
-			while ((result = Connection_Read(line)) != 0)
+			while ((result = Connection_Read(response)) != 0)
 			{
 				if (result == -1)
 				{
@@ -2641,7 +2693,7 @@ namespace AL::APRS
 
 				Regex::MatchCollection matches;
 
-				if (Regex::Match(matches, "^# logresp ([^ ]+) (.+)$", line))
+				if (Regex::Match(matches, "^# logresp ([^ ]+) (.+)$", response.ToString()))
 				{
 					if (matches[2].StartsWith("verified", True))
 					{
@@ -2675,7 +2727,7 @@ namespace AL::APRS
 		// @throw AL::Exception
 		// @return 0 on connection closed
 		// @return -1 if would block
-		int Connection_Read(String& value)
+		int Connection_Read(StringView& value)
 		{
 			switch (lpConnection->Read(value))
 			{
@@ -2687,10 +2739,11 @@ namespace AL::APRS
 					return -1;
 			}
 
-			if (IsAuthenticated())
+			// only copied when someone is listening
+			if (IsAuthenticated() && (OnReceive.GetHandlerCount() != 0))
 			{
 				OnReceive.Execute(
-					value
+					value.ToString()
 				);
 			}
 
@@ -0,0 +1,182 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include <new>     // placement new
+#include <cstddef> // std::max_align_t
+
+namespace AL::Collections
+{
+	// Bump allocator that releases everything at once
+	// - Destructors of values created in the arena are never called
+	class Arena
+	{
+		static constexpr size_t BLOCK_SIZE         = 0x1000;
+		static constexpr size_t BLOCK_SIZE_MAXIMUM = 0x100000;
+
+		static constexpr size_t ALIGNMENT          = alignof(::std::max_align_t);
+
+		struct Block
+		{
+			Block* lpPrevious;
+			size_t Size;
+		};
+
+		static constexpr size_t BLOCK_HEADER_SIZE  = (sizeof(Block) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+
+		Block* lpBlock   = nullptr;
+		uint8* lpNext    = nullptr;
+		uint8* lpEnd     = nullptr;
+		size_t blockSize = BLOCK_SIZE;
+		size_t size      = 0;
+
+	public:
+		Arena()
+		{
+		}
+
+		Arena(Arena&& arena)
+			: lpBlock(
+				arena.lpBlock
+			),
+			lpNext(
+				arena.lpNext
+			),
+			lpEnd(
+				arena.lpEnd
+			),
+			blockSize(
+				arena.blockSize
+			),
+			size(
+				arena.size
+			)
+		{
+			arena.lpBlock   = nullptr;
+			arena.lpNext    = nullptr;
+			arena.lpEnd     = nullptr;
+			arena.blockSize = BLOCK_SIZE;
+			arena.size      = 0;
+		}
+
+		Arena(const Arena&) = delete;
+
+		virtual ~Arena()
+		{
+			Clear();
+		}
+
+		// Bytes reserved from the heap
+		size_t GetSize() const
+		{
+			return size;
+		}
+
+		Void* Allocate(size_t size, size_t alignment = ALIGNMENT)
+		{
+			auto lpValue = reinterpret_cast<uint8*>(
+				(reinterpret_cast<size_t>(lpNext) + (alignment - 1)) & ~(alignment - 1)
+			);
+
+			// aligning may move lpValue past lpEnd
+			if ((lpBlock == nullptr) || (lpValue > lpEnd) || (size > static_cast<size_t>(lpEnd - lpValue)))
+			{
+				AllocateBlock(
+					size + alignment
+				);
+
+				lpValue = reinterpret_cast<uint8*>(
+					(reinterpret_cast<size_t>(lpNext) + (alignment - 1)) & ~(alignment - 1)
+				);
+			}
+
+			lpNext = lpValue + size;
+
+			return lpValue;
+		}
+
+		template<typename T, typename ... TArgs>
+		T* Create(TArgs&& ... args)
+		{
+			return new (Allocate(sizeof(T), alignof(T))) T(
+				Forward<TArgs>(args) ...
+			);
+		}
+
+		// Releases every block
+		Void Clear()
+		{
+			while (lpBlock != nullptr)
+			{
+				auto lpPrevious = lpBlock->lpPrevious;
+
+				::operator delete(
+					lpBlock
+				);
+
+				lpBlock = lpPrevious;
+			}
+
+			lpNext    = nullptr;
+			lpEnd     = nullptr;
+			blockSize = BLOCK_SIZE;
+			size      = 0;
+		}
+
+		Arena& operator = (Arena&& arena)
+		{
+			if (this != &arena)
+			{
+				Clear();
+
+				lpBlock         = arena.lpBlock;
+				arena.lpBlock   = nullptr;
+
+				lpNext          = arena.lpNext;
+				arena.lpNext    = nullptr;
+
+				lpEnd           = arena.lpEnd;
+				arena.lpEnd     = nullptr;
+
+				blockSize       = arena.blockSize;
+				arena.blockSize = BLOCK_SIZE;
+
+				size            = arena.size;
+				arena.size      = 0;
+			}
+
+			return *this;
+		}
+
+		Arena& operator = (const Arena&) = delete;
+
+	private:
+		// Blocks double in size until BLOCK_SIZE_MAXIMUM, larger requests get a block of their own
+		Void AllocateBlock(size_t size)
+		{
+			auto _blockSize = blockSize;
+
+			if (size > (_blockSize - BLOCK_HEADER_SIZE))
+			{
+
+				_blockSize = size + BLOCK_HEADER_SIZE;
+			}
+			else if (blockSize < BLOCK_SIZE_MAXIMUM)
+			{
+
+				blockSize *= 2;
+			}
+
+			auto lpNewBlock = static_cast<Block*>(
+				::operator new(_blockSize)
+			);
+
+			lpNewBlock->lpPrevious = lpBlock;
+			lpNewBlock->Size       = _blockSize;
+
+			lpBlock    = lpNewBlock;
+			lpNext     = reinterpret_cast<uint8*>(lpNewBlock) + BLOCK_HEADER_SIZE;
+			lpEnd      = reinterpret_cast<uint8*>(lpNewBlock) + _blockSize;
+			this->size += _blockSize;
+		}
+	};
+}
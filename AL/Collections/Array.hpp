@@ -4,6 +4,8 @@
 #include "Iterator.hpp"
 #include "ICollection.hpp"
 
+#include <new> // placement new
+
 namespace AL::Collections
 {
 	template<typename T>
@@ -250,17 +252,18 @@ namespace AL::Collections
 		template<size_t S, size_t ... INDEXES>
 		Array(T(&&values)[S], Index_Sequence<INDEXES ...>)
 			: lpValues(
-				new T[S] { AL::Move(values[INDEXES]) ... }
+				AllocateUninitialized(S)
 			),
 			capacity(
 				S
 			)
 		{
+			(new (&lpValues[INDEXES]) T(AL::Move(values[INDEXES])), ...);
 		}
 		template<size_t S, size_t ... INDEXES>
 		Array(const T(&values)[S], Index_Sequence<INDEXES ...>)
 			: lpValues(
-				new T[S] { values[INDEXES] ... }
+				Allocate(S, 0, &values[0])
 			),
 			capacity(
 				S
@@ -279,36 +282,82 @@ namespace AL::Collections
 		typedef typename IBidirectionalCollection<T, ArrayIterator, ArrayReverseIterator>::ReverseIterator      ReverseIterator;
 		typedef typename IBidirectionalCollection<T, ArrayIterator, ArrayReverseIterator>::ConstReverseIterator ConstReverseIterator;
 
+		// Copy constructs size values from source and default constructs reserve values
 		static Type* Allocate(size_t size, size_t reserve, const Type& source = Type())
 		{
-			auto lpValues = new Type[size + reserve];
-			auto lpValue  = lpValues;
+			auto lpValues = AllocateUninitialized(
+				size + reserve
+			);
 
-			for (size_t i = 0; i < size; ++i, ++lpValue)
+			for (size_t i = 0; i < size; ++i)
 			{
-
-				*lpValue = source;
+				new (&lpValues[i]) Type(
+					source
+				);
 			}
 
+			Construct(
+				&lpValues[size],
+				reserve
+			);
+
 			return lpValues;
 		}
+		// Copy constructs size values from lpSource and default constructs reserve values
 		static Type* Allocate(size_t size, size_t reserve, const Type* lpSource)
 		{
-			auto lpValues = new Type[size + reserve];
-			auto lpValue  = lpValues;
+			auto lpValues = AllocateUninitialized(
+				size + reserve
+			);
 
-			for (size_t i = 0; i < size; ++i, ++lpValue, ++lpSource)
+			if constexpr (Is_POD<Type>::Value)
 			{
+				if (size != 0)
+				{
 
-				*lpValue = *lpSource;
+					memcpy(
+						lpValues,
+						lpSource,
+						size * sizeof(Type)
+					);
+				}
 			}
+			else
+			{
+				for (size_t i = 0; i < size; ++i)
+				{
+					new (&lpValues[i]) Type(
+						lpSource[i]
+					);
+				}
+			}
+
+			Construct(
+				&lpValues[size],
+				reserve
+			);
 
 			return lpValues;
 		}
 
-		static Void Free(Type* value)
+		// Destroys count values and frees lpValues
+		static Void Free(Type* lpValues, size_t count)
 		{
-			delete[] value;
+			if (lpValues != nullptr)
+			{
+				if constexpr (!Is_POD<Type>::Value)
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						lpValues[i].~Type();
+					}
+				}
+
+				::operator delete(
+					lpValues,
+					::std::align_val_t(alignof(Type))
+				);
+			}
 		}
 
 		template<size_t S>
@@ -500,11 +549,10 @@ namespace AL::Collections
 
 		virtual ~Array()
 		{
-			if (lpValues != nullptr)
-			{
-
-				Free(lpValues);
-			}
+			Free(
+				lpValues,
+				capacity
+			);
 		}
 
 		virtual size_t GetSize() const override
@@ -522,19 +570,62 @@ namespace AL::Collections
 		{
 			auto capacity = GetCapacity();
 
-			if (auto lpValues = ((capacity != value) ? new Type[value] : nullptr))
+			if (capacity != value)
 			{
-				Move(
-					this->lpValues,
-					capacity,
-					lpValues,
+				auto lpValues = AllocateUninitialized(
 					value
 				);
 
-				if (this->lpValues != nullptr)
+				auto count = (capacity <= value) ? capacity : value;
+
+				// values are moved into uninitialized storage so nothing is default constructed first
+				if constexpr (Is_Trivially_Relocatable<Type>::Value)
 				{
+					if (count != 0)
+					{
 
-					Free(this->lpValues);
+						memcpy(
+							static_cast<Void*>(lpValues),
+							static_cast<const Void*>(this->lpValues),
+							count * sizeof(Type)
+						);
+					}
+				}
+				else
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						new (&lpValues[i]) Type(
+							AL::Move(this->lpValues[i])
+						);
+					}
+				}
+
+				Construct(
+					&lpValues[count],
+					value - count
+				);
+
+				if constexpr (Is_Trivially_Relocatable<Type>::Value)
+				{
+					for (size_t i = count; i < capacity; ++i)
+					{
+						this->lpValues[i].~Type();
+					}
+
+					// relocated values must not be destroyed
+					Free(
+						this->lpValues,
+						0
+					);
+				}
+				else
+				{
+
+					Free(
+						this->lpValues,
+						capacity
+					);
 				}
 
 				this->lpValues = lpValues;
@@ -545,13 +636,17 @@ namespace AL::Collections
 		// Changes the container size+capacity and discards values
 		Void SetCapacity(size_t value)
 		{
-			if (auto lpValues = ((GetCapacity() != value) ? Allocate(value, 0) : nullptr))
+			if (GetCapacity() != value)
 			{
-				if (this->lpValues != nullptr)
-				{
+				auto lpValues = Allocate(
+					value,
+					0
+				);
 
-					Free(this->lpValues);
-				}
+				Free(
+					this->lpValues,
+					capacity
+				);
 
 				this->lpValues = lpValues;
 				this->capacity = value;
@@ -758,12 +853,17 @@ namespace AL::Collections
 
 		Array& operator = (Array&& array)
 		{
-			if (lpValues != nullptr)
+			if (&array == this)
 			{
 
-				Free(lpValues);
+				return *this;
 			}
 
+			Free(
+				lpValues,
+				capacity
+			);
+
 			lpValues = array.lpValues;
 			array.lpValues = nullptr;
 
@@ -813,7 +913,7 @@ namespace AL::Collections
 
 			if constexpr (Is_POD<Type>::Value)
 			{
-				if (!memcmp(lpValues, array.lpValues, capacity))
+				if ((capacity != 0) && !memcmp(lpValues, array.lpValues, capacity * sizeof(Type)))
 				{
 
 					return False;
@@ -848,28 +948,54 @@ namespace AL::Collections
 		}
 
 	private:
-		template<size_t S, size_t ... INDEXES>
-		Void Assign(Type(&&values)[S], Index_Sequence<INDEXES ...>)
+		static Type* AllocateUninitialized(size_t count)
 		{
-			if (lpValues != nullptr)
+			if (count == 0)
 			{
 
-				Free(lpValues);
+				return nullptr;
+			}
+
+			return static_cast<Type*>(
+				::operator new(count * sizeof(Type), ::std::align_val_t(alignof(Type)))
+			);
+		}
+
+		// Default constructs count values in uninitialized lpValues
+		// - POD values are left uninitialized like new Type[]
+		static Void Construct(Type* lpValues, size_t count)
+		{
+			if constexpr (!Is_POD<Type>::Value)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					new (&lpValues[i]) Type();
+				}
 			}
+		}
+
+		template<size_t S, size_t ... INDEXES>
+		Void Assign(Type(&&values)[S], Index_Sequence<INDEXES ...>)
+		{
+			Free(
+				lpValues,
+				capacity
+			);
 
-			lpValues = new Type[S] { AL::Move(values[INDEXES]) ... };
+			lpValues = AllocateUninitialized(S);
 			capacity = S;
+
+			(new (&lpValues[INDEXES]) Type(AL::Move(values[INDEXES])), ...);
 		}
 		template<size_t S, size_t ... INDEXES>
 		Void Assign(const Type(&values)[S], Index_Sequence<INDEXES ...>)
 		{
-			if (lpValues != nullptr)
-			{
-
-				Free(lpValues);
-			}
+			Free(
+				lpValues,
+				capacity
+			);
 
-			lpValues = new Type[S] { values[INDEXES] ... };
+			lpValues = Allocate(S, 0, &values[0]);
 			capacity = S;
 		}
 	};
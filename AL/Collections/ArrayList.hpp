@@ -5,6 +5,8 @@
 #include "Iterator.hpp"
 #include "ICollection.hpp"
 
+#include <new> // placement new
+
 namespace AL::Collections
 {
 	template<typename T>
@@ -241,12 +243,48 @@ namespace AL::Collections
 		}
 	};
 
+	template<typename T, size_t CAPACITY>
+	struct ArrayListInlineStorage
+	{
+		alignas(T) uint8 Values[CAPACITY * sizeof(T)];
+
+		T*       GetValues()
+		{
+			return reinterpret_cast<T*>(
+				&Values[0]
+			);
+		}
+		const T* GetValues() const
+		{
+			return reinterpret_cast<const T*>(
+				&Values[0]
+			);
+		}
+	};
 	template<typename T>
+	struct ArrayListInlineStorage<T, 0>
+	{
+		T*       GetValues() const
+		{
+			return nullptr;
+		}
+	};
+
+	// Values live in uninitialized storage so only [0, GetSize()) is ever constructed
+	// - Capacity grows geometrically when values are added
+	// - Values are moved with memcpy when Is_Trivially_Relocatable<T>
+	// - Up to INLINE_CAPACITY values are stored inside the list without allocating
+	template<typename T, size_t INLINE_CAPACITY = 0>
 	class ArrayList
 		: public Array<T>::Collection
 	{
-		size_t   size = 0;
-		Array<T> container;
+		static constexpr size_t MINIMUM_CAPACITY = 8;
+
+		[[no_unique_address]] ArrayListInlineStorage<T, INLINE_CAPACITY> inlineValues;
+
+		T*     lpValues;
+		size_t size;
+		size_t capacity;
 
 	public:
 		typedef T                                         Type;
@@ -267,29 +305,32 @@ namespace AL::Collections
 		}
 
 		ArrayList(ArrayList&& arrayList)
-			: size(
-				arrayList.size
-			),
-			container(
-				Move(arrayList.container)
+			: ArrayList(
+				0
 			)
 		{
-			arrayList.size = 0;
+			Take(
+				arrayList
+			);
 		}
 		ArrayList(const ArrayList& arrayList)
 			: ArrayList(
-				&arrayList.container[0],
+				arrayList.lpValues,
 				arrayList.size,
-				arrayList.GetCapacity() - arrayList.size
+				arrayList.capacity - arrayList.size
 			)
 		{
 		}
 
 		explicit ArrayList(size_t capacity)
-			: ArrayList(
-				Type(),
-				0,
-				capacity
+			: lpValues(
+				(capacity <= INLINE_CAPACITY) ? inlineValues.GetValues() : Allocate(capacity)
+			),
+			size(
+				0
+			),
+			capacity(
+				(capacity <= INLINE_CAPACITY) ? INLINE_CAPACITY : capacity
 			)
 		{
 		}
@@ -313,15 +354,16 @@ namespace AL::Collections
 		{
 		}
 		ArrayList(const Type& value, size_t count, size_t reserve)
-			: size(
-				count
-			),
-			container(
-				value,
-				count,
-				reserve
+			: ArrayList(
+				count + reserve
 			)
 		{
+			for (; size < count; ++size)
+			{
+				new (&lpValues[size]) Type(
+					value
+				);
+			}
 		}
 
 		ArrayList(const Type* lpValues, size_t count)
@@ -333,19 +375,29 @@ namespace AL::Collections
 		{
 		}
 		ArrayList(const Type* lpValues, size_t count, size_t reserve)
-			: size(
-				count
-			),
-			container(
-				lpValues,
-				count,
-				reserve
+			: ArrayList(
+				count + reserve
 			)
 		{
+			Construct(
+				this->lpValues,
+				lpValues,
+				count
+			);
+
+			size = count;
 		}
 
 		virtual ~ArrayList()
 		{
+			Destroy(
+				lpValues,
+				size
+			);
+
+			Free(
+				lpValues
+			);
 		}
 
 		virtual size_t GetSize() const override
@@ -355,7 +407,7 @@ namespace AL::Collections
 
 		virtual size_t GetCapacity() const override
 		{
-			return container.GetCapacity();
+			return capacity;
 		}
 
 		Iterator      Find(const Type& value)
@@ -414,9 +466,9 @@ namespace AL::Collections
 
 		Bool Contains(const Type& value) const
 		{
-			for (auto& _value : container)
+			for (size_t i = 0; i < size; ++i)
 			{
-				if (_value == value)
+				if (lpValues[i] == value)
 				{
 
 					return True;
@@ -426,28 +478,90 @@ namespace AL::Collections
 			return False;
 		}
 
-		Void SetCapacity(size_t value)
+		Void Swap(ArrayList& arrayList)
 		{
-			container.SetSize(
-				value
+			// inline values can't trade places by swapping pointers
+			if (IsInline() || arrayList.IsInline())
+			{
+				ArrayList temp(
+					Move(arrayList)
+				);
+
+				arrayList = Move(
+					*this
+				);
+
+				*this = Move(
+					temp
+				);
+
+				return;
+			}
+
+			AL::Swap(
+				lpValues,
+				arrayList.lpValues
+			);
+
+			AL::Swap(
+				size,
+				arrayList.size
 			);
 
-			if (GetSize() > value)
+			AL::Swap(
+				capacity,
+				arrayList.capacity
+			);
+		}
+
+		// Changes the capacity to exactly value, values past it are destroyed
+		Void SetCapacity(size_t value)
+		{
+			if (value != capacity)
 			{
+				if (size > value)
+				{
+					Destroy(
+						&lpValues[value],
+						size - value
+					);
+
+					size = value;
+				}
 
-				size = value;
+				Reallocate(
+					value
+				);
 			}
 		}
 
+		// Ensures count more values can be added without reallocating
 		Void Reserve(size_t count)
+		{
+			if ((capacity - size) < count)
+			{
+
+				Reallocate(
+					size + count
+				);
+			}
+		}
+
+		Void ShrinkToFit()
 		{
 			SetCapacity(
-				GetCapacity() + count
+				size
 			);
 		}
 
+		// Destroys every value and keeps the capacity
 		Void Clear()
 		{
+			Destroy(
+				lpValues,
+				size
+			);
+
 			size = 0;
 		}
 
@@ -466,14 +580,13 @@ namespace AL::Collections
 				count
 			);
 		}
+		// Sets [index, index + count) to value and discards the values after it
 		Void Fill(const Type& value, size_t index, size_t count)
 		{
-			auto capacity = GetCapacity();
-
-			if (index > capacity)
+			if (index > size)
 			{
 
-				index = capacity;
+				index = size;
 			}
 
 			if (count > (capacity - index))
@@ -482,20 +595,44 @@ namespace AL::Collections
 				count = capacity - index;
 			}
 
-			container.Fill(
-				value,
-				index,
-				count
-			);
+			auto end = index + count;
 
-			size = count;
+			for (auto i = index; i < end; ++i)
+			{
+				if (i < size)
+				{
+
+					lpValues[i] = value;
+				}
+				else
+				{
+
+					new (&lpValues[i]) Type(
+						value
+					);
+				}
+			}
+
+			if (size > end)
+			{
+
+				Destroy(
+					&lpValues[end],
+					size - end
+				);
+			}
+
+			size = end;
 		}
 
 		Void PopBack()
 		{
-			Erase(
-				--end()
+			AL_ASSERT(
+				size != 0,
+				"ArrayList is empty"
 			);
+
+			lpValues[--size].~Type();
 		}
 
 		Void PopFront()
@@ -507,15 +644,13 @@ namespace AL::Collections
 
 		Void PushBack(Type&& value)
 		{
-			Insert(
-				end(),
+			EmplaceBack(
 				Move(value)
 			);
 		}
 		Void PushBack(const Type& value)
 		{
-			Insert(
-				end(),
+			EmplaceBack(
 				value
 			);
 		}
@@ -536,29 +671,71 @@ namespace AL::Collections
 		}
 
 		template<typename T_ITERATOR, typename ... TArgs>
-		Void Emplace(T_ITERATOR it, TArgs ... args)
+		Void Emplace(T_ITERATOR it, TArgs&& ... args)
 		{
-			Type value(
-				Forward<TArgs>(args) ...
+			auto index = GetIndex(
+				it
 			);
 
-			Insert(
-				it,
-				Move(value)
-			);
+			if (index == size)
+			{
+				EmplaceBack(
+					Forward<TArgs>(args) ...
+				);
+			}
+			else
+			{
+				Type value(
+					Forward<TArgs>(args) ...
+				);
+
+				Insert(
+					it,
+					Move(value)
+				);
+			}
 		}
 
+		// Constructs the value in place
 		template<typename ... TArgs>
-		Void EmplaceBack(TArgs ... args)
+		Void EmplaceBack(TArgs&& ... args)
 		{
-			Emplace(
-				end(),
-				Forward<TArgs>(args) ...
-			);
+			if (size == capacity)
+			{
+				auto newCapacity = GetGrowthCapacity(size + 1);
+				auto lpNewValues = Allocate(newCapacity);
+
+				// constructed first since args may refer to a value in this list
+				new (&lpNewValues[size]) Type(
+					Forward<TArgs>(args) ...
+				);
+
+				Relocate(
+					lpNewValues,
+					lpValues,
+					size
+				);
+
+				Free(
+					lpValues
+				);
+
+				lpValues = lpNewValues;
+				capacity = newCapacity;
+			}
+			else
+			{
+
+				new (&lpValues[size]) Type(
+					Forward<TArgs>(args) ...
+				);
+			}
+
+			++size;
 		}
 
 		template<typename ... TArgs>
-		Void EmplaceFront(TArgs ... args)
+		Void EmplaceFront(TArgs&& ... args)
 		{
 			Emplace(
 				begin(),
@@ -571,7 +748,7 @@ namespace AL::Collections
 		{
 			Erase(
 				it,
-				it
+				it + 1
 			);
 		}
 		template<typename T_ITERATOR>
@@ -579,61 +756,34 @@ namespace AL::Collections
 		{
 			typedef typename Remove_Modifiers<T_ITERATOR>::Type _T_ITERATOR;
 
-			if constexpr (Is_Type<_T_ITERATOR, Iterator>::Value)
-			{
-				size_t i_first = GetIteratorDifference(begin(), first);
-				size_t i_last  = GetIteratorDifference(begin(), last);
-				size_t i_count = i_last - i_first;
-
-				Array<Type>::Move(
-					&container[i_first + i_count],
-					&container[i_first],
-					GetSize() - (i_first + i_count)
-				);
+			size_t i_first;
+			size_t i_last;
 
-				size -= i_count;
-			}
-			else if constexpr (Is_Type<_T_ITERATOR, ConstIterator>::Value)
+			if constexpr (Is_Type<_T_ITERATOR, ReverseIterator>::Value || Is_Type<_T_ITERATOR, ConstReverseIterator>::Value)
 			{
-				size_t i_first = GetIteratorDifference(cbegin(), first);
-				size_t i_last  = GetIteratorDifference(cbegin(), last);
-				size_t i_count = i_last - i_first;
-
-				Array<Type>::Move(
-					&container[i_first + i_count],
-					&container[i_first],
-					GetSize() - (i_first + i_count)
-				);
-
-				size -= i_count;
+				i_first = GetIndex(last) + 1;
+				i_last  = GetIndex(first) + 1;
 			}
-			else if constexpr (Is_Type<_T_ITERATOR, ReverseIterator>::Value)
+			else
 			{
-				size_t i_first = GetIteratorDifference(rend(), first);
-				size_t i_last  = GetIteratorDifference(rend(), last);
-				size_t i_count = i_last - i_first;
-
-				Array<Type>::Move(
-					&container[i_first + i_count],
-					&container[i_first],
-					GetSize() - (i_first + i_count)
-				);
-
-				size -= i_count;
+				i_first = GetIndex(first);
+				i_last  = GetIndex(last);
 			}
-			else if constexpr (Is_Type<_T_ITERATOR, ConstReverseIterator>::Value)
+
+			if (i_first < i_last)
 			{
-				size_t i_first = GetIteratorDifference(crend(), first);
-				size_t i_last  = GetIteratorDifference(crend(), last);
-				size_t i_count = i_last - i_first;
+				Destroy(
+					&lpValues[i_first],
+					i_last - i_first
+				);
 
-				Array<Type>::Move(
-					&container[i_first + i_count],
-					&container[i_first],
-					GetSize() - (i_first + i_count)
+				Relocate(
+					&lpValues[i_first],
+					&lpValues[i_last],
+					size - i_last
 				);
 
-				size -= i_count;
+				size -= i_last - i_first;
 			}
 		}
 
@@ -655,180 +805,164 @@ namespace AL::Collections
 		template<typename T_ITERATOR>
 		T_ITERATOR Insert(T_ITERATOR it, Type&& value)
 		{
-			auto size = GetSize();
-
-			size_t i = &(*it) - &container[0];
+			auto index = GetIndex(
+				it
+			);
 
-			if (size == GetCapacity())
+			if (IsOwnValue(&value, 1))
 			{
-
-				Reserve(
-					1
+				Type _value(
+					Move(value)
 				);
-			}
 
-			for (size_t j = size; j > i; --j)
-			{
-				Array<Type>::Move(
-					&container[j - 1],
-					&container[(j - 1) + 1],
-					1
+				return Insert(
+					T_ITERATOR(&lpValues[index]),
+					Move(_value)
 				);
 			}
 
-			Array<Type>::Move(
-				&value,
-				&container[i],
+			Open(
+				index,
 				1
 			);
 
-			++this->size;
+			new (&lpValues[index]) Type(
+				Move(value)
+			);
+
+			++size;
 
 			return T_ITERATOR(
-				&container[i]
+				&lpValues[index]
 			);
 		}
 		template<typename T_ITERATOR>
 		T_ITERATOR Insert(T_ITERATOR it, const Type& value)
 		{
-			auto size = GetSize();
-
-			size_t i = &(*it) - &container[0];
-
-			if (size == GetCapacity())
-			{
-
-				Reserve(
-					1
-				);
-			}
-
-			for (size_t j = size; j > i; --j)
-			{
-				Array<Type>::Move(
-					&container[j - 1],
-					&container[(j - 1) + 1],
-					1
-				);
-			}
-
-			Array<Type>::Copy(
+			return Insert(
+				it,
 				&value,
-				&container[i],
 				1
 			);
-
-			++this->size;
-
-			return T_ITERATOR(
-				&container[i]
-			);
 		}
 		template<typename T_ITERATOR>
 		T_ITERATOR Insert(T_ITERATOR it, const Type* lpValues, size_t count)
 		{
-			auto size     = GetSize();
-			auto capacity = GetCapacity();
-			auto newSize  = size + count;
-
-			size_t i = &(*it) - &container[0];
+			auto index = GetIndex(
+				it
+			);
 
-			if (newSize > capacity)
+			// values would move or be freed while opening the gap
+			if (IsOwnValue(lpValues, count))
 			{
-
-				Reserve(
-					newSize - capacity
+				ArrayList values(
+					lpValues,
+					count
 				);
-			}
 
-			for (size_t j = size; j > i; --j)
-			{
-				Array<Type>::Move(
-					&container[j - 1],
-					&container[(j - 1) + count],
-					1
+				return Insert(
+					T_ITERATOR(&this->lpValues[index]),
+					values.lpValues,
+					count
 				);
 			}
 
-			Array<Type>::Copy(
+			Open(
+				index,
+				count
+			);
+
+			Construct(
+				&this->lpValues[index],
 				lpValues,
-				&container[i],
 				count
 			);
 
-			this->size = newSize;
+			size += count;
 
 			return T_ITERATOR(
-				&container[i]
+				&this->lpValues[index]
 			);
 		}
 
 		virtual Iterator      begin() override
 		{
-			return container.begin();
+			return Iterator(
+				lpValues
+			);
 		}
 		virtual ConstIterator begin() const override
 		{
-			return container.begin();
+			return ConstIterator(
+				lpValues
+			);
 		}
 
 		virtual Iterator      end() override
 		{
 			return Iterator(
-				&container[GetSize()]
+				lpValues + size
 			);
 		}
 		virtual ConstIterator end() const override
 		{
 			return ConstIterator(
-				&container[GetSize()]
+				lpValues + size
 			);
 		}
 
 		virtual ConstIterator cbegin() const override
 		{
-			return container.cbegin();
+			return ConstIterator(
+				lpValues
+			);
 		}
 
 		virtual ConstIterator cend() const override
 		{
 			return ConstIterator(
-				&container[GetSize()]
+				lpValues + size
 			);
 		}
 
 		virtual ReverseIterator      rbegin() override
 		{
 			return ReverseIterator(
-				&container[GetSize() - 1]
+				lpValues + size - 1
 			);
 		}
 		virtual ConstReverseIterator rbegin() const override
 		{
 			return ConstReverseIterator(
-				&container[GetSize() - 1]
+				lpValues + size - 1
 			);
 		}
 
 		virtual ReverseIterator      rend() override
 		{
-			return container.rend();
+			return ReverseIterator(
+				lpValues - 1
+			);
 		}
 		virtual ConstReverseIterator rend() const override
 		{
-			return container.rend();
+			return ConstReverseIterator(
+				lpValues - 1
+			);
 		}
 
 		virtual ConstReverseIterator crbegin() const override
 		{
 			return ConstReverseIterator(
-				&container[GetSize() - 1]
+				lpValues + size - 1
 			);
 		}
 
 		virtual ConstReverseIterator crend() const override
 		{
-			return container.crend();
+			return ConstReverseIterator(
+				lpValues - 1
+			);
 		}
 
 		Type&       operator [] (size_t index)
@@ -838,7 +972,7 @@ namespace AL::Collections
 				"index out of bounds"
 			);
 
-			return container[index];
+			return lpValues[index];
 		}
 		const Type& operator [] (size_t index) const
 		{
@@ -847,24 +981,40 @@ namespace AL::Collections
 				"index out of bounds"
 			);
 
-			return container[index];
+			return lpValues[index];
 		}
 
 		ArrayList& operator = (ArrayList&& arrayList)
 		{
-			container = Move(
-				arrayList.container
-			);
+			if (&arrayList != this)
+			{
+				Destroy(
+					lpValues,
+					size
+				);
+
+				Free(
+					lpValues
+				);
+
+				Reset();
 
-			size = arrayList.size;
-			arrayList.size = 0;
+				Take(
+					arrayList
+				);
+			}
 
 			return *this;
 		}
 		ArrayList& operator = (const ArrayList& arrayList)
 		{
-			container = arrayList.container;
-			size      = arrayList.size;
+			if (&arrayList != this)
+			{
+				Assign(
+					arrayList.lpValues,
+					arrayList.size
+				);
+			}
 
 			return *this;
 		}
@@ -872,20 +1022,17 @@ namespace AL::Collections
 		template<size_t S>
 		ArrayList& operator = (const Type(&values)[S])
 		{
-			container.Assign(
-				values
+			Assign(
+				&values[0],
+				S
 			);
 
-			size = S;
-
 			return *this;
 		}
 
 		Bool operator == (const ArrayList& arrayList) const
 		{
-			size_t size;
-
-			if ((size = GetSize()) != arrayList.GetSize())
+			if (GetSize() != arrayList.GetSize())
 			{
 
 				return False;
@@ -893,7 +1040,7 @@ namespace AL::Collections
 
 			if constexpr (Is_POD<Type>::Value)
 			{
-				if (!memcmp(&container[0], &arrayList.container[0], size))
+				if ((size != 0) && !memcmp(lpValues, arrayList.lpValues, size * sizeof(Type)))
 				{
 
 					return False;
@@ -901,12 +1048,9 @@ namespace AL::Collections
 			}
 			else
 			{
-				auto lpValues1 = &container[0];
-				auto lpValues2 = &arrayList.container[0];
-
-				for (size_t i = 0; i < size; ++i, ++lpValues1, ++lpValues2)
+				for (size_t i = 0; i < size; ++i)
 				{
-					if (*lpValues1 != *lpValues2)
+					if (lpValues[i] != arrayList.lpValues[i])
 					{
 
 						return False;
@@ -926,5 +1070,276 @@ namespace AL::Collections
 
 			return True;
 		}
+
+	private:
+		static Type* Allocate(size_t capacity)
+		{
+			if (capacity == 0)
+			{
+
+				return nullptr;
+			}
+
+			return static_cast<Type*>(
+				::operator new(capacity * sizeof(Type), ::std::align_val_t(alignof(Type)))
+			);
+		}
+
+		Void Free(Type* lpValues)
+		{
+			if ((lpValues != nullptr) && (lpValues != inlineValues.GetValues()))
+			{
+
+				::operator delete(
+					lpValues,
+					::std::align_val_t(alignof(Type))
+				);
+			}
+		}
+
+		// Copy constructs count values from lpSource in uninitialized lpDestination
+		static Void Construct(Type* lpDestination, const Type* lpSource, size_t count)
+		{
+			if constexpr (Is_POD<Type>::Value)
+			{
+				if (count != 0)
+				{
+
+					memcpy(
+						lpDestination,
+						lpSource,
+						count * sizeof(Type)
+					);
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					new (&lpDestination[i]) Type(
+						lpSource[i]
+					);
+				}
+			}
+		}
+
+		static Void Destroy(Type* lpValues, size_t count)
+		{
+			if constexpr (!Is_POD<Type>::Value)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					lpValues[i].~Type();
+				}
+			}
+		}
+
+		// Moves count values from lpSource to uninitialized lpDestination leaving lpSource uninitialized
+		// - Ranges may overlap
+		static Void Relocate(Type* lpDestination, Type* lpSource, size_t count)
+		{
+			if ((count == 0) || (lpDestination == lpSource))
+			{
+
+				return;
+			}
+
+			if constexpr (Is_Trivially_Relocatable<Type>::Value)
+			{
+				memmove(
+					static_cast<Void*>(lpDestination),
+					static_cast<const Void*>(lpSource),
+					count * sizeof(Type)
+				);
+			}
+			// every destination is either uninitialized or was relocated already
+			else if (lpDestination < lpSource)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					new (&lpDestination[i]) Type(
+						AL::Move(lpSource[i])
+					);
+
+					lpSource[i].~Type();
+				}
+			}
+			else
+			{
+				for (size_t i = count; i > 0; --i)
+				{
+					new (&lpDestination[i - 1]) Type(
+						AL::Move(lpSource[i - 1])
+					);
+
+					lpSource[i - 1].~Type();
+				}
+			}
+		}
+
+		// Capacity to grow to when minimum values don't fit
+		size_t GetGrowthCapacity(size_t minimum) const
+		{
+			auto capacity = this->capacity * 2;
+
+			if (capacity < MINIMUM_CAPACITY)
+			{
+
+				capacity = MINIMUM_CAPACITY;
+			}
+
+			return (capacity >= minimum) ? capacity : minimum;
+		}
+
+		template<typename T_ITERATOR>
+		size_t GetIndex(const T_ITERATOR& it) const
+		{
+			return static_cast<size_t>(
+				it.operator->() - lpValues
+			);
+		}
+
+		Bool IsOwnValue(const Type* lpValue, size_t count) const
+		{
+			return (count != 0) && (lpValue < (lpValues + size)) && ((lpValue + count) > lpValues);
+		}
+
+		Bool IsInline() const
+		{
+			if constexpr (INLINE_CAPACITY == 0)
+			{
+
+				return False;
+			}
+			else
+			{
+
+				return lpValues == inlineValues.GetValues();
+			}
+		}
+
+		// Forgets the values without destroying them
+		Void Reset()
+		{
+			lpValues = inlineValues.GetValues();
+			size     = 0;
+			capacity = INLINE_CAPACITY;
+		}
+
+		// Takes the values of arrayList and leaves it empty
+		// - This list must be empty and not own an allocation
+		Void Take(ArrayList& arrayList)
+		{
+			if (arrayList.IsInline())
+			{
+				Relocate(
+					lpValues,
+					arrayList.lpValues,
+					arrayList.size
+				);
+
+				size = arrayList.size;
+				arrayList.size = 0;
+			}
+			else
+			{
+				lpValues = arrayList.lpValues;
+				size     = arrayList.size;
+				capacity = arrayList.capacity;
+
+				arrayList.Reset();
+			}
+		}
+
+		// Values move back inline once they fit
+		Void Reallocate(size_t capacity)
+		{
+			Type* lpNewValues;
+
+			if (capacity <= INLINE_CAPACITY)
+			{
+				lpNewValues = inlineValues.GetValues();
+				capacity    = INLINE_CAPACITY;
+			}
+			else
+			{
+
+				lpNewValues = Allocate(
+					capacity
+				);
+			}
+
+			Relocate(
+				lpNewValues,
+				lpValues,
+				size
+			);
+
+			Free(
+				lpValues
+			);
+
+			lpValues       = lpNewValues;
+			this->capacity = capacity;
+		}
+
+		// Leaves [index, index + count) uninitialized (GetSize() is unchanged)
+		Void Open(size_t index, size_t count)
+		{
+			if ((size + count) > capacity)
+			{
+				auto newCapacity = GetGrowthCapacity(size + count);
+				auto lpNewValues = Allocate(newCapacity);
+
+				Relocate(
+					lpNewValues,
+					lpValues,
+					index
+				);
+
+				Relocate(
+					&lpNewValues[index + count],
+					&lpValues[index],
+					size - index
+				);
+
+				Free(
+					lpValues
+				);
+
+				lpValues = lpNewValues;
+				capacity = newCapacity;
+			}
+			else
+			{
+
+				Relocate(
+					&lpValues[index + count],
+					&lpValues[index],
+					size - index
+				);
+			}
+		}
+
+		Void Assign(const Type* lpValues, size_t count)
+		{
+			Clear();
+
+			if (capacity < count)
+			{
+
+				Reallocate(
+					count
+				);
+			}
+
+			Construct(
+				this->lpValues,
+				lpValues,
+				count
+			);
+
+			size = count;
+		}
 	};
 }
@@ -6,7 +6,8 @@
 
 namespace AL::Collections
 {
-	template<typename T_KEY, typename T_VALUE>
+	// Pairs are kept ordered by key, or in insertion order if IS_INSERTION_ORDERED
+	template<typename T_KEY, typename T_VALUE, Bool IS_INSERTION_ORDERED = False>
 	class Dictionary
 		: public LinkedList<KeyValuePair<T_KEY, T_VALUE>>::Collection
 	{
@@ -137,7 +138,7 @@ namespace AL::Collections
 					return;
 				}
 
-				if (it->Key > key)
+				if (!IS_INSERTION_ORDERED && (it->Key > key))
 				{
 					container.Insert(
 						it,
@@ -274,7 +275,7 @@ namespace AL::Collections
 					break;
 				}
 
-				if (it->Key > key)
+				if (!IS_INSERTION_ORDERED && (it->Key > key))
 				{
 					// TODO: debug
 
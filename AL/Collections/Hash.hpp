@@ -0,0 +1,34 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "AL/Algorithms/FNV.hpp"
+
+namespace AL::Collections
+{
+	// POD types are hashed by value with FNV
+	// - Everything else must provide GetHash()
+	template<typename T>
+	struct Hash
+	{
+		typedef Algorithms::FNV<size_t> _FNV;
+
+		size_t operator () (const T& value) const
+		{
+			if constexpr (Is_POD<T>::Value)
+			{
+
+				return _FNV::Calculate(
+					&value,
+					sizeof(T)
+				);
+			}
+			else
+			{
+
+				return static_cast<size_t>(
+					value.GetHash()
+				);
+			}
+		}
+	};
+}
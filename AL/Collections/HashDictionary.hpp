@@ -0,0 +1,352 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "Hash.hpp"
+#include "HashTable.hpp"
+#include "KeyValuePair.hpp"
+
+namespace AL::Collections
+{
+	// Unordered alternative to Dictionary with amortized O(1) Find/Add/Remove
+	template<typename T_KEY, typename T_VALUE, typename T_HASH = Hash<T_KEY>>
+	class HashDictionary
+		: public HashTable<KeyValuePair<T_KEY, T_VALUE>, T_KEY, T_HASH>::Collection
+	{
+		typedef KeyValuePair<T_KEY, T_VALUE>        _Pair;
+		typedef HashTable<_Pair, T_KEY, T_HASH>     _Container;
+
+		_Container container;
+
+	public:
+		typedef T_KEY                                     Key;
+		typedef T_VALUE                                   Value;
+		typedef T_HASH                                    Hasher;
+
+		typedef KeyValuePair<Key, Value>                  Type;
+
+		typedef typename _Container::Collection           Collection;
+
+		typedef typename Collection::Iterator             Iterator;
+		typedef typename Collection::ConstIterator        ConstIterator;
+
+		typedef typename Collection::ReverseIterator      ReverseIterator;
+		typedef typename Collection::ConstReverseIterator ConstReverseIterator;
+
+		HashDictionary()
+		{
+		}
+
+		HashDictionary(HashDictionary&& dictionary)
+			: container(
+				Move(dictionary.container)
+			)
+		{
+		}
+		HashDictionary(const HashDictionary& dictionary)
+			: container(
+				dictionary.container
+			)
+		{
+		}
+
+		explicit HashDictionary(size_t capacity)
+			: container(
+				capacity
+			)
+		{
+		}
+
+		template<size_t S>
+		HashDictionary(const Type(&pairs)[S])
+			: HashDictionary(
+				&pairs[0],
+				S
+			)
+		{
+		}
+		HashDictionary(const Type* lpPairs, size_t count)
+			: container(
+				count
+			)
+		{
+			for (size_t i = 0; i < count; ++i, ++lpPairs)
+			{
+				Add(
+					lpPairs->Key,
+					lpPairs->Value
+				);
+			}
+		}
+
+		virtual ~HashDictionary()
+		{
+		}
+
+		virtual size_t GetSize() const override
+		{
+			return container.GetSize();
+		}
+
+		virtual size_t GetCapacity() const override
+		{
+			return container.GetCapacity();
+		}
+
+		Iterator      Find(const Key& key)
+		{
+			return container.Find(
+				key
+			);
+		}
+		ConstIterator Find(const Key& key) const
+		{
+			return container.Find(
+				key
+			);
+		}
+
+		Bool Contains(const Key& key) const
+		{
+			if (!container.Contains(key))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+
+		Void Clear()
+		{
+			container.Clear();
+		}
+
+		Void Reserve(size_t count)
+		{
+			container.Reserve(
+				count
+			);
+		}
+
+		Void Rehash(size_t capacity)
+		{
+			container.Rehash(
+				capacity
+			);
+		}
+
+		Void ShrinkToFit()
+		{
+			container.ShrinkToFit();
+		}
+
+		Void Add(Key&& key, Value&& value)
+		{
+			Iterator it;
+
+			if (!container.TryEmplace(it, key, Move(key), Move(value)))
+			{
+
+				it->Value = Move(
+					value
+				);
+			}
+		}
+		Void Add(const Key& key, Value&& value)
+		{
+			Iterator it;
+
+			if (!container.TryEmplace(it, key, key, Move(value)))
+			{
+
+				it->Value = Move(
+					value
+				);
+			}
+		}
+		Void Add(const Key& key, const Value& value)
+		{
+			Iterator it;
+
+			if (!container.TryEmplace(it, key, key, value))
+			{
+
+				it->Value = value;
+			}
+		}
+
+		Void Remove(const Key& key)
+		{
+			container.Remove(
+				key
+			);
+		}
+
+		template<typename T_ITERATOR>
+		Void Erase(T_ITERATOR it)
+		{
+			container.Erase(
+				it
+			);
+		}
+		template<typename T_ITERATOR>
+		Void Erase(T_ITERATOR first, T_ITERATOR last)
+		{
+			container.Erase(
+				first,
+				last
+			);
+		}
+
+		virtual Iterator      begin() override
+		{
+			return container.begin();
+		}
+		virtual ConstIterator begin() const override
+		{
+			return container.begin();
+		}
+
+		virtual Iterator      end() override
+		{
+			return container.end();
+		}
+		virtual ConstIterator end() const override
+		{
+			return container.end();
+		}
+
+		virtual ConstIterator cbegin() const override
+		{
+			return container.cbegin();
+		}
+
+		virtual ConstIterator cend() const override
+		{
+			return container.cend();
+		}
+
+		virtual ReverseIterator      rbegin() override
+		{
+			return container.rbegin();
+		}
+		virtual ConstReverseIterator rbegin() const override
+		{
+			return container.rbegin();
+		}
+
+		virtual ReverseIterator      rend() override
+		{
+			return container.rend();
+		}
+		virtual ConstReverseIterator rend() const override
+		{
+			return container.rend();
+		}
+
+		virtual ConstReverseIterator crbegin() const override
+		{
+			return container.crbegin();
+		}
+
+		virtual ConstReverseIterator crend() const override
+		{
+			return container.crend();
+		}
+
+		Value&       operator [] (Key&& key)
+		{
+			Iterator it;
+
+			container.TryEmplace(
+				it,
+				key,
+				Move(key),
+				Value()
+			);
+
+			return it->Value;
+		}
+		Value&       operator [] (const Key& key)
+		{
+			Iterator it;
+
+			container.TryEmplace(
+				it,
+				key,
+				key,
+				Value()
+			);
+
+			return it->Value;
+		}
+		const Value& operator [] (const Key& key) const
+		{
+			auto it = Find(
+				key
+			);
+
+			AL_ASSERT(
+				it != end(),
+				"key not found"
+			);
+
+			return it->Value;
+		}
+
+		HashDictionary& operator = (HashDictionary&& dictionary)
+		{
+			container = Move(
+				dictionary.container
+			);
+
+			return *this;
+		}
+		HashDictionary& operator = (const HashDictionary& dictionary)
+		{
+			container = dictionary.container;
+
+			return *this;
+		}
+
+		Bool operator == (const HashDictionary& dictionary) const
+		{
+			if (GetSize() != dictionary.GetSize())
+			{
+
+				return False;
+			}
+
+			for (auto& pair : container)
+			{
+				auto it = dictionary.Find(
+					pair.Key
+				);
+
+				if (it == dictionary.end())
+				{
+
+					return False;
+				}
+
+				if (it->Value != pair.Value)
+				{
+
+					return False;
+				}
+			}
+
+			return True;
+		}
+		Bool operator != (const HashDictionary& dictionary) const
+		{
+			if (operator==(dictionary))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+	};
+}
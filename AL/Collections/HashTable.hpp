@@ -0,0 +1,1056 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "Hash.hpp"
+#include "Iterator.hpp"
+#include "ICollection.hpp"
+
+#include <new> // placement new/align_val_t
+
+namespace AL::Collections
+{
+	// Each slot has a control byte
+	// - 0x00-0x7F: slot is full, value is the low 7 bits of the hash
+	// - EMPTY/DELETED: slot is free
+	// - SENTINEL: bounds of the table (used by iterators)
+	struct HashTableControls
+	{
+		static constexpr uint8 EMPTY    = 0x80;
+		static constexpr uint8 DELETED  = 0xFE;
+		static constexpr uint8 SENTINEL = 0xFF;
+
+		static constexpr Bool IsFull(uint8 control)
+		{
+			return (control & 0x80) == 0;
+		}
+
+		static constexpr Bool IsFree(uint8 control)
+		{
+			return (control == EMPTY) || (control == DELETED);
+		}
+	};
+
+	template<typename T>
+	class HashTableIterator
+		: public BidirectionalIterator<T>
+	{
+	public:
+		typedef typename BidirectionalIterator<T>::pointer           pointer;
+		typedef typename BidirectionalIterator<T>::reference         reference;
+		typedef typename BidirectionalIterator<T>::value_type        value_type;
+		typedef typename BidirectionalIterator<T>::difference_type   difference_type;
+		typedef typename BidirectionalIterator<T>::iterator_category iterator_category;
+
+		const uint8* lpControl;
+		// the value is located from the control so no pointer outside of the values is formed
+		const uint8* lpControls;
+		pointer      lpValues;
+
+		HashTableIterator()
+		{
+		}
+
+		HashTableIterator(const uint8* lpControl, const uint8* lpControls, pointer lpValues)
+			: lpControl(
+				lpControl
+			),
+			lpControls(
+				lpControls
+			),
+			lpValues(
+				lpValues
+			)
+		{
+		}
+
+		virtual ~HashTableIterator()
+		{
+		}
+
+		reference operator * () const
+		{
+			return lpValues[lpControl - lpControls];
+		}
+		pointer   operator -> () const
+		{
+			return &lpValues[lpControl - lpControls];
+		}
+
+		HashTableIterator& operator ++ ()
+		{
+			do
+			{
+				++lpControl;
+			} while (HashTableControls::IsFree(*lpControl));
+
+			return *this;
+		}
+		HashTableIterator& operator -- ()
+		{
+			do
+			{
+				--lpControl;
+			} while (HashTableControls::IsFree(*lpControl));
+
+			return *this;
+		}
+
+		HashTableIterator operator ++ (int)
+		{
+			auto it = *this;
+
+			operator++();
+
+			return it;
+		}
+		HashTableIterator operator -- (int)
+		{
+			auto it = *this;
+
+			operator--();
+
+			return it;
+		}
+
+		Bool operator == (const HashTableIterator& it) const
+		{
+			if (lpControl != it.lpControl)
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+		Bool operator != (const HashTableIterator& it) const
+		{
+			if (operator==(it))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+	};
+
+	template<typename T>
+	class HashTableReverseIterator
+		: public BidirectionalIterator<T>
+	{
+	public:
+		typedef typename BidirectionalIterator<T>::pointer           pointer;
+		typedef typename BidirectionalIterator<T>::reference         reference;
+		typedef typename BidirectionalIterator<T>::value_type        value_type;
+		typedef typename BidirectionalIterator<T>::difference_type   difference_type;
+		typedef typename BidirectionalIterator<T>::iterator_category iterator_category;
+
+		const uint8* lpControl;
+		// the value is located from the control so no pointer outside of the values is formed
+		const uint8* lpControls;
+		pointer      lpValues;
+
+		HashTableReverseIterator()
+		{
+		}
+
+		HashTableReverseIterator(const uint8* lpControl, const uint8* lpControls, pointer lpValues)
+			: lpControl(
+				lpControl
+			),
+			lpControls(
+				lpControls
+			),
+			lpValues(
+				lpValues
+			)
+		{
+		}
+
+		virtual ~HashTableReverseIterator()
+		{
+		}
+
+		reference operator * () const
+		{
+			return lpValues[lpControl - lpControls];
+		}
+		pointer   operator -> () const
+		{
+			return &lpValues[lpControl - lpControls];
+		}
+
+		HashTableReverseIterator& operator ++ ()
+		{
+			do
+			{
+				--lpControl;
+			} while (HashTableControls::IsFree(*lpControl));
+
+			return *this;
+		}
+		HashTableReverseIterator& operator -- ()
+		{
+			do
+			{
+				++lpControl;
+			} while (HashTableControls::IsFree(*lpControl));
+
+			return *this;
+		}
+
+		HashTableReverseIterator operator ++ (int)
+		{
+			auto it = *this;
+
+			operator++();
+
+			return it;
+		}
+		HashTableReverseIterator operator -- (int)
+		{
+			auto it = *this;
+
+			operator--();
+
+			return it;
+		}
+
+		Bool operator == (const HashTableReverseIterator& it) const
+		{
+			if (lpControl != it.lpControl)
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+		Bool operator != (const HashTableReverseIterator& it) const
+		{
+			if (operator==(it))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+	};
+
+	// Open addressing with linear probing and SwissTable style control bytes
+	// - T is stored in place, T_KEY is either T or T::Key
+	// - Erase leaves a tombstone so iterators to other values remain valid
+	template<typename T, typename T_KEY = T, typename T_HASH = Hash<T_KEY>>
+	class HashTable
+		: public IBidirectionalCollection<T, HashTableIterator, HashTableReverseIterator>
+	{
+		static constexpr size_t MINIMUM_CAPACITY = 8;
+
+		static constexpr size_t NPOS             = Integer<size_t>::Maximum;
+
+		// lpControls[-1] and lpControls[capacity] are SENTINEL
+		uint8* lpControls = nullptr;
+		T*     lpValues   = nullptr;
+		size_t capacity   = 0;
+		size_t size       = 0;
+		size_t deleted    = 0;
+		T_HASH hash;
+
+	public:
+		typedef typename IBidirectionalCollection<T, HashTableIterator, HashTableReverseIterator>::Type                 Type;
+
+		typedef T_KEY                                                                                                  Key;
+		typedef T_HASH                                                                                                 Hasher;
+
+		typedef typename IBidirectionalCollection<T, HashTableIterator, HashTableReverseIterator>::Collection           Collection;
+
+		typedef typename IBidirectionalCollection<T, HashTableIterator, HashTableReverseIterator>::Iterator             Iterator;
+		typedef typename IBidirectionalCollection<T, HashTableIterator, HashTableReverseIterator>::ConstIterator        ConstIterator;
+
+		typedef typename IBidirectionalCollection<T, HashTableIterator, HashTableReverseIterator>::ReverseIterator      ReverseIterator;
+		typedef typename IBidirectionalCollection<T, HashTableIterator, HashTableReverseIterator>::ConstReverseIterator ConstReverseIterator;
+
+		static const Key& GetKey(const Type& value)
+		{
+			if constexpr (Is_Type<Type, Key>::Value)
+			{
+
+				return value;
+			}
+			else
+			{
+
+				return value.Key;
+			}
+		}
+
+		HashTable()
+		{
+		}
+
+		HashTable(HashTable&& hashTable)
+			: lpControls(
+				hashTable.lpControls
+			),
+			lpValues(
+				hashTable.lpValues
+			),
+			capacity(
+				hashTable.capacity
+			),
+			size(
+				hashTable.size
+			),
+			deleted(
+				hashTable.deleted
+			),
+			hash(
+				Move(hashTable.hash)
+			)
+		{
+			hashTable.lpControls = nullptr;
+			hashTable.lpValues   = nullptr;
+			hashTable.capacity   = 0;
+			hashTable.size       = 0;
+			hashTable.deleted    = 0;
+		}
+		HashTable(const HashTable& hashTable)
+			: hash(
+				hashTable.hash
+			)
+		{
+			CopyFrom(
+				hashTable
+			);
+		}
+
+		explicit HashTable(size_t capacity)
+		{
+			Reserve(
+				capacity
+			);
+		}
+
+		virtual ~HashTable()
+		{
+			Free();
+		}
+
+		virtual size_t GetSize() const override
+		{
+			return size;
+		}
+
+		virtual size_t GetCapacity() const override
+		{
+			return capacity;
+		}
+
+		auto& GetHasher() const
+		{
+			return hash;
+		}
+
+		Iterator      Find(const Key& key)
+		{
+			auto index = FindIndex(
+				key,
+				hash(key)
+			);
+
+			if (index == NPOS)
+			{
+
+				return end();
+			}
+
+			return Iterator(
+				&lpControls[index],
+				lpControls,
+				lpValues
+			);
+		}
+		ConstIterator Find(const Key& key) const
+		{
+			auto index = FindIndex(
+				key,
+				hash(key)
+			);
+
+			if (index == NPOS)
+			{
+
+				return cend();
+			}
+
+			return ConstIterator(
+				&lpControls[index],
+				lpControls,
+				lpValues
+			);
+		}
+
+		Bool Contains(const Key& key) const
+		{
+			if (FindIndex(key, hash(key)) == NPOS)
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+
+		Void Clear()
+		{
+			if (lpControls != nullptr)
+			{
+				Destroy();
+
+				memset(
+					lpControls,
+					HashTableControls::EMPTY,
+					capacity
+				);
+
+				size    = 0;
+				deleted = 0;
+			}
+		}
+
+		// Ensures count values can be stored without rehashing
+		Void Reserve(size_t count)
+		{
+			auto capacity = GetCapacityForCount(
+				count
+			);
+
+			if (capacity > this->capacity)
+			{
+
+				Rehash(
+					capacity
+				);
+			}
+		}
+
+		// Rebuilds the table with at least capacity slots and discards tombstones
+		Void Rehash(size_t capacity)
+		{
+			auto minimum = GetCapacityForCount(
+				GetSize()
+			);
+
+			if (capacity < minimum)
+			{
+
+				capacity = minimum;
+			}
+
+			capacity = GetNextPowerOf2(
+				capacity
+			);
+
+			auto lpOldControls = lpControls;
+			auto lpOldValues   = lpValues;
+			auto oldCapacity   = this->capacity;
+
+			Allocate(
+				capacity
+			);
+
+			if (lpOldControls != nullptr)
+			{
+				for (size_t i = 0; i < oldCapacity; ++i)
+				{
+					if (HashTableControls::IsFull(lpOldControls[i]))
+					{
+						auto lpValue = &lpOldValues[i];
+						auto hash    = this->hash(GetKey(*lpValue));
+
+						auto index = FindFreeIndex(
+							hash
+						);
+
+						new (&lpValues[index]) Type(
+							AL::Move(*lpValue)
+						);
+
+						lpControls[index] = GetH2(
+							hash
+						);
+
+						lpValue->~Type();
+					}
+				}
+
+				Free(
+					lpOldControls,
+					lpOldValues
+				);
+			}
+		}
+
+		Void ShrinkToFit()
+		{
+			if (GetSize() == 0)
+			{
+				Free();
+
+				lpControls = nullptr;
+				lpValues   = nullptr;
+				capacity   = 0;
+				deleted    = 0;
+			}
+			else
+			{
+				Rehash(
+					0
+				);
+			}
+		}
+
+		// Constructs a value with args if key was not found
+		// @return False if key already exists
+		template<typename ... TArgs>
+		Bool TryEmplace(Iterator& it, const Key& key, TArgs&& ... args)
+		{
+			auto hash  = this->hash(key);
+			auto index = FindIndex(key, hash);
+
+			if (index != NPOS)
+			{
+				it = Iterator(
+					&lpControls[index],
+					lpControls,
+					lpValues
+				);
+
+				return False;
+			}
+
+			if ((lpControls == nullptr) || ((GetSize() + deleted + 1) > GetMaximumLoad(capacity)))
+			{
+				// key and args may reference values of this table, construct before they move
+				Type value(
+					Forward<TArgs>(args) ...
+				);
+
+				// rehash in place when most of the load is tombstones
+				Rehash(
+					((GetSize() + 1) > (GetMaximumLoad(capacity) / 2)) ? (capacity * 2) : capacity
+				);
+
+				EmplaceIndex(
+					it,
+					hash,
+					AL::Move(value)
+				);
+
+				return True;
+			}
+
+			EmplaceIndex(
+				it,
+				hash,
+				Forward<TArgs>(args) ...
+			);
+
+			return True;
+		}
+
+		// Inserts value or replaces the existing value with the same key
+		Iterator Add(Type&& value)
+		{
+			Iterator it;
+
+			if (!TryEmplace(it, GetKey(value), AL::Move(value)))
+			{
+
+				*it = AL::Move(
+					value
+				);
+			}
+
+			return it;
+		}
+		Iterator Add(const Type& value)
+		{
+			Iterator it;
+
+			if (!TryEmplace(it, GetKey(value), value))
+			{
+
+				*it = value;
+			}
+
+			return it;
+		}
+
+		Bool Remove(const Key& key)
+		{
+			auto index = FindIndex(
+				key,
+				hash(key)
+			);
+
+			if (index == NPOS)
+			{
+
+				return False;
+			}
+
+			EraseIndex(
+				index
+			);
+
+			return True;
+		}
+
+		template<typename T_ITERATOR>
+		Void Erase(T_ITERATOR it)
+		{
+			EraseIndex(
+				static_cast<size_t>(it.lpControl - lpControls)
+			);
+		}
+		template<typename T_ITERATOR>
+		Void Erase(T_ITERATOR first, T_ITERATOR last)
+		{
+			while (first != last)
+			{
+				Erase(
+					first++
+				);
+			}
+		}
+
+		virtual Iterator      begin() override
+		{
+			if (lpControls == nullptr)
+			{
+
+				return Iterator(nullptr, nullptr, nullptr);
+			}
+
+			Iterator it(
+				&lpControls[0],
+				lpControls,
+				lpValues
+			);
+
+			if (HashTableControls::IsFree(lpControls[0]))
+			{
+
+				++it;
+			}
+
+			return it;
+		}
+		virtual ConstIterator begin() const override
+		{
+			return cbegin();
+		}
+
+		virtual Iterator      end() override
+		{
+			if (lpControls == nullptr)
+			{
+
+				return Iterator(nullptr, nullptr, nullptr);
+			}
+
+			return Iterator(
+				&lpControls[capacity],
+				lpControls,
+				lpValues
+			);
+		}
+		virtual ConstIterator end() const override
+		{
+			return cend();
+		}
+
+		virtual ConstIterator cbegin() const override
+		{
+			if (lpControls == nullptr)
+			{
+
+				return ConstIterator(nullptr, nullptr, nullptr);
+			}
+
+			ConstIterator it(
+				&lpControls[0],
+				lpControls,
+				lpValues
+			);
+
+			if (HashTableControls::IsFree(lpControls[0]))
+			{
+
+				++it;
+			}
+
+			return it;
+		}
+
+		virtual ConstIterator cend() const override
+		{
+			if (lpControls == nullptr)
+			{
+
+				return ConstIterator(nullptr, nullptr, nullptr);
+			}
+
+			return ConstIterator(
+				&lpControls[capacity],
+				lpControls,
+				lpValues
+			);
+		}
+
+		virtual ReverseIterator      rbegin() override
+		{
+			if (lpControls == nullptr)
+			{
+
+				return ReverseIterator(nullptr, nullptr, nullptr);
+			}
+
+			return ++ReverseIterator(
+				&lpControls[capacity],
+				lpControls,
+				lpValues
+			);
+		}
+		virtual ConstReverseIterator rbegin() const override
+		{
+			return crbegin();
+		}
+
+		virtual ReverseIterator      rend() override
+		{
+			if (lpControls == nullptr)
+			{
+
+				return ReverseIterator(nullptr, nullptr, nullptr);
+			}
+
+			return ReverseIterator(
+				&lpControls[-1],
+				lpControls,
+				lpValues
+			);
+		}
+		virtual ConstReverseIterator rend() const override
+		{
+			return crend();
+		}
+
+		virtual ConstReverseIterator crbegin() const override
+		{
+			if (lpControls == nullptr)
+			{
+
+				return ConstReverseIterator(nullptr, nullptr, nullptr);
+			}
+
+			return ++ConstReverseIterator(
+				&lpControls[capacity],
+				lpControls,
+				lpValues
+			);
+		}
+
+		virtual ConstReverseIterator crend() const override
+		{
+			if (lpControls == nullptr)
+			{
+
+				return ConstReverseIterator(nullptr, nullptr, nullptr);
+			}
+
+			return ConstReverseIterator(
+				&lpControls[-1],
+				lpControls,
+				lpValues
+			);
+		}
+
+		HashTable& operator = (HashTable&& hashTable)
+		{
+			if (this != &hashTable)
+			{
+				Free();
+
+				lpControls = hashTable.lpControls;
+				hashTable.lpControls = nullptr;
+
+				lpValues = hashTable.lpValues;
+				hashTable.lpValues = nullptr;
+
+				capacity = hashTable.capacity;
+				hashTable.capacity = 0;
+
+				size = hashTable.size;
+				hashTable.size = 0;
+
+				deleted = hashTable.deleted;
+				hashTable.deleted = 0;
+
+				hash = Move(
+					hashTable.hash
+				);
+			}
+
+			return *this;
+		}
+		HashTable& operator = (const HashTable& hashTable)
+		{
+			if (this != &hashTable)
+			{
+				Free();
+
+				lpControls = nullptr;
+				lpValues   = nullptr;
+				capacity   = 0;
+				size       = 0;
+				deleted    = 0;
+				hash       = hashTable.hash;
+
+				CopyFrom(
+					hashTable
+				);
+			}
+
+			return *this;
+		}
+
+	private:
+		static constexpr uint8 GetH2(size_t hash)
+		{
+			return static_cast<uint8>(
+				hash & 0x7F
+			);
+		}
+
+		static constexpr size_t GetH1(size_t hash)
+		{
+			return hash >> 7;
+		}
+
+		// 7/8 max load factor
+		static constexpr size_t GetMaximumLoad(size_t capacity)
+		{
+			return capacity - (capacity / 8);
+		}
+
+		static constexpr size_t GetNextPowerOf2(size_t value)
+		{
+			size_t capacity = MINIMUM_CAPACITY;
+
+			while (capacity < value)
+			{
+				capacity <<= 1;
+			}
+
+			return capacity;
+		}
+
+		static constexpr size_t GetCapacityForCount(size_t count)
+		{
+			if (count == 0)
+			{
+
+				return 0;
+			}
+
+			return GetNextPowerOf2(
+				count + (count / 7) + 1
+			);
+		}
+
+		size_t FindIndex(const Key& key, size_t hash) const
+		{
+			if (lpControls != nullptr)
+			{
+				auto mask = capacity - 1;
+				auto h2   = GetH2(hash);
+
+				for (auto index = GetH1(hash) & mask; ; index = (index + 1) & mask)
+				{
+					auto control = lpControls[index];
+
+					if ((control == h2) && (GetKey(lpValues[index]) == key))
+					{
+
+						return index;
+					}
+
+					if (control == HashTableControls::EMPTY)
+					{
+
+						break;
+					}
+				}
+			}
+
+			return NPOS;
+		}
+
+		// Table must have at least one free slot
+		size_t FindFreeIndex(size_t hash) const
+		{
+			auto mask  = capacity - 1;
+			auto index = GetH1(hash) & mask;
+
+			while (!HashTableControls::IsFree(lpControls[index]))
+			{
+				index = (index + 1) & mask;
+			}
+
+			return index;
+		}
+
+		// Table must have at least one free slot
+		template<typename ... TArgs>
+		Void EmplaceIndex(Iterator& it, size_t hash, TArgs&& ... args)
+		{
+			auto index = FindFreeIndex(
+				hash
+			);
+
+			new (&lpValues[index]) Type(
+				Forward<TArgs>(args) ...
+			);
+
+			if (lpControls[index] == HashTableControls::DELETED)
+			{
+
+				--deleted;
+			}
+
+			lpControls[index] = GetH2(
+				hash
+			);
+
+			++size;
+
+			it = Iterator(
+				&lpControls[index],
+				lpControls,
+				lpValues
+			);
+		}
+
+		Void EraseIndex(size_t index)
+		{
+			lpValues[index].~Type();
+
+			// a probe sequence can't continue past an EMPTY slot so this slot can become EMPTY too
+			if (lpControls[(index + 1) & (capacity - 1)] == HashTableControls::EMPTY)
+			{
+
+				lpControls[index] = HashTableControls::EMPTY;
+			}
+			else
+			{
+				lpControls[index] = HashTableControls::DELETED;
+
+				++deleted;
+			}
+
+			--size;
+		}
+
+		Void Allocate(size_t capacity)
+		{
+			auto lpControls = new uint8[capacity + 2];
+
+			lpControls[0]            = HashTableControls::SENTINEL;
+			lpControls[capacity + 1] = HashTableControls::SENTINEL;
+
+			memset(
+				&lpControls[1],
+				HashTableControls::EMPTY,
+				capacity
+			);
+
+			this->lpControls = &lpControls[1];
+			this->lpValues   = static_cast<T*>(
+				::operator new(capacity * sizeof(T), ::std::align_val_t(alignof(T)))
+			);
+			this->capacity   = capacity;
+			this->deleted    = 0;
+		}
+
+		Void CopyFrom(const HashTable& hashTable)
+		{
+			if (hashTable.lpControls != nullptr)
+			{
+				Allocate(
+					hashTable.capacity
+				);
+
+				memcpy(
+					lpControls,
+					hashTable.lpControls,
+					capacity
+				);
+
+				for (size_t i = 0; i < capacity; ++i)
+				{
+					if (HashTableControls::IsFull(lpControls[i]))
+					{
+
+						new (&lpValues[i]) Type(
+							hashTable.lpValues[i]
+						);
+					}
+				}
+
+				size    = hashTable.size;
+				deleted = hashTable.deleted;
+			}
+		}
+
+		Void Destroy()
+		{
+			if constexpr (!::std::is_trivially_destructible<T>::value)
+			{
+				for (size_t i = 0; i < capacity; ++i)
+				{
+					if (HashTableControls::IsFull(lpControls[i]))
+					{
+
+						lpValues[i].~Type();
+					}
+				}
+			}
+		}
+
+		Void Free()
+		{
+			if (lpControls != nullptr)
+			{
+				Destroy();
+
+				Free(
+					lpControls,
+					lpValues
+				);
+			}
+		}
+
+		static Void Free(uint8* lpControls, T* lpValues)
+		{
+			delete[] &lpControls[-1];
+
+			::operator delete(
+				lpValues,
+				::std::align_val_t(alignof(T))
+			);
+		}
+	};
+}
@@ -3,28 +3,35 @@
 
 #include "Iterator.hpp"
 #include "ICollection.hpp"
+#include "NodeAllocator.hpp"
 
 namespace AL::Collections
 {
 	template<typename T>
-	struct LinkedListNode
+	struct LinkedListNode;
+
+	// Links shared by every node and the sentinel embedded in LinkedList
+	// - Only links known to belong to a LinkedListNode may be cast to one
+	template<typename T>
+	struct LinkedListNodeLinks
 	{
-		T               Value;
+		LinkedListNodeLinks* lpNext     = nullptr;
+		LinkedListNodeLinks* lpPrevious = nullptr;
+	};
 
-		LinkedListNode* lpNext     = nullptr;
-		LinkedListNode* lpPrevious = nullptr;
+	template<typename T>
+	struct LinkedListNode
+		: public LinkedListNodeLinks<T>
+	{
+		T Value;
 
 		template<typename ... TArgs>
-		explicit LinkedListNode(TArgs ... args)
+		explicit LinkedListNode(TArgs&& ... args)
 			: Value(
 				Forward<TArgs>(args) ...
 			)
 		{
 		}
-
-		virtual ~LinkedListNode()
-		{
-		}
 	};
 
 	template<typename T>
@@ -40,11 +47,25 @@ namespace AL::Collections
 		typedef const T Type;
 	};
 
+	template<typename T>
+	struct Get_LinkedListNode_Links_Type;
+	template<typename T>
+	struct Get_LinkedListNode_Links_Type<LinkedListNode<T>>
+	{
+		typedef LinkedListNodeLinks<T> Type;
+	};
+	template<typename T>
+	struct Get_LinkedListNode_Links_Type<const LinkedListNode<T>>
+	{
+		typedef const LinkedListNodeLinks<T> Type;
+	};
+
 	template<typename T>
 	class LinkedListIterator
 		: public BidirectionalIterator<T>
 	{
 		typedef typename Get_LinkedListNode_Value_Type<T>::Type _Node_Type;
+		typedef typename Get_LinkedListNode_Links_Type<T>::Type _Node_Links;
 
 	public:
 		typedef typename BidirectionalIterator<_Node_Type>::pointer           pointer;
@@ -53,13 +74,14 @@ namespace AL::Collections
 		typedef typename BidirectionalIterator<_Node_Type>::difference_type   difference_type;
 		typedef typename BidirectionalIterator<_Node_Type>::iterator_category iterator_category;
 
-		T* lpNode;
+		// the sentinel when this is end()
+		_Node_Links* lpNode;
 
 		LinkedListIterator()
 		{
 		}
 
-		LinkedListIterator(T* lpNode)
+		LinkedListIterator(_Node_Links* lpNode)
 			: lpNode(
 				lpNode
 			)
@@ -72,11 +94,11 @@ namespace AL::Collections
 
 		reference operator * () const
 		{
-			return lpNode->Value;
+			return static_cast<T*>(lpNode)->Value;
 		}
 		pointer   operator -> () const
 		{
-			return &lpNode->Value;
+			return &static_cast<T*>(lpNode)->Value;
 		}
 
 		LinkedListIterator& operator ++ ()
@@ -136,6 +158,7 @@ namespace AL::Collections
 		: public BidirectionalIterator<T>
 	{
 		typedef typename Get_LinkedListNode_Value_Type<T>::Type _Node_Type;
+		typedef typename Get_LinkedListNode_Links_Type<T>::Type _Node_Links;
 
 	public:
 		typedef typename BidirectionalIterator<_Node_Type>::pointer           pointer;
@@ -144,13 +167,14 @@ namespace AL::Collections
 		typedef typename BidirectionalIterator<_Node_Type>::difference_type   difference_type;
 		typedef typename BidirectionalIterator<_Node_Type>::iterator_category iterator_category;
 
-		T* lpNode;
+		// the sentinel when this is end()
+		_Node_Links* lpNode;
 
 		LinkedListReverseIterator()
 		{
 		}
 
-		LinkedListReverseIterator(T* lpNode)
+		LinkedListReverseIterator(_Node_Links* lpNode)
 			: lpNode(
 				lpNode
 			)
@@ -163,11 +187,11 @@ namespace AL::Collections
 
 		reference operator * () const
 		{
-			return lpNode->Value;
+			return static_cast<T*>(lpNode)->Value;
 		}
 		pointer   operator -> () const
 		{
-			return &lpNode->Value;
+			return &static_cast<T*>(lpNode)->Value;
 		}
 
 		LinkedListReverseIterator& operator ++ ()
@@ -222,13 +246,17 @@ namespace AL::Collections
 		}
 	};
 
-	template<typename T>
+	// T_ALLOCATOR creates and destroys nodes (see NodeAllocator.hpp)
+	// - The sentinel is embedded so an empty list never allocates
+	template<typename T, typename T_ALLOCATOR = NodeDefaultAllocator>
 	class LinkedList
 		: public IBidirectionalCollection<LinkedListNode<T>, LinkedListIterator, LinkedListReverseIterator>
 	{
-		LinkedListNode<T>* lpLast;
-		LinkedListNode<T>* lpFirst;
-		size_t             size = 0;
+		LinkedListNodeLinks<T> sentinel;
+		size_t                 size = 0;
+
+		[[no_unique_address]]
+		T_ALLOCATOR            allocator;
 
 	public:
 		typedef typename IBidirectionalCollection<T, LinkedListIterator, LinkedListReverseIterator>::Type                                 Type;
@@ -242,31 +270,19 @@ namespace AL::Collections
 		typedef typename IBidirectionalCollection<LinkedListNode<T>, LinkedListIterator, LinkedListReverseIterator>::ConstReverseIterator ConstReverseIterator;
 
 		LinkedList()
-			: lpLast(
-				new LinkedListNode<T>()
-			),
-			lpFirst(
-				new LinkedListNode<T>()
-			)
 		{
-			lpLast->lpPrevious = lpFirst;
-			lpFirst->lpNext    = lpLast;
+			sentinel.lpNext     = GetSentinel();
+			sentinel.lpPrevious = GetSentinel();
 		}
 
 		LinkedList(LinkedList&& linkedList)
-			: lpLast(
-				linkedList.lpLast
-			),
-			lpFirst(
-				linkedList.lpFirst
-			),
-			size(
-				linkedList.size
+			: allocator(
+				Move(linkedList.allocator)
 			)
 		{
-			linkedList.lpLast  = nullptr;
-			linkedList.lpFirst = nullptr;
-			linkedList.size    = 0;
+			Take(
+				linkedList
+			);
 		}
 		LinkedList(const LinkedList& linkedList)
 			: LinkedList()
@@ -300,17 +316,7 @@ namespace AL::Collections
 
 		virtual ~LinkedList()
 		{
-			if ((lpFirst != nullptr) && (lpLast != nullptr))
-			{
-				for (auto lpNode = lpFirst; lpNode != nullptr; )
-				{
-					auto lpNext = lpNode->lpNext;
-
-					delete lpNode;
-
-					lpNode = lpNext;
-				}
-			}
+			Clear();
 		}
 
 		virtual size_t GetSize() const override
@@ -379,9 +385,9 @@ namespace AL::Collections
 
 		Bool Contains(const Type& value) const
 		{
-			for (auto lpNode = lpFirst->lpNext; lpNode != lpLast; lpNode = lpNode->lpNext)
+			for (auto lpNode = sentinel.lpNext; lpNode != GetSentinel(); lpNode = lpNode->lpNext)
 			{
-				if (lpNode->Value == value)
+				if (GetNode(lpNode)->Value == value)
 				{
 
 					return True;
@@ -393,18 +399,20 @@ namespace AL::Collections
 
 		Void Clear()
 		{
-			for (auto lpNode = lpFirst->lpNext; lpNode != lpLast; )
+			for (auto lpNode = sentinel.lpNext; lpNode != GetSentinel(); )
 			{
 				auto lpNext = lpNode->lpNext;
 
-				delete lpNode;
+				allocator.Destroy(
+					GetNode(lpNode)
+				);
 
 				lpNode = lpNext;
 			}
 
-			size               = 0;
-			lpLast->lpPrevious = lpFirst;
-			lpFirst->lpNext    = lpLast;
+			size                = 0;
+			sentinel.lpNext     = GetSentinel();
+			sentinel.lpPrevious = GetSentinel();
 		}
 
 		Void PopBack()
@@ -452,20 +460,16 @@ namespace AL::Collections
 		}
 
 		template<typename T_ITERATOR, typename ... TArgs>
-		Void Emplace(T_ITERATOR it, TArgs ... args)
+		Void Emplace(T_ITERATOR it, TArgs&& ... args)
 		{
-			Type value(
-				Forward<TArgs>(args) ...
-			);
-
-			Insert(
+			InsertNode(
 				it,
-				Move(value)
+				Forward<TArgs>(args) ...
 			);
 		}
 
 		template<typename ... TArgs>
-		Void EmplaceBack(TArgs ... args)
+		Void EmplaceBack(TArgs&& ... args)
 		{
 			Emplace(
 				end(),
@@ -474,7 +478,7 @@ namespace AL::Collections
 		}
 
 		template<typename ... TArgs>
-		Void EmplaceFront(TArgs ... args)
+		Void EmplaceFront(TArgs&& ... args)
 		{
 			Emplace(
 				begin(),
@@ -485,11 +489,13 @@ namespace AL::Collections
 		template<typename T_ITERATOR>
 		Void Erase(T_ITERATOR it)
 		{
-			auto lpNode     = it.lpNode;
+			auto lpNode     = GetNode(it.lpNode);
 			auto lpNextNode = lpNode->lpNext;
 			auto lpPrevNode = lpNode->lpPrevious;
 
-			delete lpNode;
+			allocator.Destroy(
+				lpNode
+			);
 
 			lpPrevNode->lpNext     = lpNextNode;
 			lpNextNode->lpPrevious = lpPrevNode;
@@ -517,44 +523,18 @@ namespace AL::Collections
 		template<typename T_ITERATOR>
 		T_ITERATOR Insert(T_ITERATOR it, Type&& value)
 		{
-			auto lpNextNode = it.lpNode;
-			auto lpPrevNode = it.lpNode->lpPrevious;
-
-			auto lpNewNode = new LinkedListNode<T>(
+			return InsertNode(
+				it,
 				Move(value)
 			);
-
-			lpNewNode->lpNext      = lpNextNode;
-			lpNextNode->lpPrevious = lpNewNode;
-			lpNewNode->lpPrevious  = lpPrevNode;
-			lpPrevNode->lpNext     = lpNewNode;
-
-			++size;
-
-			return T_ITERATOR(
-				lpNewNode
-			);
 		}
 		template<typename T_ITERATOR>
 		T_ITERATOR Insert(T_ITERATOR it, const Type& value)
 		{
-			auto lpNextNode = it.lpNode;
-			auto lpPrevNode = it.lpNode->lpPrevious;
-
-			auto lpNewNode = new LinkedListNode<T>(
+			return InsertNode(
+				it,
 				value
 			);
-
-			lpNewNode->lpNext = lpNextNode;
-			lpNextNode->lpPrevious = lpNewNode;
-			lpNewNode->lpPrevious = lpPrevNode;
-			lpPrevNode->lpNext = lpNewNode;
-
-			++size;
-
-			return T_ITERATOR(
-				lpNewNode
-			);
 		}
 		template<typename T_ITERATOR>
 		T_ITERATOR Insert(T_ITERATOR it, const Type* lpValues, size_t count);
@@ -562,121 +542,110 @@ namespace AL::Collections
 		virtual Iterator      begin() override
 		{
 			return Iterator(
-				(lpFirst != nullptr) ? lpFirst->lpNext : nullptr
+				sentinel.lpNext
 			);
 		}
 		virtual ConstIterator begin() const override
 		{
 			return ConstIterator(
-				(lpFirst != nullptr) ? lpFirst->lpNext : nullptr
+				sentinel.lpNext
 			);
 		}
 
 		virtual Iterator      end() override
 		{
 			return Iterator(
-				(lpFirst != nullptr) ? lpLast : nullptr
+				GetSentinel()
 			);
 		}
 		virtual ConstIterator end() const override
 		{
 			return ConstIterator(
-				(lpFirst != nullptr) ? lpLast : nullptr
+				GetSentinel()
 			);
 		}
 
 		virtual ConstIterator cbegin() const override
 		{
 			return ConstIterator(
-				(lpFirst != nullptr) ? lpFirst->lpNext : nullptr
+				sentinel.lpNext
 			);
 		}
 
 		virtual ConstIterator cend() const override
 		{
 			return ConstIterator(
-				(lpFirst != nullptr) ? lpLast : nullptr
+				GetSentinel()
 			);
 		}
 
 		virtual ReverseIterator      rbegin() override
 		{
 			return ReverseIterator(
-				(lpFirst != nullptr) ? lpLast->lpPrevious : nullptr
+				sentinel.lpPrevious
 			);
 		}
 		virtual ConstReverseIterator rbegin() const override
 		{
 			return ConstReverseIterator(
-				(lpFirst != nullptr) ? lpLast->lpPrevious : nullptr
+				sentinel.lpPrevious
 			);
 		}
 
 		virtual ReverseIterator      rend() override
 		{
 			return ReverseIterator(
-				(lpFirst != nullptr) ? lpFirst : nullptr
+				GetSentinel()
 			);
 		}
 		virtual ConstReverseIterator rend() const override
 		{
 			return ConstReverseIterator(
-				(lpFirst != nullptr) ? lpFirst : nullptr
+				GetSentinel()
 			);
 		}
 
 		virtual ConstReverseIterator crbegin() const override
 		{
 			return ConstReverseIterator(
-				(lpFirst != nullptr) ? lpLast->lpPrevious : nullptr
+				sentinel.lpPrevious
 			);
 		}
 
 		virtual ConstReverseIterator crend() const override
 		{
 			return ConstReverseIterator(
-				(lpFirst != nullptr) ? lpFirst : nullptr
+				GetSentinel()
 			);
 		}
 
 		LinkedList& operator = (LinkedList&& linkedList)
 		{
-			if ((lpFirst != nullptr) && (lpLast != nullptr))
+			if (&linkedList != this)
 			{
-				for (auto lpNode = lpFirst; lpNode != nullptr; )
-				{
-					auto lpNext = lpNode->lpNext;
+				Clear();
 
-					delete lpNode;
+				allocator = Move(
+					linkedList.allocator
+				);
 
-					lpNode = lpNext;
-				}
+				Take(
+					linkedList
+				);
 			}
 
-			lpFirst = linkedList.lpFirst;
-			linkedList.lpFirst = nullptr;
-
-			lpLast = linkedList.lpLast;
-			linkedList.lpLast = nullptr;
-
-			size = linkedList.size;
-			linkedList.size = 0;
-
 			return *this;
 		}
 		LinkedList& operator = (const LinkedList& linkedList)
 		{
-			Clear();
-
-			if ((lpFirst == nullptr) && (lpLast == nullptr))
+			if (&linkedList == this)
 			{
-				lpFirst = new LinkedListNode<T>();
-				lpLast  = new LinkedListNode<T>();
 
-				lpFirst->lpNext = lpLast;
-				lpLast->lpPrevious = lpFirst;
+				return *this;
 			}
 
+			Clear();
+
 			for (auto& value : linkedList)
 			{
 				PushBack(
@@ -716,5 +685,64 @@ namespace AL::Collections
 
 			return True;
 		}
+
+	private:
+		LinkedListNodeLinks<T>* GetSentinel() const
+		{
+			return const_cast<LinkedListNodeLinks<T>*>(
+				&sentinel
+			);
+		}
+
+		// lpLinks must not be the sentinel
+		static LinkedListNode<T>* GetNode(const LinkedListNodeLinks<T>* lpLinks)
+		{
+			return static_cast<LinkedListNode<T>*>(
+				const_cast<LinkedListNodeLinks<T>*>(lpLinks)
+			);
+		}
+
+		template<typename T_ITERATOR, typename ... TArgs>
+		T_ITERATOR InsertNode(T_ITERATOR it, TArgs&& ... args)
+		{
+			auto lpNextNode = const_cast<LinkedListNodeLinks<T>*>(it.lpNode);
+			auto lpPrevNode = lpNextNode->lpPrevious;
+
+			auto lpNewNode = allocator.template Create<LinkedListNode<T>>(
+				Forward<TArgs>(args) ...
+			);
+
+			lpNewNode->lpNext      = lpNextNode;
+			lpNextNode->lpPrevious = lpNewNode;
+			lpNewNode->lpPrevious  = lpPrevNode;
+			lpPrevNode->lpNext     = lpNewNode;
+
+			++size;
+
+			return T_ITERATOR(
+				lpNewNode
+			);
+		}
+
+		// Moves the nodes of linkedList to this (empty) list and leaves linkedList empty
+		Void Take(LinkedList& linkedList)
+		{
+			if ((size = linkedList.size) == 0)
+			{
+				sentinel.lpNext     = GetSentinel();
+				sentinel.lpPrevious = GetSentinel();
+			}
+			else
+			{
+				sentinel.lpNext             = linkedList.sentinel.lpNext;
+				sentinel.lpPrevious         = linkedList.sentinel.lpPrevious;
+				sentinel.lpNext->lpPrevious = GetSentinel();
+				sentinel.lpPrevious->lpNext = GetSentinel();
+			}
+
+			linkedList.size                = 0;
+			linkedList.sentinel.lpNext     = linkedList.GetSentinel();
+			linkedList.sentinel.lpPrevious = linkedList.GetSentinel();
+		}
 	};
 }
@@ -0,0 +1,479 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "IQueue.hpp"
+
+#include <new> // placement new
+#include <atomic>
+
+namespace AL::Collections
+{
+	// Bounded lock-free multi producer/multi consumer queue
+	// - Based on Dmitry Vyukov's bounded MPMC queue
+	// - Storage is allocated once by the constructor
+	// - Blocking Enqueue/Dequeue wait on an atomic (futex on Linux) instead of spinning
+	template<typename T>
+	class MPMCQueue
+		: public IQueue<T>
+	{
+		static constexpr size_t CACHE_LINE_SIZE = 64;
+
+		struct Cell
+		{
+			::std::atomic<size_t> Sequence;
+
+			alignas(T) uint8      Value[sizeof(T)];
+
+			T& GetValue()
+			{
+				return *reinterpret_cast<T*>(
+					&Value[0]
+				);
+			}
+		};
+
+		Cell*                                         lpCells;
+		size_t                                        mask;
+
+		// each index is written by a different set of threads
+		alignas(CACHE_LINE_SIZE) ::std::atomic<size_t> enqueuePosition;
+		alignas(CACHE_LINE_SIZE) ::std::atomic<size_t> dequeuePosition;
+
+		alignas(CACHE_LINE_SIZE) ::std::atomic<uint32> notEmptySignal;
+		::std::atomic<uint32>                         notEmptyWaiterCount;
+
+		alignas(CACHE_LINE_SIZE) ::std::atomic<uint32> notFullSignal;
+		::std::atomic<uint32>                         notFullWaiterCount;
+
+		MPMCQueue(MPMCQueue&&) = delete;
+		MPMCQueue(const MPMCQueue&) = delete;
+
+	public:
+		typedef typename IQueue<T>::Type Type;
+
+		// capacity is rounded up to a power of 2
+		explicit MPMCQueue(size_t capacity)
+			: lpCells(
+				new Cell[GetCellCount(capacity)]
+			),
+			mask(
+				GetCellCount(capacity) - 1
+			),
+			enqueuePosition(
+				0
+			),
+			dequeuePosition(
+				0
+			),
+			notEmptySignal(
+				0
+			),
+			notEmptyWaiterCount(
+				0
+			),
+			notFullSignal(
+				0
+			),
+			notFullWaiterCount(
+				0
+			)
+		{
+			for (size_t i = 0; i <= mask; ++i)
+			{
+				lpCells[i].Sequence.store(
+					i,
+					::std::memory_order_relaxed
+				);
+			}
+		}
+
+		virtual ~MPMCQueue()
+		{
+			Clear();
+
+			delete[] lpCells;
+		}
+
+		// Approximate while other threads are using the queue
+		virtual size_t GetSize() const override
+		{
+			auto dequeuePosition = this->dequeuePosition.load(
+				::std::memory_order_relaxed
+			);
+
+			auto enqueuePosition = this->enqueuePosition.load(
+				::std::memory_order_relaxed
+			);
+
+			return (enqueuePosition > dequeuePosition) ? (enqueuePosition - dequeuePosition) : 0;
+		}
+
+		virtual size_t GetCapacity() const override
+		{
+			return mask + 1;
+		}
+
+		Bool IsEmpty() const
+		{
+			return GetSize() == 0;
+		}
+
+		Void Clear()
+		{
+			Type value;
+
+			while (TryDequeue(value))
+			{
+			}
+		}
+
+		// @return AL::False if full
+		Bool TryEnqueue(Type&& value)
+		{
+			return TryEmplace(
+				Move(value)
+			);
+		}
+		// @return AL::False if full
+		Bool TryEnqueue(const Type& value)
+		{
+			return TryEmplace(
+				value
+			);
+		}
+
+		// @return AL::False if full
+		template<typename ... TArgs>
+		Bool TryEmplace(TArgs&& ... args)
+		{
+			size_t position;
+
+			if (!TryReserve(enqueuePosition, 0, position, 1))
+			{
+
+				return False;
+			}
+
+			auto& cell = lpCells[position & mask];
+
+			new (&cell.Value[0]) Type(
+				Forward<TArgs>(args) ...
+			);
+
+			cell.Sequence.store(
+				position + 1,
+				::std::memory_order_release
+			);
+
+			Signal(
+				notEmptySignal,
+				notEmptyWaiterCount,
+				False
+			);
+
+			return True;
+		}
+
+		// Moves up to count values from lpValues with a single reservation
+		// @return number of values enqueued
+		size_t TryEnqueueBatch(Type* lpValues, size_t count)
+		{
+			size_t position;
+
+			if ((count = TryReserve(enqueuePosition, 0, position, count)) == 0)
+			{
+
+				return 0;
+			}
+
+			for (size_t i = 0; i < count; ++i, ++position)
+			{
+				auto& cell = lpCells[position & mask];
+
+				new (&cell.Value[0]) Type(
+					Move(lpValues[i])
+				);
+
+				cell.Sequence.store(
+					position + 1,
+					::std::memory_order_release
+				);
+			}
+
+			Signal(
+				notEmptySignal,
+				notEmptyWaiterCount,
+				True
+			);
+
+			return count;
+		}
+
+		// @return AL::False if empty
+		Bool TryDequeue(Type& value)
+		{
+			size_t position;
+
+			if (!TryReserve(dequeuePosition, 1, position, 1))
+			{
+
+				return False;
+			}
+
+			Take(
+				position,
+				value
+			);
+
+			Signal(
+				notFullSignal,
+				notFullWaiterCount,
+				False
+			);
+
+			return True;
+		}
+
+		// Moves up to count values into lpValues with a single reservation
+		// @return number of values dequeued
+		size_t TryDequeueBatch(Type* lpValues, size_t count)
+		{
+			size_t position;
+
+			if ((count = TryReserve(dequeuePosition, 1, position, count)) == 0)
+			{
+
+				return 0;
+			}
+
+			for (size_t i = 0; i < count; ++i, ++position)
+			{
+				Take(
+					position,
+					lpValues[i]
+				);
+			}
+
+			Signal(
+				notFullSignal,
+				notFullWaiterCount,
+				True
+			);
+
+			return count;
+		}
+
+		// Blocks while full
+		Void Enqueue(Type&& value)
+		{
+			while (!TryEnqueue(Move(value)))
+			{
+				Wait(
+					notFullSignal,
+					notFullWaiterCount,
+					[this]() { return GetSize() < GetCapacity(); }
+				);
+			}
+		}
+		// Blocks while full
+		Void Enqueue(const Type& value)
+		{
+			while (!TryEnqueue(value))
+			{
+				Wait(
+					notFullSignal,
+					notFullWaiterCount,
+					[this]() { return GetSize() < GetCapacity(); }
+				);
+			}
+		}
+
+		// Blocks until every value has been enqueued
+		Void EnqueueBatch(Type* lpValues, size_t count)
+		{
+			for (size_t enqueued; count != 0; lpValues += enqueued, count -= enqueued)
+			{
+				if ((enqueued = TryEnqueueBatch(lpValues, count)) == 0)
+				{
+
+					Wait(
+						notFullSignal,
+						notFullWaiterCount,
+						[this]() { return GetSize() < GetCapacity(); }
+					);
+				}
+			}
+		}
+
+		// Blocks while empty
+		Void Dequeue(Type& value)
+		{
+			while (!TryDequeue(value))
+			{
+				Wait(
+					notEmptySignal,
+					notEmptyWaiterCount,
+					[this]() { return !IsEmpty(); }
+				);
+			}
+		}
+
+		// Blocks while empty
+		// @return number of values dequeued (at least 1)
+		size_t DequeueBatch(Type* lpValues, size_t count)
+		{
+			size_t dequeued;
+
+			while ((dequeued = TryDequeueBatch(lpValues, count)) == 0)
+			{
+				Wait(
+					notEmptySignal,
+					notEmptyWaiterCount,
+					[this]() { return !IsEmpty(); }
+				);
+			}
+
+			return dequeued;
+		}
+
+	private:
+		static size_t GetCellCount(size_t capacity)
+		{
+			size_t count = 2;
+
+			while (count < capacity)
+			{
+				count <<= 1;
+			}
+
+			return count;
+		}
+
+		// Claims up to count consecutive cells starting at position
+		// - Cell i is claimable when Sequence == i + offset (0 for free cells, 1 for full cells)
+		// @return number of cells claimed
+		size_t TryReserve(::std::atomic<size_t>& index, size_t offset, size_t& position, size_t count)
+		{
+			position = index.load(
+				::std::memory_order_relaxed
+			);
+
+			for (;;)
+			{
+				size_t available = 0;
+
+				for (; available < count; ++available)
+				{
+					auto sequence = lpCells[(position + available) & mask].Sequence.load(
+						::std::memory_order_acquire
+					);
+
+					if (sequence != (position + available + offset))
+					{
+
+						break;
+					}
+				}
+
+				if (available == 0)
+				{
+					auto sequence = lpCells[position & mask].Sequence.load(
+						::std::memory_order_acquire
+					);
+
+					// another thread claimed the cell since position was loaded
+					if (static_cast<ssize_t>(sequence - (position + offset)) > 0)
+					{
+						position = index.load(
+							::std::memory_order_relaxed
+						);
+
+						continue;
+					}
+
+					return 0;
+				}
+
+				if (index.compare_exchange_weak(position, position + available, ::std::memory_order_relaxed))
+				{
+
+					return available;
+				}
+			}
+		}
+
+		Void Take(size_t position, Type& value)
+		{
+			auto& cell = lpCells[position & mask];
+
+			value = Move(
+				cell.GetValue()
+			);
+
+			cell.GetValue().~Type();
+
+			cell.Sequence.store(
+				position + mask + 1,
+				::std::memory_order_release
+			);
+		}
+
+		Void Signal(::std::atomic<uint32>& signal, ::std::atomic<uint32>& waiterCount, Bool wakeAll)
+		{
+			// pairs with the fence in Wait
+			::std::atomic_thread_fence(
+				::std::memory_order_seq_cst
+			);
+
+			if (waiterCount.load(::std::memory_order_relaxed) != 0)
+			{
+				signal.fetch_add(
+					1,
+					::std::memory_order_release
+				);
+
+				if (wakeAll)
+				{
+
+					signal.notify_all();
+				}
+				else
+				{
+
+					signal.notify_one();
+				}
+			}
+		}
+
+		template<typename F>
+		Void Wait(::std::atomic<uint32>& signal, ::std::atomic<uint32>& waiterCount, const F& isReady)
+		{
+			waiterCount.fetch_add(
+				1,
+				::std::memory_order_relaxed
+			);
+
+			auto value = signal.load(
+				::std::memory_order_acquire
+			);
+
+			::std::atomic_thread_fence(
+				::std::memory_order_seq_cst
+			);
+
+			if (!isReady())
+			{
+
+				signal.wait(
+					value,
+					::std::memory_order_acquire
+				);
+			}
+
+			waiterCount.fetch_sub(
+				1,
+				::std::memory_order_relaxed
+			);
+		}
+	};
+}
@@ -3,26 +3,29 @@
 
 #include "IQueue.hpp"
 
+#include <new> // placement new
 #include <atomic>
 
 namespace AL::Collections
 {
-	template<typename T>
+	// Unbounded lock-free multi producer/single consumer queue
+	// - POOL_NODES recycles dequeued nodes instead of deleting them (nodes are kept until the queue is destroyed)
+	// - TRACK_SIZE keeps an exact size counter shared by every producer, without it GetSize walks the queue
+	template<typename T, Bool POOL_NODES = False, Bool TRACK_SIZE = True>
 	class MPSCQueue
 		: public IQueue<T>
 	{
 		struct Node
 		{
-			T                    Value;
-
 			::std::atomic<Node*> Next = nullptr;
 
-			template<typename ... TArgs>
-			explicit Node(TArgs ... args)
-				: Value(
-					Forward<TArgs>(args) ...
-				)
+			alignas(T) uint8     Value[sizeof(T)];
+
+			T& GetValue()
 			{
+				return *reinterpret_cast<T*>(
+					&Value[0]
+				);
 			}
 		};
 
@@ -30,6 +33,10 @@ namespace AL::Collections
 		::std::atomic<Node*>  back;
 		::std::atomic<Node*>  front;
 
+		// pushed by the consumer, popped by one producer at a time
+		::std::atomic<Node*>  freeNodes;
+		::std::atomic<Bool>   isFreeNodesLocked;
+
 	public:
 		typedef typename IQueue<T>::Type Type;
 
@@ -44,30 +51,23 @@ namespace AL::Collections
 				back.load(
 					::std::memory_order_relaxed
 				)
+			),
+			freeNodes(
+				nullptr
+			),
+			isFreeNodesLocked(
+				False
 			)
 		{
 		}
 
+		// queue is left empty with its own sentinel so it remains usable
 		MPSCQueue(MPSCQueue&& queue)
-			: size(
-				queue.size.exchange(
-					0,
-					::std::memory_order_relaxed
-				)
-			),
-			back(
-				queue.back.exchange(
-					nullptr,
-					::std::memory_order_relaxed
-				)
-			),
-			front(
-				queue.front.exchange(
-					nullptr,
-					::std::memory_order_relaxed
-				)
-			)
+			: MPSCQueue()
 		{
+			Swap(
+				queue
+			);
 		}
 		MPSCQueue(const MPSCQueue& queue);
 
@@ -75,21 +75,52 @@ namespace AL::Collections
 		{
 			if (auto lpNode = front.load(::std::memory_order_relaxed))
 			{
-				do
+				// front is the sentinel and never holds a value
+				for (auto lpNext = lpNode->Next.load(::std::memory_order_relaxed); lpNext != nullptr; lpNext = lpNode->Next.load(::std::memory_order_relaxed))
 				{
-					front.store(
-						lpNode->Next,
-						::std::memory_order_relaxed
-					);
-
 					delete lpNode;
-				} while ((lpNode = front.load(::std::memory_order_relaxed)) != nullptr);
+
+					lpNode = lpNext;
+
+					lpNode->GetValue().~Type();
+				}
+
+				delete lpNode;
+			}
+
+			for (auto lpNode = freeNodes.load(::std::memory_order_relaxed); lpNode != nullptr; )
+			{
+				auto lpNext = lpNode->Next.load(
+					::std::memory_order_relaxed
+				);
+
+				delete lpNode;
+
+				lpNode = lpNext;
 			}
 		}
 
+		// Without TRACK_SIZE this may only be called by the consumer
 		virtual size_t GetSize() const override
 		{
-			return this->size;
+			if constexpr (TRACK_SIZE)
+			{
+
+				return size.load(
+					::std::memory_order_relaxed
+				);
+			}
+			else
+			{
+				size_t count = 0;
+
+				for (auto lpNode = front.load(::std::memory_order_relaxed)->Next.load(::std::memory_order_acquire); lpNode != nullptr; lpNode = lpNode->Next.load(::std::memory_order_acquire))
+				{
+					++count;
+				}
+
+				return count;
+			}
 		}
 
 		virtual size_t GetCapacity() const override
@@ -97,77 +128,75 @@ namespace AL::Collections
 			return Integer<size_t>::Maximum;
 		}
 
-		Void Clear()
+		// May only be called by the consumer
+		Bool IsEmpty() const
 		{
-			Type value;
+			return front.load(::std::memory_order_relaxed)->Next.load(::std::memory_order_acquire) == nullptr;
+		}
 
-			while (Dequeue(value))
-			{
-			}
+		Void Clear()
+		{
+			DequeueAll(
+				[](Type&&)
+				{
+				}
+			);
 		}
 
 		Void Swap(MPSCQueue& queue)
 		{
-			AL::Swap(
+			Swap(
 				size,
 				queue.size
 			);
 
-			AL::Swap(
+			Swap(
 				back,
 				queue.back
 			);
 
-			AL::Swap(
+			Swap(
 				front,
 				queue.front
 			);
+
+			Swap(
+				freeNodes,
+				queue.freeNodes
+			);
 		}
 
 		Void Enqueue(Type&& value)
 		{
-			auto lpNode = new Node(
+			Emplace(
 				Move(value)
 			);
-
-			auto lpPrevBack = back.exchange(
-				lpNode,
-				::std::memory_order_acq_rel
-			);
-
-			lpPrevBack->Next.store(
-				lpNode,
-				::std::memory_order_release
-			);
-
-			++size;
 		}
 		Void Enqueue(const Type& value)
 		{
-			auto lpNode = new Node(
+			Emplace(
 				value
 			);
-
-			auto lpPrevBack = back.exchange(
-				lpNode,
-				::std::memory_order_acq_rel
-			);
-
-			lpPrevBack->Next.store(
-				lpNode,
-				::std::memory_order_release
-			);
-
-			++size;
 		}
 
 		template<typename ... TArgs>
-		inline Void Emplace(TArgs ... args)
+		inline Void Emplace(TArgs&& ... args)
 		{
-			auto lpNode = new Node(
+			auto lpNode = AllocateNode();
+
+			new (&lpNode->Value[0]) Type(
 				Forward<TArgs>(args) ...
 			);
 
+			// counted before the node is visible so the consumer can never take size below 0
+			if constexpr (TRACK_SIZE)
+			{
+				size.fetch_add(
+					1,
+					::std::memory_order_relaxed
+				);
+			}
+
 			auto lpPrevBack = back.exchange(
 				lpNode,
 				::std::memory_order_acq_rel
@@ -177,8 +206,6 @@ namespace AL::Collections
 				lpNode,
 				::std::memory_order_release
 			);
-
-			++size;
 		}
 
 		Bool Dequeue()
@@ -194,71 +221,116 @@ namespace AL::Collections
 			return True;
 		}
 		Bool Dequeue(Type& value)
+		{
+			return DequeueBatch(&value, 1) != 0;
+		}
+
+		// Moves up to count values into lpValues
+		// @return number of values dequeued
+		size_t DequeueBatch(Type* lpValues, size_t count)
 		{
 			auto lpFront = front.load(
 				::std::memory_order_relaxed
 			);
-			
-			Node* lpNode;
 
-			if ((lpNode = lpFront->Next.load(::std::memory_order_acquire)) == nullptr)
+			auto   lpTail = lpFront;
+			auto   lpNode = lpFront;
+			size_t i      = 0;
+
+			for (Node* lpNext; (i < count) && ((lpNext = lpNode->Next.load(::std::memory_order_acquire)) != nullptr); ++i)
 			{
+				lpTail = lpNode;
+				lpNode = lpNext;
 
-				return False;
+				lpValues[i] = Move(
+					lpNode->GetValue()
+				);
+
+				lpNode->GetValue().~Type();
 			}
 
-			value = Move(
-				lpNode->Value
-			);
+			if (i != 0)
+			{
+				Pop(
+					lpFront,
+					lpTail,
+					lpNode,
+					i
+				);
+			}
 
-			front.store(
-				lpNode,
-				::std::memory_order_release
+			return i;
+		}
+
+		// Calls function(Type&&) for every value in the queue
+		// @throw AL::Exception if function threw (the value passed to it is still dequeued)
+		// @return number of values dequeued
+		template<typename F>
+		size_t DequeueAll(F&& function)
+		{
+			auto lpFront = front.load(
+				::std::memory_order_relaxed
 			);
 
-			delete lpFront;
+			auto   lpTail = lpFront;
+			auto   lpNode = lpFront;
+			size_t count  = 0;
+
+			try
+			{
+				for (Node* lpNext; (lpNext = lpNode->Next.load(::std::memory_order_acquire)) != nullptr; )
+				{
+					lpTail = lpNode;
+					lpNode = lpNext;
 
-			--size;
+					++count;
 
-			return True;
+					Type value(
+						Move(lpNode->GetValue())
+					);
+
+					lpNode->GetValue().~Type();
+
+					function(
+						Move(value)
+					);
+				}
+			}
+			catch (Exception&)
+			{
+				Pop(
+					lpFront,
+					lpTail,
+					lpNode,
+					count
+				);
+
+				throw;
+			}
+
+			if (count != 0)
+			{
+				Pop(
+					lpFront,
+					lpTail,
+					lpNode,
+					count
+				);
+			}
+
+			return count;
 		}
 
 		MPSCQueue& operator = (MPSCQueue&& queue)
 		{
-			size.store(
-				queue.size.load(
-					::std::memory_order_relaxed
-				),
-				::std::memory_order_relaxed
-			);
-			queue.size.store(
-				0,
-				::std::memory_order_relaxed
-			);
-
-			back.store(
-				queue.back.load(
-					::std::memory_order_relaxed
-				),
-				::std::memory_order_relaxed
-			);
-			queue.back.store(
-				new Node(),
-				::std::memory_order_relaxed
-			);
+			if (&queue != this)
+			{
+				Swap(
+					queue
+				);
 
-			front.store(
-				queue.front.load(
-					::std::memory_order_relaxed
-				),
-				::std::memory_order_relaxed
-			);
-			queue.front.store(
-				queue.back.load(
-					::std::memory_order_relaxed
-				),
-				::std::memory_order_relaxed
-			);
+				queue.Clear();
+			}
 
 			return *this;
 		}
@@ -275,5 +347,101 @@ namespace AL::Collections
 
 			return True;
 		}
+
+	private:
+		template<typename _T>
+		static Void Swap(::std::atomic<_T>& source, ::std::atomic<_T>& destination)
+		{
+			source.store(
+				destination.exchange(
+					source.load(
+						::std::memory_order_relaxed
+					),
+					::std::memory_order_relaxed
+				),
+				::std::memory_order_relaxed
+			);
+		}
+
+		Node* AllocateNode()
+		{
+			if constexpr (POOL_NODES)
+			{
+				// a single popper makes the free list immune to ABA, contended producers fall back to new
+				if (!isFreeNodesLocked.exchange(True, ::std::memory_order_acquire))
+				{
+					auto lpNode = freeNodes.load(
+						::std::memory_order_acquire
+					);
+
+					while ((lpNode != nullptr) && !freeNodes.compare_exchange_weak(lpNode, lpNode->Next.load(::std::memory_order_relaxed), ::std::memory_order_acquire))
+					{
+					}
+
+					isFreeNodesLocked.store(
+						False,
+						::std::memory_order_release
+					);
+
+					if (lpNode != nullptr)
+					{
+						lpNode->Next.store(
+							nullptr,
+							::std::memory_order_relaxed
+						);
+
+						return lpNode;
+					}
+				}
+			}
+
+			return new Node();
+		}
+
+		// Makes lpLast the new sentinel and releases lpFirst through lpTail
+		// - The released nodes are still linked through Next so the pool takes them with a single CAS
+		Void Pop(Node* lpFirst, Node* lpTail, Node* lpLast, size_t count)
+		{
+			front.store(
+				lpLast,
+				::std::memory_order_relaxed
+			);
+
+			if constexpr (TRACK_SIZE)
+			{
+				size.fetch_sub(
+					count,
+					::std::memory_order_relaxed
+				);
+			}
+
+			if constexpr (POOL_NODES)
+			{
+				auto lpHead = freeNodes.load(
+					::std::memory_order_relaxed
+				);
+
+				do
+				{
+					lpTail->Next.store(
+						lpHead,
+						::std::memory_order_relaxed
+					);
+				} while (!freeNodes.compare_exchange_weak(lpHead, lpFirst, ::std::memory_order_release, ::std::memory_order_relaxed));
+			}
+			else
+			{
+				while (lpFirst != lpLast)
+				{
+					auto lpNext = lpFirst->Next.load(
+						::std::memory_order_relaxed
+					);
+
+					delete lpFirst;
+
+					lpFirst = lpNext;
+				}
+			}
+		}
 	};
 }
@@ -0,0 +1,350 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include <new> // placement new
+
+namespace AL::Collections
+{
+	// Allocates every node with new
+	class NodeHeapAllocator
+	{
+	public:
+		NodeHeapAllocator()
+		{
+		}
+
+		NodeHeapAllocator(NodeHeapAllocator&&)
+		{
+		}
+
+		template<typename T_NODE, typename ... TArgs>
+		T_NODE* Create(TArgs&& ... args)
+		{
+			return new T_NODE(
+				Forward<TArgs>(args) ...
+			);
+		}
+
+		template<typename T_NODE>
+		Void Destroy(T_NODE* lpNode)
+		{
+			delete lpNode;
+		}
+
+		NodeHeapAllocator& operator = (NodeHeapAllocator&&)
+		{
+			return *this;
+		}
+	};
+
+	// Recycles nodes through a free list shared by every container on the calling thread
+	// - Nodes of the same size class share a free list regardless of type
+	// - Nodes may be destroyed on a different thread than the one that created them
+	class NodePoolAllocator
+	{
+		// Nodes kept per size class and thread, the rest are returned to the heap
+		static constexpr size_t MAXIMUM_FREE_NODES = 256;
+		static constexpr size_t SIZE_CLASS_ALIGNMENT = 16;
+
+		template<size_t SIZE>
+		class Pool
+		{
+			struct FreeNode
+			{
+				FreeNode* lpNext;
+			};
+
+			FreeNode* lpFreeNodes   = nullptr;
+			size_t    freeNodeCount = 0;
+
+			// trivially destructible so it can still be read once the pool of this thread is destroyed
+			static inline thread_local Bool isDestroyed = False;
+
+			Pool()
+			{
+			}
+
+		public:
+			virtual ~Pool()
+			{
+				while (lpFreeNodes != nullptr)
+				{
+					auto lpNext = lpFreeNodes->lpNext;
+
+					::operator delete(
+						lpFreeNodes
+					);
+
+					lpFreeNodes = lpNext;
+				}
+
+				freeNodeCount = 0;
+				isDestroyed   = True;
+			}
+
+			static Void* Allocate()
+			{
+				if (auto lpPool = GetInstance(); (lpPool != nullptr) && (lpPool->lpFreeNodes != nullptr))
+				{
+					auto lpNode         = lpPool->lpFreeNodes;
+					lpPool->lpFreeNodes = lpNode->lpNext;
+
+					--lpPool->freeNodeCount;
+
+					return lpNode;
+				}
+
+				return ::operator new(
+					SIZE
+				);
+			}
+
+			static Void Release(Void* lpNode)
+			{
+				auto lpPool = GetInstance();
+
+				// containers with static storage may outlive the pool of the main thread
+				if ((lpPool == nullptr) || (lpPool->freeNodeCount == MAXIMUM_FREE_NODES))
+				{
+					::operator delete(
+						lpNode
+					);
+
+					return;
+				}
+
+				auto lpFreeNode     = static_cast<FreeNode*>(lpNode);
+				lpFreeNode->lpNext  = lpPool->lpFreeNodes;
+				lpPool->lpFreeNodes = lpFreeNode;
+
+				++lpPool->freeNodeCount;
+			}
+
+		private:
+			// @return nullptr once the pool of this thread is destroyed
+			static Pool* GetInstance()
+			{
+				if (isDestroyed)
+				{
+
+					return nullptr;
+				}
+
+				static thread_local Pool pool;
+
+				return &pool;
+			}
+		};
+
+		template<typename T_NODE>
+		using Node_Pool = Pool<(sizeof(T_NODE) + SIZE_CLASS_ALIGNMENT - 1) & ~(SIZE_CLASS_ALIGNMENT - 1)>;
+
+	public:
+		NodePoolAllocator()
+		{
+		}
+
+		NodePoolAllocator(NodePoolAllocator&&)
+		{
+		}
+
+		template<typename T_NODE, typename ... TArgs>
+		T_NODE* Create(TArgs&& ... args)
+		{
+			static_assert(
+				alignof(T_NODE) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+				"T_NODE is over-aligned"
+			);
+
+			auto lpNode = Node_Pool<T_NODE>::Allocate();
+
+			try
+			{
+				return new (lpNode) T_NODE(
+					Forward<TArgs>(args) ...
+				);
+			}
+			catch (...)
+			{
+				Node_Pool<T_NODE>::Release(
+					lpNode
+				);
+
+				throw;
+			}
+		}
+
+		template<typename T_NODE>
+		Void Destroy(T_NODE* lpNode)
+		{
+			lpNode->~T_NODE();
+
+			Node_Pool<T_NODE>::Release(
+				lpNode
+			);
+		}
+
+		NodePoolAllocator& operator = (NodePoolAllocator&&)
+		{
+			return *this;
+		}
+	};
+
+	// Carves nodes out of slabs owned by a single container
+	// - Slabs are only returned to the heap when the allocator is destroyed
+	// - Not thread safe, every node must be of the same type
+	template<size_t NODES_PER_SLAB = 32>
+	class NodeSlabAllocator
+	{
+		struct FreeNode
+		{
+			FreeNode* lpNext;
+		};
+
+		struct Slab
+		{
+			Slab* lpNext;
+		};
+
+		static constexpr size_t SLAB_HEADER_SIZE = (sizeof(Slab) + __STDCPP_DEFAULT_NEW_ALIGNMENT__ - 1) & ~(__STDCPP_DEFAULT_NEW_ALIGNMENT__ - 1);
+
+		Slab*     lpSlabs     = nullptr;
+		FreeNode* lpFreeNodes = nullptr;
+
+		NodeSlabAllocator(const NodeSlabAllocator&) = delete;
+
+	public:
+		NodeSlabAllocator()
+		{
+		}
+
+		NodeSlabAllocator(NodeSlabAllocator&& allocator)
+			: lpSlabs(
+				allocator.lpSlabs
+			),
+			lpFreeNodes(
+				allocator.lpFreeNodes
+			)
+		{
+			allocator.lpSlabs     = nullptr;
+			allocator.lpFreeNodes = nullptr;
+		}
+
+		virtual ~NodeSlabAllocator()
+		{
+			Release();
+		}
+
+		template<typename T_NODE, typename ... TArgs>
+		T_NODE* Create(TArgs&& ... args)
+		{
+			static_assert(
+				alignof(T_NODE) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+				"T_NODE is over-aligned"
+			);
+
+			if (lpFreeNodes == nullptr)
+			{
+
+				AllocateSlab(
+					GetNodeSize<T_NODE>()
+				);
+			}
+
+			auto lpNode = lpFreeNodes;
+			lpFreeNodes = lpNode->lpNext;
+
+			try
+			{
+				return new (lpNode) T_NODE(
+					Forward<TArgs>(args) ...
+				);
+			}
+			catch (...)
+			{
+				lpNode->lpNext = lpFreeNodes;
+				lpFreeNodes    = lpNode;
+
+				throw;
+			}
+		}
+
+		template<typename T_NODE>
+		Void Destroy(T_NODE* lpNode)
+		{
+			lpNode->~T_NODE();
+
+			auto lpFreeNode    = reinterpret_cast<FreeNode*>(lpNode);
+			lpFreeNode->lpNext = lpFreeNodes;
+			lpFreeNodes        = lpFreeNode;
+		}
+
+		NodeSlabAllocator& operator = (NodeSlabAllocator&& allocator)
+		{
+			if (&allocator != this)
+			{
+				Release();
+
+				lpSlabs               = allocator.lpSlabs;
+				allocator.lpSlabs     = nullptr;
+
+				lpFreeNodes           = allocator.lpFreeNodes;
+				allocator.lpFreeNodes = nullptr;
+			}
+
+			return *this;
+		}
+
+	private:
+		template<typename T_NODE>
+		static constexpr size_t GetNodeSize()
+		{
+			auto size = (sizeof(T_NODE) >= sizeof(FreeNode)) ? sizeof(T_NODE) : sizeof(FreeNode);
+
+			return (size + alignof(T_NODE) - 1) & ~(alignof(T_NODE) - 1);
+		}
+
+		Void AllocateSlab(size_t nodeSize)
+		{
+			auto lpSlab = static_cast<Slab*>(
+				::operator new(SLAB_HEADER_SIZE + (nodeSize * NODES_PER_SLAB))
+			);
+
+			lpSlab->lpNext = lpSlabs;
+			lpSlabs        = lpSlab;
+
+			auto lpNodes = reinterpret_cast<uint8*>(lpSlab) + SLAB_HEADER_SIZE;
+
+			for (size_t i = NODES_PER_SLAB; i > 0; --i)
+			{
+				auto lpFreeNode    = reinterpret_cast<FreeNode*>(&lpNodes[(i - 1) * nodeSize]);
+				lpFreeNode->lpNext = lpFreeNodes;
+				lpFreeNodes        = lpFreeNode;
+			}
+		}
+
+		// Nodes must have been destroyed already
+		Void Release()
+		{
+			while (lpSlabs != nullptr)
+			{
+				auto lpNext = lpSlabs->lpNext;
+
+				::operator delete(
+					lpSlabs
+				);
+
+				lpSlabs = lpNext;
+			}
+
+			lpFreeNodes = nullptr;
+		}
+	};
+
+#if defined(AL_PLATFORM_PICO)
+	// avoids thread_local storage
+	typedef NodeHeapAllocator NodeDefaultAllocator;
+#else
+	typedef NodePoolAllocator NodeDefaultAllocator;
+#endif
+}
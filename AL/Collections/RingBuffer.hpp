@@ -0,0 +1,318 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "Array.hpp"
+
+namespace AL::Collections
+{
+	struct RingBufferSegment
+	{
+		uint8* lpBuffer;
+		size_t Size;
+	};
+
+	// Fixed capacity byte queue
+	// - Data is exposed in place through at most 2 segments (the second when it wraps the end of the buffer)
+	class RingBuffer
+	{
+		size_t       size  = 0;
+		size_t       first = 0;
+		Array<uint8> container;
+
+	public:
+		RingBuffer()
+		{
+		}
+
+		RingBuffer(RingBuffer&& ringBuffer)
+			: size(
+				ringBuffer.size
+			),
+			first(
+				ringBuffer.first
+			),
+			container(
+				Move(ringBuffer.container)
+			)
+		{
+			ringBuffer.size  = 0;
+			ringBuffer.first = 0;
+		}
+		RingBuffer(const RingBuffer& ringBuffer)
+			: size(
+				ringBuffer.size
+			),
+			first(
+				ringBuffer.first
+			),
+			container(
+				ringBuffer.container
+			)
+		{
+		}
+
+		explicit RingBuffer(size_t capacity)
+			: container(
+				capacity
+			)
+		{
+		}
+
+		virtual ~RingBuffer()
+		{
+		}
+
+		size_t GetSize() const
+		{
+			return size;
+		}
+
+		size_t GetCapacity() const
+		{
+			return container.GetCapacity();
+		}
+
+		size_t GetFreeSize() const
+		{
+			return GetCapacity() - GetSize();
+		}
+
+		Void Clear()
+		{
+			size  = 0;
+			first = 0;
+		}
+
+		// Changes the capacity and retains values
+		Void SetCapacity(size_t value)
+		{
+			AL_ASSERT(
+				value >= GetSize(),
+				"RingBuffer capacity less than size"
+			);
+
+			if (value != GetCapacity())
+			{
+				Array<uint8> container(
+					value
+				);
+
+				if (size != 0)
+				{
+
+					Peek(
+						&container[0],
+						size
+					);
+				}
+
+				this->container = Move(container);
+				this->first     = 0;
+			}
+		}
+
+		// @return number of segments
+		size_t GetReadSegments(RingBufferSegment(&segments)[2])
+		{
+			if (size == 0)
+			{
+
+				return 0;
+			}
+
+			auto capacity = GetCapacity();
+
+			if ((first + size) <= capacity)
+			{
+				segments[0] = { &container[first], size };
+
+				return 1;
+			}
+
+			segments[0] = { &container[first], capacity - first };
+			segments[1] = { &container[0], size - (capacity - first) };
+
+			return 2;
+		}
+
+		// Segments are filled by the caller and committed with Commit
+		// @return number of segments
+		size_t GetWriteSegments(RingBufferSegment(&segments)[2])
+		{
+			auto capacity = GetCapacity();
+
+			if (size == capacity)
+			{
+
+				return 0;
+			}
+
+			auto last = GetIndex(
+				size
+			);
+
+			if ((last < first) || (first == 0))
+			{
+				segments[0] = { &container[last], capacity - size };
+
+				return 1;
+			}
+
+			segments[0] = { &container[last], capacity - last };
+			segments[1] = { &container[0], first };
+
+			return 2;
+		}
+
+		// Appends size bytes written through GetWriteSegments
+		Void Commit(size_t size)
+		{
+			AL_ASSERT(
+				size <= GetFreeSize(),
+				"RingBuffer overflow"
+			);
+
+			this->size += size;
+		}
+
+		// Removes size bytes from the front
+		Void Skip(size_t size)
+		{
+			AL_ASSERT(
+				size <= GetSize(),
+				"RingBuffer underflow"
+			);
+
+			if ((this->size -= size) == 0)
+			{
+				// keeps the next write contiguous
+				first = 0;
+
+				return;
+			}
+
+			first = GetIndex(
+				size
+			);
+		}
+
+		// @return AL::False if there is not enough space
+		Bool Write(const Void* lpBuffer, size_t size)
+		{
+			if (size > GetFreeSize())
+			{
+
+				return False;
+			}
+
+			RingBufferSegment segments[2];
+			auto              segmentCount = GetWriteSegments(segments);
+
+			for (size_t i = 0, offset = 0; (i < segmentCount) && (offset < size); ++i)
+			{
+				auto count = (segments[i].Size < (size - offset)) ? segments[i].Size : (size - offset);
+
+				memcpy(
+					segments[i].lpBuffer,
+					&reinterpret_cast<const uint8*>(lpBuffer)[offset],
+					count
+				);
+
+				offset += count;
+			}
+
+			this->size += size;
+
+			return True;
+		}
+
+		// @return AL::False if there is not enough data
+		Bool Read(Void* lpBuffer, size_t size)
+		{
+			if (!Peek(lpBuffer, size))
+			{
+
+				return False;
+			}
+
+			Skip(
+				size
+			);
+
+			return True;
+		}
+
+		// Copies size bytes starting offset bytes from the front without removing them
+		// @return AL::False if there is not enough data
+		Bool Peek(Void* lpBuffer, size_t size, size_t offset = 0) const
+		{
+			if ((offset + size) > GetSize())
+			{
+
+				return False;
+			}
+
+			if (size != 0)
+			{
+				auto capacity = GetCapacity();
+				auto index    = GetIndex(offset);
+				auto count    = ((index + size) <= capacity) ? size : (capacity - index);
+
+				memcpy(
+					lpBuffer,
+					&container[index],
+					count
+				);
+
+				if (count < size)
+				{
+
+					memcpy(
+						&reinterpret_cast<uint8*>(lpBuffer)[count],
+						&container[0],
+						size - count
+					);
+				}
+			}
+
+			return True;
+		}
+
+		RingBuffer& operator = (RingBuffer&& ringBuffer)
+		{
+			size = ringBuffer.size;
+			ringBuffer.size = 0;
+
+			first = ringBuffer.first;
+			ringBuffer.first = 0;
+
+			container = Move(
+				ringBuffer.container
+			);
+
+			return *this;
+		}
+		RingBuffer& operator = (const RingBuffer& ringBuffer)
+		{
+			size      = ringBuffer.size;
+			first     = ringBuffer.first;
+			container = ringBuffer.container;
+
+			return *this;
+		}
+
+	private:
+		size_t GetIndex(size_t offset) const
+		{
+			auto index = first + offset;
+
+			if (auto capacity = GetCapacity(); index >= capacity)
+			{
+
+				index -= capacity;
+			}
+
+			return index;
+		}
+	};
+}
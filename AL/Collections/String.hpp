@@ -12,21 +12,22 @@
 
 namespace AL::Collections
 {
+	// Strings of up to 24 bytes (including END) are stored inline
 	template<typename T_CHAR>
 	struct __String_Types;
 	template<>
 	struct __String_Types<char>
 	{
-		typedef char                           Char;
-		typedef ArrayList<Char>                Container;
-		typedef typename Container::Collection Collection;
+		typedef char                               Char;
+		typedef ArrayList<Char, 24 / sizeof(Char)> Container;
+		typedef typename Container::Collection     Collection;
 	};
 	template<>
 	struct __String_Types<wchar_t>
 	{
-		typedef wchar_t                        Char;
-		typedef ArrayList<Char>                Container;
-		typedef typename Container::Collection Collection;
+		typedef wchar_t                            Char;
+		typedef ArrayList<Char, 24 / sizeof(Char)> Container;
+		typedef typename Container::Collection     Collection;
 	};
 
 	template<typename T_CHAR>
@@ -85,6 +86,11 @@ namespace AL::Collections
 		typedef __String_Utility<T_CHAR>   Utility;
 		typedef __String_Constants<T_CHAR> Constants;
 
+		// characters formatted on the stack by AppendFormat
+		static constexpr size_t FORMAT_BUFFER_SIZE         = 256;
+		// WString only, longer results are discarded
+		static constexpr size_t FORMAT_BUFFER_MAXIMUM_SIZE = 0x100000;
+
 		typename Types::Container container;
 
 	public:
@@ -154,7 +160,17 @@ namespace AL::Collections
 			);
 		}
 		template<typename ... TArgs>
-		static _String<Char> Format(const Char* format, TArgs ... args);
+		static _String<Char> Format(const Char* format, TArgs ... args)
+		{
+			_String string;
+
+			string.AppendFormat(
+				format,
+				Forward<TArgs>(args) ...
+			);
+
+			return string;
+		}
 
 		static _String<Char> Format(const _String& format)
 		{
@@ -347,13 +363,12 @@ namespace AL::Collections
 			);
 		}
 
+		// Keeps the capacity, see ShrinkToFit
 		Void Clear()
 		{
-			container.SetCapacity(
-				1
-			);
+			container.Clear();
 
-			container.Fill(
+			container.PushBack(
 				END
 			);
 		}
@@ -402,15 +417,20 @@ namespace AL::Collections
 
 		Void Assign(Char c, size_t count)
 		{
-			container.SetCapacity(
+			container.Clear();
+
+			container.Reserve(
 				count + 1
 			);
 
 			container.Fill(
-				c
+				c,
+				count
 			);
 
-			container[count] = END;
+			container.PushBack(
+				END
+			);
 		}
 
 		Void Assign(const Char* lpBuffer)
@@ -422,17 +442,36 @@ namespace AL::Collections
 		}
 		Void Assign(const Char* lpBuffer, size_t length)
 		{
-			typedef typename Types::Container Container;
+			// lpBuffer may point into this string
+			if ((lpBuffer >= GetCString()) && (lpBuffer < (GetCString() + GetSize())))
+			{
+				_String string(
+					lpBuffer,
+					length
+				);
 
-			container = Container(
-				lpBuffer,
-				length,
-				1
-			);
+				Swap(
+					string
+				);
+			}
+			else
+			{
+				container.Clear();
 
-			container.PushBack(
-				END
-			);
+				container.Reserve(
+					length + 1
+				);
+
+				container.Insert(
+					container.end(),
+					lpBuffer,
+					length
+				);
+
+				container.PushBack(
+					END
+				);
+			}
 		}
 
 		Void Append(Char c)
@@ -465,6 +504,25 @@ namespace AL::Collections
 			);
 		}
 
+		Void AppendFormat(const Char* format)
+		{
+			Append(
+				format
+			);
+		}
+		// Formats into a stack buffer and only formats directly into this string when it overflows
+		// - Nothing is appended if formatting fails
+		template<typename ... TArgs>
+		Void AppendFormat(const Char* format, TArgs ... args);
+		template<typename ... TArgs>
+		Void AppendFormat(const _String& format, TArgs ... args)
+		{
+			AppendFormat(
+				format.GetCString(),
+				Forward<TArgs>(args) ...
+			);
+		}
+
 		template<typename T_ITERATOR>
 		Void Insert(T_ITERATOR it, Char c)
 		{
@@ -1853,11 +1911,11 @@ namespace AL::Collections
 
 		virtual ReverseIterator rbegin() override
 		{
-			return --container.rbegin();
+			return ++container.rbegin();
 		}
 		virtual ConstReverseIterator rbegin() const override
 		{
-			return --container.rbegin();
+			return ++container.rbegin();
 		}
 
 		virtual ReverseIterator rend() override
@@ -1871,7 +1929,7 @@ namespace AL::Collections
 
 		virtual ConstReverseIterator crbegin() const override
 		{
-			return --container.crbegin();
+			return ++container.crbegin();
 		}
 
 		virtual ConstReverseIterator crend() const override
@@ -2004,6 +2062,32 @@ namespace AL::Collections
 
 			return True;
 		}
+
+	private:
+		// Changes the length, new characters are END
+		Void Resize(size_t length)
+		{
+			auto index = GetLength();
+
+			if (index > length)
+			{
+
+				index = length;
+			}
+			else
+			{
+
+				container.Reserve(
+					length - index
+				);
+			}
+
+			container.Fill(
+				END,
+				index,
+				(length + 1) - index
+			);
+		}
 	};
 
 	typedef _String<char>    String;
@@ -2197,59 +2281,89 @@ namespace AL::Collections
 
 template<>
 template<typename ... TArgs>
-inline AL::Collections::_String<char> AL::Collections::_String<char>::Format(const Char* format, TArgs ... args)
+inline AL::Void AL::Collections::_String<char>::AppendFormat(const Char* format, TArgs ... args)
 {
-	auto bufferLength = ::std::snprintf(
-		nullptr,
-		0,
-		format,
-		Forward<TArgs>(args) ...
-	);
-
-	auto lpBuffer = new char[bufferLength + 1];
+	char buffer[FORMAT_BUFFER_SIZE];
 
-	::std::snprintf(
-		lpBuffer,
-		bufferLength + 1,
+	auto length = ::std::snprintf(
+		buffer,
+		FORMAT_BUFFER_SIZE,
 		format,
 		Forward<TArgs>(args) ...
 	);
 
-	_String string(
-		lpBuffer,
-		bufferLength
-	);
+	if (length < 0)
+	{
 
-	delete[] lpBuffer;
+		return;
+	}
 
-	return string;
+	if (static_cast<size_t>(length) < FORMAT_BUFFER_SIZE)
+	{
+		Append(
+			buffer,
+			static_cast<size_t>(length)
+		);
+	}
+	else
+	{
+		auto offset = GetLength();
+
+		Resize(
+			offset + length
+		);
+
+		::std::snprintf(
+			&container[offset],
+			length + 1,
+			format,
+			Forward<TArgs>(args) ...
+		);
+	}
 }
 template<>
 template<typename ... TArgs>
-inline AL::Collections::_String<wchar_t> AL::Collections::_String<wchar_t>::Format(const Char* format, TArgs ... args)
+inline AL::Void AL::Collections::_String<wchar_t>::AppendFormat(const Char* format, TArgs ... args)
 {
-	auto bufferLength = ::std::swprintf(
-		nullptr,
-		0,
+	wchar_t buffer[FORMAT_BUFFER_SIZE];
+
+	auto length = ::std::swprintf(
+		buffer,
+		FORMAT_BUFFER_SIZE,
 		format,
 		Forward<TArgs>(args) ...
 	);
 
-	auto lpBuffer = new wchar_t[bufferLength + 1];
+	if (length >= 0)
+	{
+		Append(
+			buffer,
+			static_cast<size_t>(length)
+		);
 
-	::std::swprintf(
-		lpBuffer,
-		bufferLength + 1,
-		format,
-		Forward<TArgs>(args) ...
-	);
+		return;
+	}
 
-	_String string(
-		lpBuffer,
-		bufferLength
-	);
+	// swprintf can't measure the result so the string grows until it fits
+	auto offset = GetLength();
 
-	delete[] lpBuffer;
+	for (size_t capacity = FORMAT_BUFFER_SIZE * 2; capacity <= FORMAT_BUFFER_MAXIMUM_SIZE; capacity *= 2)
+	{
+		Resize(
+			offset + capacity - 1
+		);
 
-	return string;
+		if ((length = ::std::swprintf(&container[offset], capacity, format, Forward<TArgs>(args) ...)) >= 0)
+		{
+			Resize(
+				offset + length
+			);
+
+			return;
+		}
+	}
+
+	Resize(
+		offset
+	);
 }
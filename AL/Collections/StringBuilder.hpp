@@ -93,14 +93,10 @@ namespace AL::Collections
 			{
 				if (!appendAsDecimal && (Is_Pointer<T>::Value || Is_Enum_Or_Integer<T>::Value))
 				{
-					auto string = AL::String::Format(
+					buffer.AppendFormat(
 						"%X",
 						value
 					);
-
-					buffer.Append(
-						string
-					);
 				}
 				else
 				{
@@ -117,14 +113,10 @@ namespace AL::Collections
 			{
 				if (!appendAsDecimal && (Is_Pointer<T>::Value || Is_Enum_Or_Integer<T>::Value))
 				{
-					auto string = AL::WString::Format(
+					buffer.AppendFormat(
 						L"%X",
 						value
 					);
-
-					buffer.Append(
-						string
-					);
 				}
 				else
 				{
@@ -164,6 +156,15 @@ namespace AL::Collections
 
 			return *this;
 		}
+		_StringBuilder& Append(const Char* value, size_t length)
+		{
+			buffer.Append(
+				value,
+				length
+			);
+
+			return *this;
+		}
 		_StringBuilder& Append(const String& value)
 		{
 			buffer.Append(
@@ -173,6 +174,27 @@ namespace AL::Collections
 			return *this;
 		}
 
+		template<typename ... TArgs>
+		_StringBuilder& AppendFormat(const Char* format, TArgs ... args)
+		{
+			buffer.AppendFormat(
+				format,
+				Forward<TArgs>(args) ...
+			);
+
+			return *this;
+		}
+		template<typename ... TArgs>
+		_StringBuilder& AppendFormat(const String& format, TArgs ... args)
+		{
+			buffer.AppendFormat(
+				format,
+				Forward<TArgs>(args) ...
+			);
+
+			return *this;
+		}
+
 		template<typename T>
 		_StringBuilder& operator << (T value)
 		{
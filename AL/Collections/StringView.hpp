@@ -0,0 +1,231 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "String.hpp"
+
+namespace AL::Collections
+{
+	// Non-owning range of characters
+	// - Not null terminated, the viewed buffer must outlive the view
+	template<typename T_CHAR>
+	class _StringView
+	{
+		const T_CHAR* lpBuffer;
+		size_t        length;
+
+	public:
+		typedef T_CHAR           Char;
+		typedef _String<T_CHAR>  String;
+
+		typedef const Char*      ConstIterator;
+
+		static constexpr size_t  NPOS = String::NPOS;
+
+		constexpr _StringView()
+			: lpBuffer(
+				nullptr
+			),
+			length(
+				0
+			)
+		{
+		}
+
+		constexpr _StringView(const Char* lpBuffer, size_t length)
+			: lpBuffer(
+				lpBuffer
+			),
+			length(
+				length
+			)
+		{
+		}
+
+		template<size_t S>
+		constexpr _StringView(const Char(&buffer)[S])
+			: lpBuffer(
+				&buffer[0]
+			),
+			length(
+				S - 1
+			)
+		{
+		}
+
+		_StringView(const String& string)
+			: lpBuffer(
+				string.GetCString()
+			),
+			length(
+				string.GetLength()
+			)
+		{
+		}
+
+		constexpr Bool IsEmpty() const
+		{
+			return length == 0;
+		}
+
+		constexpr size_t GetLength() const
+		{
+			return length;
+		}
+
+		constexpr const Char* GetBuffer() const
+		{
+			return lpBuffer;
+		}
+
+		String ToString() const
+		{
+			return String(
+				lpBuffer,
+				length
+			);
+		}
+
+		constexpr size_t IndexOf(Char c) const
+		{
+			return IndexOfAt(
+				c,
+				0
+			);
+		}
+		constexpr size_t IndexOfAt(Char c, size_t index) const
+		{
+			for (size_t i = index; i < length; ++i)
+			{
+				if (lpBuffer[i] == c)
+				{
+
+					return i;
+				}
+			}
+
+			return NPOS;
+		}
+
+		constexpr size_t IndexOfLast(Char c) const
+		{
+			for (size_t i = length; i > 0; --i)
+			{
+				if (lpBuffer[i - 1] == c)
+				{
+
+					return i - 1;
+				}
+			}
+
+			return NPOS;
+		}
+
+		constexpr Bool StartsWith(Char c) const
+		{
+			if ((length == 0) || (lpBuffer[0] != c))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+		Bool StartsWith(const _StringView& view) const
+		{
+			if ((view.length > length) || ((view.length != 0) && !memcmp(lpBuffer, view.lpBuffer, view.length * sizeof(Char))))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+
+		constexpr Bool EndsWith(Char c) const
+		{
+			if ((length == 0) || (lpBuffer[length - 1] != c))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+		Bool EndsWith(const _StringView& view) const
+		{
+			if ((view.length > length) || ((view.length != 0) && !memcmp(&lpBuffer[length - view.length], view.lpBuffer, view.length * sizeof(Char))))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+
+		Bool Compare(const _StringView& view) const
+		{
+			if ((view.length != length) || ((length != 0) && !memcmp(lpBuffer, view.lpBuffer, length * sizeof(Char))))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+
+		// Clamped to the end of the view
+		constexpr _StringView SubView(size_t index, size_t length = NPOS) const
+		{
+			if (index > this->length)
+			{
+
+				index = this->length;
+			}
+
+			if (length > (this->length - index))
+			{
+
+				length = this->length - index;
+			}
+
+			return _StringView(
+				&lpBuffer[index],
+				length
+			);
+		}
+
+		constexpr ConstIterator begin() const
+		{
+			return lpBuffer;
+		}
+		constexpr ConstIterator end() const
+		{
+			return &lpBuffer[length];
+		}
+
+		constexpr Char operator [] (size_t index) const
+		{
+			return lpBuffer[index];
+		}
+
+		Bool operator == (const _StringView& view) const
+		{
+			return Compare(
+				view
+			);
+		}
+		Bool operator != (const _StringView& view) const
+		{
+			if (Compare(view))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+	};
+
+	typedef _StringView<char>    StringView;
+	typedef _StringView<wchar_t> WStringView;
+}
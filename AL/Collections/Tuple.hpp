@@ -1,6 +1,8 @@
 #pragma once
 #include "AL/Common.hpp"
 
+#include <type_traits> // is_nothrow_move_constructible
+
 namespace AL::Collections
 {
 	template<typename ... TYPES>
@@ -77,7 +79,7 @@ namespace AL::Collections
 		{
 		}
 
-		Tuple(Tuple&& tuple)
+		Tuple(Tuple&& tuple) noexcept(::std::is_nothrow_move_constructible<NodeList<0, TYPES ...>>::value)
 			: nodes(
 				Move(tuple.nodes)
 			)
@@ -207,7 +209,7 @@ namespace AL::Collections
 		{
 		}
 
-		Tuple(Tuple&& tuple)
+		Tuple(Tuple&& tuple) noexcept
 		{
 		}
 
@@ -1,20 +1,24 @@
 #pragma once
 #include "AL/Common.hpp"
 
-#include "LinkedList.hpp"
+#include "Hash.hpp"
+#include "HashTable.hpp"
 
 namespace AL::Collections
 {
-	template<typename T>
+	template<typename T, typename T_HASH = Hash<T>>
 	class UnorderedSet
-		: public LinkedList<T>::Collection
+		: public HashTable<T, T, T_HASH>::Collection
 	{
-		LinkedList<T> container;
+		typedef HashTable<T, T, T_HASH> _Container;
+
+		_Container container;
 
 	public:
 		typedef T                                         Type;
+		typedef T_HASH                                    Hasher;
 
-		typedef typename LinkedList<Type>::Collection     Collection;
+		typedef typename _Container::Collection           Collection;
 
 		typedef typename Collection::Iterator             Iterator;
 		typedef typename Collection::ConstIterator        ConstIterator;
@@ -39,6 +43,32 @@ namespace AL::Collections
 		{
 		}
 
+		explicit UnorderedSet(size_t capacity)
+			: container(
+				capacity
+			)
+		{
+		}
+
+		template<size_t S>
+		UnorderedSet(const Type(&values)[S])
+			: UnorderedSet(
+				&values[0],
+				S
+			)
+		{
+		}
+		UnorderedSet(const Type* lpValues, size_t count)
+			: container(
+				count
+			)
+		{
+			AddRange(
+				lpValues,
+				count
+			);
+		}
+
 		virtual ~UnorderedSet()
 		{
 		}
@@ -53,6 +83,19 @@ namespace AL::Collections
 			return container.GetCapacity();
 		}
 
+		Iterator      Find(const Type& value)
+		{
+			return container.Find(
+				value
+			);
+		}
+		ConstIterator Find(const Type& value) const
+		{
+			return container.Find(
+				value
+			);
+		}
+
 		Bool Contains(const Type& value) const
 		{
 			if (!container.Contains(value))
@@ -69,22 +112,142 @@ namespace AL::Collections
 			container.Clear();
 		}
 
-		Void Add(Type&& value)
+		// Ensures count values can be stored without rehashing
+		Void Reserve(size_t count)
 		{
-			if (!Contains(value))
+			container.Reserve(
+				count
+			);
+		}
+
+		Void Rehash(size_t capacity)
+		{
+			container.Rehash(
+				capacity
+			);
+		}
+
+		Void ShrinkToFit()
+		{
+			container.ShrinkToFit();
+		}
+
+		// @return False if value already exists
+		Bool Add(Type&& value)
+		{
+			Iterator it;
+
+			return container.TryEmplace(
+				it,
+				value,
+				Move(value)
+			);
+		}
+		// @return False if value already exists
+		Bool Add(const Type& value)
+		{
+			Iterator it;
+
+			return container.TryEmplace(
+				it,
+				value,
+				value
+			);
+		}
+
+		template<size_t S>
+		Void AddRange(const Type(&values)[S])
+		{
+			AddRange(
+				&values[0],
+				S
+			);
+		}
+		Void AddRange(const Type* lpValues, size_t count)
+		{
+			Reserve(
+				GetSize() + count
+			);
+
+			for (size_t i = 0; i < count; ++i, ++lpValues)
 			{
-				container.PushBack(
-					Move(value)
+				Add(
+					*lpValues
 				);
 			}
 		}
-		Void Add(const Type& value)
+
+		// Adds every value in unorderedSet
+		Void UnionWith(const UnorderedSet& unorderedSet)
 		{
-			if (!Contains(value))
+			if (&unorderedSet != this)
 			{
-				container.PushBack(
-					value
-				);
+				for (auto& value : unorderedSet)
+				{
+					Add(
+						value
+					);
+				}
+			}
+		}
+
+		// Removes every value not in unorderedSet
+		Void IntersectWith(const UnorderedSet& unorderedSet)
+		{
+			if (&unorderedSet != this)
+			{
+				for (auto it = begin(); it != end(); )
+				{
+					if (!unorderedSet.Contains(*it))
+					{
+
+						Erase(
+							it++
+						);
+					}
+					else
+					{
+
+						++it;
+					}
+				}
+			}
+		}
+
+		// Removes every value in unorderedSet
+		Void ExceptWith(const UnorderedSet& unorderedSet)
+		{
+			if (&unorderedSet == this)
+			{
+
+				Clear();
+			}
+			else if (unorderedSet.GetSize() < GetSize())
+			{
+				for (auto& value : unorderedSet)
+				{
+					Remove(
+						value
+					);
+				}
+			}
+			else
+			{
+				for (auto it = begin(); it != end(); )
+				{
+					if (unorderedSet.Contains(*it))
+					{
+
+						Erase(
+							it++
+						);
+					}
+					else
+					{
+
+						++it;
+					}
+				}
 			}
 		}
 
@@ -190,9 +353,9 @@ namespace AL::Collections
 				return False;
 			}
 
-			for (auto it1 = cbegin(), it2 = unorderedSet.cbegin(); it1 != cend(); ++it1, ++it2)
+			for (auto& value : container)
 			{
-				if (*it1 != *it2)
+				if (!unorderedSet.Contains(value))
 				{
 
 					return False;
@@ -0,0 +1,306 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include <atomic>
+
+namespace AL::Collections
+{
+	// Chase-Lev work stealing deque
+	// - Push/Pop may only be called by the owning thread
+	// - Steal may be called by any thread
+	// - T must be POD (usually a pointer)
+	template<typename T>
+	class WorkStealingDeque
+	{
+		static_assert(
+			Is_POD<T>::Value,
+			"T must be POD"
+		);
+
+		static constexpr size_t CACHE_LINE_SIZE  = 64;
+		static constexpr int64  DEFAULT_CAPACITY = 64;
+
+		struct Buffer
+		{
+			int64             Capacity;
+			::std::atomic<T>* lpValues;
+			Buffer*           lpPrevious;
+
+			Buffer(int64 capacity, Buffer* lpPrevious)
+				: Capacity(
+					capacity
+				),
+				lpValues(
+					new ::std::atomic<T>[capacity]
+				),
+				lpPrevious(
+					lpPrevious
+				)
+			{
+			}
+
+			virtual ~Buffer()
+			{
+				delete[] lpValues;
+			}
+
+			T    Get(int64 index) const
+			{
+				return lpValues[index & (Capacity - 1)].load(
+					::std::memory_order_relaxed
+				);
+			}
+			Void Set(int64 index, T value)
+			{
+				lpValues[index & (Capacity - 1)].store(
+					value,
+					::std::memory_order_relaxed
+				);
+			}
+		};
+
+		// top and bottom are written by different threads
+		alignas(CACHE_LINE_SIZE) ::std::atomic<int64>   top;
+		alignas(CACHE_LINE_SIZE) ::std::atomic<int64>   bottom;
+		alignas(CACHE_LINE_SIZE) ::std::atomic<Buffer*> buffer;
+
+		WorkStealingDeque(WorkStealingDeque&&) = delete;
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+
+	public:
+		typedef T Type;
+
+		WorkStealingDeque()
+			: WorkStealingDeque(
+				DEFAULT_CAPACITY
+			)
+		{
+		}
+
+		// capacity is rounded up to a power of 2
+		explicit WorkStealingDeque(size_t capacity)
+			: top(
+				0
+			),
+			bottom(
+				0
+			),
+			buffer(
+				new Buffer(
+					GetBufferCapacity(capacity),
+					nullptr
+				)
+			)
+		{
+		}
+
+		virtual ~WorkStealingDeque()
+		{
+			// buffers replaced by Grow are kept alive until now because Steal may still be reading them
+			for (auto lpBuffer = buffer.load(::std::memory_order_relaxed); lpBuffer != nullptr; )
+			{
+				auto lpPrevious = lpBuffer->lpPrevious;
+
+				delete lpBuffer;
+
+				lpBuffer = lpPrevious;
+			}
+		}
+
+		// Approximate when called by a thread other than the owner
+		size_t GetSize() const
+		{
+			auto b = bottom.load(
+				::std::memory_order_relaxed
+			);
+
+			auto t = top.load(
+				::std::memory_order_relaxed
+			);
+
+			return (b > t) ? static_cast<size_t>(b - t) : 0;
+		}
+
+		size_t GetCapacity() const
+		{
+			return static_cast<size_t>(
+				buffer.load(::std::memory_order_relaxed)->Capacity
+			);
+		}
+
+		Bool IsEmpty() const
+		{
+			return GetSize() == 0;
+		}
+
+		// Owner only
+		Void Push(Type value)
+		{
+			auto b = bottom.load(
+				::std::memory_order_relaxed
+			);
+
+			auto t = top.load(
+				::std::memory_order_acquire
+			);
+
+			auto lpBuffer = buffer.load(
+				::std::memory_order_relaxed
+			);
+
+			if ((b - t) > (lpBuffer->Capacity - 1))
+			{
+
+				lpBuffer = Grow(
+					lpBuffer,
+					t,
+					b
+				);
+			}
+
+			lpBuffer->Set(
+				b,
+				value
+			);
+
+			bottom.store(
+				b + 1,
+				::std::memory_order_release
+			);
+		}
+
+		// Owner only
+		// Removes the most recently pushed value
+		Bool Pop(Type& value)
+		{
+			auto b = bottom.load(
+				::std::memory_order_relaxed
+			) - 1;
+
+			auto lpBuffer = buffer.load(
+				::std::memory_order_relaxed
+			);
+
+			// store/load must not be reordered
+			bottom.store(
+				b,
+				::std::memory_order_seq_cst
+			);
+
+			auto t = top.load(
+				::std::memory_order_seq_cst
+			);
+
+			if (t > b)
+			{
+				bottom.store(
+					b + 1,
+					::std::memory_order_relaxed
+				);
+
+				return False;
+			}
+
+			value = lpBuffer->Get(
+				b
+			);
+
+			if (t == b)
+			{
+				// last value, race against Steal
+				auto won = top.compare_exchange_strong(
+					t,
+					t + 1,
+					::std::memory_order_seq_cst,
+					::std::memory_order_relaxed
+				);
+
+				bottom.store(
+					b + 1,
+					::std::memory_order_relaxed
+				);
+
+				if (!won)
+				{
+
+					return False;
+				}
+			}
+
+			return True;
+		}
+
+		// Removes the least recently pushed value
+		// @return AL::False if empty or another thread won the race
+		Bool Steal(Type& value)
+		{
+			auto t = top.load(
+				::std::memory_order_seq_cst
+			);
+
+			auto b = bottom.load(
+				::std::memory_order_seq_cst
+			);
+
+			if (t >= b)
+			{
+
+				return False;
+			}
+
+			auto lpBuffer = buffer.load(
+				::std::memory_order_acquire
+			);
+
+			auto _value = lpBuffer->Get(
+				t
+			);
+
+			if (!top.compare_exchange_strong(t, t + 1, ::std::memory_order_seq_cst, ::std::memory_order_relaxed))
+			{
+
+				return False;
+			}
+
+			value = _value;
+
+			return True;
+		}
+
+	private:
+		static int64 GetBufferCapacity(size_t capacity)
+		{
+			int64 value = 2;
+
+			while (static_cast<size_t>(value) < capacity)
+			{
+				value <<= 1;
+			}
+
+			return value;
+		}
+
+		Buffer* Grow(Buffer* lpBuffer, int64 top, int64 bottom)
+		{
+			auto lpNewBuffer = new Buffer(
+				lpBuffer->Capacity * 2,
+				lpBuffer
+			);
+
+			for (auto i = top; i < bottom; ++i)
+			{
+				lpNewBuffer->Set(
+					i,
+					lpBuffer->Get(i)
+				);
+			}
+
+			buffer.store(
+				lpNewBuffer,
+				::std::memory_order_release
+			);
+
+			return lpNewBuffer;
+		}
+	};
+}
@@ -205,6 +205,7 @@
 #include "Common/GUID.hpp"
 #include "Common/String.hpp"
 #include "Common/StringBuilder.hpp"
+#include "Common/Format.hpp"
 
 #include "Common/Exception.hpp"
 #include "Common/NotImplementedException.hpp"
@@ -221,6 +222,7 @@
 #include "Common/Timestamp.hpp"
 
 #include "Common/Function.hpp"
+#include "Common/UniqueFunction.hpp"
 
 #include "Common/Event.hpp"
 #include "Common/ScheduledEvent.hpp"
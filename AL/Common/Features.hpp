@@ -8,3 +8,7 @@
 #if defined(__cpp_concepts)
 	#define AL_FEATURE_CONCEPTS
 #endif
+
+#if defined(__SSE2__) || defined(AL_ARCH_X86_64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+	#define AL_FEATURE_SSE2
+#endif
@@ -0,0 +1,802 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include <cstdio> // snprintf
+#include <charconv> // std::to_chars
+
+// Format strings use {} placeholders with an optional specification
+// - {:[<|>][0][width][.precision][type]}
+// - Types: d/x/X/o/b for integers, c for characters, f/e/g for decimals, s for strings and p for pointers
+// - {{ and }} are written as { and }
+//
+// Format strings are parsed at compile time and checked against the arguments,
+// a mismatch fails to compile with a call to one of the FormatString_Error_* functions
+
+namespace AL
+{
+	struct FormatSpec
+	{
+		static constexpr uint16 DEFAULT_PRECISION = 0xFFFF;
+		static constexpr uint16 MAXIMUM_PRECISION = 100;
+
+		char   Type      = '\0';
+		char   Align     = '\0';
+		Bool   ZeroPad   = False;
+		uint16 Width     = 0;
+		uint16 Precision = DEFAULT_PRECISION;
+
+		constexpr Bool IsType(const char* lpTypes) const
+		{
+			for (; *lpTypes != '\0'; ++lpTypes)
+			{
+				if (Type == *lpTypes)
+				{
+
+					return True;
+				}
+			}
+
+			return Type == '\0';
+		}
+
+		constexpr Bool HasPrecision() const
+		{
+			return Precision != DEFAULT_PRECISION;
+		}
+	};
+
+	template<typename T>
+	struct __Format_Is_C_String
+	{
+		static constexpr Bool Value = False;
+	};
+	template<>
+	struct __Format_Is_C_String<char*>
+	{
+		static constexpr Bool Value = True;
+	};
+	template<>
+	struct __Format_Is_C_String<const char*>
+	{
+		static constexpr Bool Value = True;
+	};
+	template<size_t S>
+	struct __Format_Is_C_String<char[S]>
+	{
+		static constexpr Bool Value = True;
+	};
+	template<size_t S>
+	struct __Format_Is_C_String<const char[S]>
+	{
+		static constexpr Bool Value = True;
+	};
+
+	// Collects the output on the stack so the destination grows once per call
+	template<typename T_STRING>
+	class __Format_Buffer
+	{
+		static constexpr size_t CAPACITY = 256;
+
+		T_STRING* lpString;
+		size_t    length = 0;
+		char      buffer[CAPACITY];
+
+	public:
+		explicit __Format_Buffer(T_STRING& string)
+			: lpString(
+				&string
+			)
+		{
+		}
+
+		Void Append(const char* lpBuffer, size_t length)
+		{
+			if (length > (CAPACITY - this->length))
+			{
+				Flush();
+
+				if (length >= CAPACITY)
+				{
+					lpString->Append(
+						lpBuffer,
+						length
+					);
+
+					return;
+				}
+			}
+
+			memcpy(
+				&buffer[this->length],
+				lpBuffer,
+				length
+			);
+
+			this->length += length;
+		}
+
+		Void Flush()
+		{
+			if (length != 0)
+			{
+				lpString->Append(
+					&buffer[0],
+					length
+				);
+
+				length = 0;
+			}
+		}
+	};
+
+	// Writes into any T_STRING with Append(const char*, size_t)
+	struct __Format_Utility
+	{
+		// 64 binary digits, sign and 0x
+		static constexpr size_t INTEGER_BUFFER_SIZE = 68;
+		// 309 integer digits, sign, point and MAXIMUM_PRECISION
+		static constexpr size_t DECIMAL_BUFFER_SIZE = 320 + FormatSpec::MAXIMUM_PRECISION;
+
+		template<typename T_STRING>
+		static Void Fill(T_STRING& string, char c, size_t count)
+		{
+			char buffer[16];
+
+			for (auto& _c : buffer)
+			{
+				_c = c;
+			}
+
+			while (count != 0)
+			{
+				auto chunk = (count < sizeof(buffer)) ? count : sizeof(buffer);
+
+				string.Append(
+					&buffer[0],
+					chunk
+				);
+
+				count -= chunk;
+			}
+		}
+
+		// Numbers are aligned right by default and zero padding goes after the sign
+		template<typename T_STRING>
+		static Void Write(T_STRING& string, const char* lpBuffer, size_t length, const FormatSpec& spec, Bool isNumber)
+		{
+			auto padding = (spec.Width > length) ? (spec.Width - length) : 0;
+
+			if (padding == 0)
+			{
+				string.Append(
+					lpBuffer,
+					length
+				);
+
+				return;
+			}
+
+			if (isNumber && spec.ZeroPad && (spec.Align == '\0'))
+			{
+				if ((*lpBuffer == '-') || (*lpBuffer == '+'))
+				{
+					string.Append(
+						lpBuffer,
+						1
+					);
+
+					++lpBuffer;
+					--length;
+				}
+
+				Fill(
+					string,
+					'0',
+					padding
+				);
+
+				string.Append(
+					lpBuffer,
+					length
+				);
+
+				return;
+			}
+
+			auto align = (spec.Align != '\0') ? spec.Align : (isNumber ? '>' : '<');
+
+			if (align == '>')
+			{
+				Fill(
+					string,
+					' ',
+					padding
+				);
+			}
+
+			string.Append(
+				lpBuffer,
+				length
+			);
+
+			if (align == '<')
+			{
+				Fill(
+					string,
+					' ',
+					padding
+				);
+			}
+		}
+
+		template<typename T_STRING>
+		static Void WriteString(T_STRING& string, const char* lpBuffer, size_t length, const FormatSpec& spec)
+		{
+			if (spec.HasPrecision() && (spec.Precision < length))
+			{
+
+				length = spec.Precision;
+			}
+
+			Write(
+				string,
+				lpBuffer,
+				length,
+				spec,
+				False
+			);
+		}
+
+		template<typename T_STRING, typename T>
+		static Void WriteInteger(T_STRING& string, T value, const FormatSpec& spec)
+		{
+			char buffer[INTEGER_BUFFER_SIZE];
+			int  base = 10;
+
+			switch (spec.Type)
+			{
+				case 'x':
+				case 'X':
+				case 'p':
+					base = 16;
+					break;
+
+				case 'o':
+					base = 8;
+					break;
+
+				case 'b':
+					base = 2;
+					break;
+			}
+
+			auto lpBegin = &buffer[0];
+
+			if (spec.Type == 'p')
+			{
+				*lpBegin++ = '0';
+				*lpBegin++ = 'x';
+			}
+
+			auto result = ::std::to_chars(
+				lpBegin,
+				&buffer[INTEGER_BUFFER_SIZE],
+				value,
+				base
+			);
+
+			if (spec.Type == 'X')
+			{
+				for (auto lpChar = lpBegin; lpChar != result.ptr; ++lpChar)
+				{
+					if (*lpChar >= 'a')
+					{
+
+						*lpChar -= 'a' - 'A';
+					}
+				}
+			}
+
+			Write(
+				string,
+				&buffer[0],
+				static_cast<size_t>(result.ptr - &buffer[0]),
+				spec,
+				True
+			);
+		}
+
+		// Without a type or precision the shortest text that reads back to value is written
+		template<typename T_STRING, typename T>
+		static Void WriteDecimal(T_STRING& string, T value, const FormatSpec& spec)
+		{
+			char buffer[DECIMAL_BUFFER_SIZE];
+
+#if defined(__cpp_lib_to_chars)
+			::std::to_chars_result result;
+
+			switch (spec.Type)
+			{
+				case 'f':
+					result = ::std::to_chars(&buffer[0], &buffer[DECIMAL_BUFFER_SIZE], value, ::std::chars_format::fixed, spec.HasPrecision() ? spec.Precision : 6);
+					break;
+
+				case 'e':
+					result = ::std::to_chars(&buffer[0], &buffer[DECIMAL_BUFFER_SIZE], value, ::std::chars_format::scientific, spec.HasPrecision() ? spec.Precision : 6);
+					break;
+
+				case 'g':
+					result = ::std::to_chars(&buffer[0], &buffer[DECIMAL_BUFFER_SIZE], value, ::std::chars_format::general, spec.HasPrecision() ? spec.Precision : 6);
+					break;
+
+				default:
+					result = spec.HasPrecision() ? ::std::to_chars(&buffer[0], &buffer[DECIMAL_BUFFER_SIZE], value, ::std::chars_format::general, spec.Precision) : ::std::to_chars(&buffer[0], &buffer[DECIMAL_BUFFER_SIZE], value);
+					break;
+			}
+
+			auto length = static_cast<size_t>(
+				result.ptr - &buffer[0]
+			);
+#else
+			// without floating point std::to_chars the shortest representation falls back to %g
+			const char* lpFormat;
+
+			switch (spec.Type)
+			{
+				case 'f':
+					lpFormat = "%.*f";
+					break;
+
+				case 'e':
+					lpFormat = "%.*e";
+					break;
+
+				default:
+					lpFormat = "%.*g";
+					break;
+			}
+
+			auto length = static_cast<size_t>(
+				::std::snprintf(&buffer[0], DECIMAL_BUFFER_SIZE, lpFormat, spec.HasPrecision() ? spec.Precision : 6, static_cast<Double>(value))
+			);
+#endif
+
+			Write(
+				string,
+				&buffer[0],
+				length,
+				spec,
+				True
+			);
+		}
+	};
+
+	// Formats T for AL::Format, specialize it to support other types
+	// - Format writes to any T_STRING with Append(const char*, size_t)
+	// - Types without a specialization are written with AL::ToString
+	template<typename T>
+	struct Formatter
+	{
+		// Checked at compile time for every placeholder
+		static constexpr Bool IsValid(const FormatSpec& spec)
+		{
+			if constexpr (Is_Type<T, Bool>::Value)
+			{
+
+				return spec.IsType("s") && !spec.HasPrecision();
+			}
+			else if constexpr (Is_Type<T, char>::Value)
+			{
+
+				return spec.IsType("cdxXob") && !spec.HasPrecision();
+			}
+			else if constexpr (Is_Enum<T>::Value)
+			{
+
+				return spec.IsType("sdxXob") && !spec.HasPrecision();
+			}
+			else if constexpr (Is_Integer<T>::Value)
+			{
+
+				return spec.IsType("dxXob") && !spec.HasPrecision();
+			}
+			else if constexpr (Is_Decimal<T>::Value)
+			{
+
+				return spec.IsType("feg");
+			}
+			else if constexpr (__Format_Is_C_String<T>::Value || Is_Type<T, String>::Value)
+			{
+
+				return spec.IsType("s");
+			}
+			else if constexpr (Is_Pointer<T>::Value)
+			{
+
+				return spec.IsType("p") && !spec.HasPrecision();
+			}
+			else
+			{
+
+				return spec.IsType("s");
+			}
+		}
+
+		template<typename T_STRING>
+		static Void Format(T_STRING& string, const T& value, const FormatSpec& spec)
+		{
+			if constexpr (Is_Type<T, Bool>::Value)
+			{
+				__Format_Utility::WriteString(
+					string,
+					value ? "true" : "false",
+					value ? 4 : 5,
+					spec
+				);
+			}
+			else if constexpr (Is_Type<T, char>::Value)
+			{
+				if (spec.IsType("c"))
+				{
+					__Format_Utility::WriteString(
+						string,
+						&value,
+						1,
+						spec
+					);
+				}
+				else
+				{
+					__Format_Utility::WriteInteger(
+						string,
+						static_cast<int>(value),
+						spec
+					);
+				}
+			}
+			else if constexpr (Is_Enum<T>::Value)
+			{
+				if (spec.IsType("s"))
+				{
+					auto _string = ToString<T>(
+						value
+					);
+
+					__Format_Utility::WriteString(
+						string,
+						_string.GetCString(),
+						_string.GetLength(),
+						spec
+					);
+				}
+				else
+				{
+					__Format_Utility::WriteInteger(
+						string,
+						static_cast<typename Get_Enum_Or_Integer_Base<T>::Type>(value),
+						spec
+					);
+				}
+			}
+			else if constexpr (Is_Integer<T>::Value)
+			{
+				__Format_Utility::WriteInteger(
+					string,
+					value,
+					spec
+				);
+			}
+			else if constexpr (Is_Decimal<T>::Value)
+			{
+				__Format_Utility::WriteDecimal(
+					string,
+					value,
+					spec
+				);
+			}
+			else if constexpr (__Format_Is_C_String<T>::Value)
+			{
+				__Format_Utility::WriteString(
+					string,
+					&value[0],
+					String::GetLength(&value[0]),
+					spec
+				);
+			}
+			else if constexpr (Is_Type<T, String>::Value)
+			{
+				__Format_Utility::WriteString(
+					string,
+					value.GetCString(),
+					value.GetLength(),
+					spec
+				);
+			}
+			else if constexpr (Is_Pointer<T>::Value)
+			{
+				FormatSpec _spec = spec;
+				_spec.Type       = 'p';
+
+				__Format_Utility::WriteInteger(
+					string,
+					reinterpret_cast<typename Get_Pointer_Base::Type>(value),
+					_spec
+				);
+			}
+			else
+			{
+				auto _string = ToString<T>(
+					value
+				);
+
+				__Format_Utility::WriteString(
+					string,
+					_string.GetCString(),
+					_string.GetLength(),
+					spec
+				);
+			}
+		}
+	};
+
+	// Never constexpr so an invalid format string fails to compile where it is used
+	inline Void FormatString_Error_Argument_Count_Mismatch()
+	{
+	}
+	inline Void FormatString_Error_Unmatched_Brace()
+	{
+	}
+	inline Void FormatString_Error_Invalid_Specification()
+	{
+	}
+	inline Void FormatString_Error_Specification_Not_Supported_By_Argument()
+	{
+	}
+
+	// Format string parsed at compile time into literal segments and placeholder specifications
+	template<typename ... TArgs>
+	class FormatString
+	{
+		static constexpr size_t ARGUMENT_COUNT = sizeof ...(TArgs);
+
+		struct Segment
+		{
+			uint32 Offset    = 0;
+			uint32 Length    = 0;
+			Bool   IsEscaped = False;
+		};
+
+		const char* lpFormat;
+		Segment     segments[ARGUMENT_COUNT + 1];
+		FormatSpec  specs[ARGUMENT_COUNT + 1];
+
+	public:
+		template<size_t S>
+		consteval FormatString(const char(&format)[S])
+			: lpFormat(
+				&format[0]
+			)
+		{
+			Parse(
+				&format[0],
+				S - 1
+			);
+		}
+
+		template<typename T_STRING>
+		Void Write(T_STRING& string, const TArgs& ... args) const
+		{
+			__Format_Buffer<T_STRING> buffer(
+				string
+			);
+
+			[[maybe_unused]] size_t i = 0;
+
+			((WriteSegment(buffer, segments[i]), Formatter<TArgs>::Format(buffer, args, specs[i]), ++i), ...);
+
+			WriteSegment(
+				buffer,
+				segments[ARGUMENT_COUNT]
+			);
+
+			buffer.Flush();
+		}
+
+	private:
+		consteval Void Parse(const char* lpBuffer, size_t length)
+		{
+			size_t argument = 0;
+			size_t offset   = 0;
+			Bool   escaped  = False;
+
+			for (size_t i = 0; i < length; ++i)
+			{
+				if (lpBuffer[i] == '}')
+				{
+					if (((i + 1) == length) || (lpBuffer[i + 1] != '}'))
+					{
+
+						FormatString_Error_Unmatched_Brace();
+					}
+
+					escaped = True;
+
+					++i;
+				}
+				else if (lpBuffer[i] == '{')
+				{
+					if (((i + 1) < length) && (lpBuffer[i + 1] == '{'))
+					{
+						escaped = True;
+
+						++i;
+
+						continue;
+					}
+
+					if (argument == ARGUMENT_COUNT)
+					{
+
+						FormatString_Error_Argument_Count_Mismatch();
+					}
+
+					segments[argument] = Segment
+					{
+						.Offset    = static_cast<uint32>(offset),
+						.Length    = static_cast<uint32>(i - offset),
+						.IsEscaped = escaped
+					};
+
+					i = ParseSpec(
+						lpBuffer,
+						length,
+						i + 1,
+						specs[argument++]
+					);
+
+					offset  = i + 1;
+					escaped = False;
+				}
+			}
+
+			if (argument != ARGUMENT_COUNT)
+			{
+
+				FormatString_Error_Argument_Count_Mismatch();
+			}
+
+			segments[ARGUMENT_COUNT] = Segment
+			{
+				.Offset    = static_cast<uint32>(offset),
+				.Length    = static_cast<uint32>(length - offset),
+				.IsEscaped = escaped
+			};
+
+			[[maybe_unused]] size_t i = 0;
+
+			if (!(Formatter<TArgs>::IsValid(specs[i++]) && ...))
+			{
+
+				FormatString_Error_Specification_Not_Supported_By_Argument();
+			}
+		}
+
+		// @return index of the closing brace
+		static consteval size_t ParseSpec(const char* lpBuffer, size_t length, size_t i, FormatSpec& spec)
+		{
+			if ((i < length) && (lpBuffer[i] == ':'))
+			{
+				if ((++i < length) && ((lpBuffer[i] == '<') || (lpBuffer[i] == '>')))
+				{
+
+					spec.Align = lpBuffer[i++];
+				}
+
+				if ((i < length) && (lpBuffer[i] == '0'))
+				{
+					spec.ZeroPad = True;
+
+					++i;
+				}
+
+				for (; (i < length) && (lpBuffer[i] >= '0') && (lpBuffer[i] <= '9'); ++i)
+				{
+
+					spec.Width = static_cast<uint16>((spec.Width * 10) + (lpBuffer[i] - '0'));
+				}
+
+				if ((i < length) && (lpBuffer[i] == '.'))
+				{
+					spec.Precision = 0;
+
+					for (++i; (i < length) && (lpBuffer[i] >= '0') && (lpBuffer[i] <= '9'); ++i)
+					{
+						if ((spec.Precision = static_cast<uint16>((spec.Precision * 10) + (lpBuffer[i] - '0'))) > FormatSpec::MAXIMUM_PRECISION)
+						{
+
+							FormatString_Error_Invalid_Specification();
+						}
+					}
+				}
+
+				if ((i < length) && (lpBuffer[i] != '}'))
+				{
+
+					spec.Type = lpBuffer[i++];
+				}
+			}
+
+			if ((i == length) || (lpBuffer[i] != '}'))
+			{
+
+				FormatString_Error_Invalid_Specification();
+			}
+
+			return i;
+		}
+
+		template<typename T_STRING>
+		Void WriteSegment(T_STRING& string, const Segment& segment) const
+		{
+			auto lpBegin = &lpFormat[segment.Offset];
+			auto lpEnd   = lpBegin + segment.Length;
+
+			if (!segment.IsEscaped)
+			{
+				string.Append(
+					lpBegin,
+					segment.Length
+				);
+
+				return;
+			}
+
+			// {{ and }} are written as their first brace
+			for (auto lpChar = lpBegin; lpChar != lpEnd; ++lpChar)
+			{
+				if ((*lpChar == '{') || (*lpChar == '}'))
+				{
+					++lpChar;
+
+					string.Append(
+						lpBegin,
+						static_cast<size_t>(lpChar - lpBegin)
+					);
+
+					lpBegin = lpChar + 1;
+				}
+			}
+
+			string.Append(
+				lpBegin,
+				static_cast<size_t>(lpEnd - lpBegin)
+			);
+		}
+	};
+
+	template<typename ... TArgs>
+	using Format_String = FormatString<typename Type_Identity<TArgs>::Type ...>;
+
+	// Appends the formatted arguments to string (String or StringBuilder)
+	template<typename T_STRING, typename ... TArgs>
+	inline Void FormatTo(T_STRING& string, Format_String<TArgs ...> format, const TArgs& ... args)
+	{
+		format.Write(
+			string,
+			args ...
+		);
+	}
+
+	template<typename ... TArgs>
+	inline String Format(Format_String<TArgs ...> format, const TArgs& ... args)
+	{
+		String string;
+
+		format.Write(
+			string,
+			args ...
+		);
+
+		return string;
+	}
+}
@@ -1,41 +1,42 @@
 #pragma once
 #include "AL/Common.hpp"
 
+#include <new> // placement new
+#include <cstddef> // max_align_t
+
+// Callables up to this size (including the vtable pointer) are stored inside the Function
+#if !defined(AL_FUNCTION_INLINE_SIZE)
+	#define AL_FUNCTION_INLINE_SIZE (sizeof(AL::Void*) * 6)
+#endif
+
 namespace AL
 {
-	template<typename F>
-	class Function;
+	// Storage shared by Function and UniqueFunction
+	// - Callables are stored inline when they fit in AL_FUNCTION_INLINE_SIZE, otherwise on the heap
+	template<Bool IS_COPYABLE, typename F>
+	class FunctionBase;
 
-	template<typename T, typename ... TArgs>
-	class Function<T(TArgs ...)>
+	template<Bool IS_COPYABLE, typename T, typename ... TArgs>
+	class FunctionBase<IS_COPYABLE, T(TArgs ...)>
 	{
+		static constexpr size_t INLINE_SIZE = AL_FUNCTION_INLINE_SIZE;
+
 		class ILambda
 		{
 		public:
-			template<typename F>
-			static ILambda* Create(F&& function)
-			{
-				auto lpLambda = new Lambda<F>(
-					Move(function)
-				);
-
-				return lpLambda;
-			}
-
-			static Void Destroy(ILambda* lpLambda)
-			{
-				delete lpLambda;
-			}
-
 			virtual ~ILambda()
 			{
 			}
 
 			virtual uint32 GetHash() const = 0;
 
-			virtual ILambda* Copy() const = 0;
+			// Only called when IS_COPYABLE
+			virtual ILambda* Copy(Void* lpStorage) const = 0;
 
-			virtual T Execute(TArgs ... args) const = 0;
+			// Only called on lambdas stored inline
+			virtual ILambda* Move(Void* lpStorage) = 0;
+
+			virtual T Execute(TArgs ... args) = 0;
 		};
 
 		template<typename F>
@@ -48,9 +49,33 @@ namespace AL
 			Lambda(const Lambda&) = delete;
 
 		public:
+			static constexpr Bool IsInline =
+				(sizeof(Lambda) <= INLINE_SIZE) &&
+				(alignof(Lambda) <= alignof(::std::max_align_t)) &&
+				::std::is_nothrow_move_constructible<F>::value;
+
+			template<typename _F>
+			static ILambda* Create(Void* lpStorage, _F&& function)
+			{
+				if constexpr (IsInline)
+				{
+
+					return new (lpStorage) Lambda(
+						Forward<_F>(function)
+					);
+				}
+				else
+				{
+
+					return new Lambda(
+						Forward<_F>(function)
+					);
+				}
+			}
+
 			explicit Lambda(F&& function)
 				: function(
-					Move(function)
+					AL::Move(function)
 				)
 			{
 			}
@@ -67,132 +92,250 @@ namespace AL
 				return Type<F>::Hash;
 			}
 
-			virtual ILambda* Copy() const override
+			virtual ILambda* Copy(Void* lpStorage) const override
 			{
-				return new Lambda<F>(
-					function
-				);
+				if constexpr (IS_COPYABLE)
+				{
+
+					return Create(
+						lpStorage,
+						function
+					);
+				}
+				else
+				{
+
+					return nullptr;
+				}
 			}
 
-			virtual T Execute(TArgs ... args) const override
+			virtual ILambda* Move(Void* lpStorage) override
 			{
-				return function(
-					Forward<TArgs>(args) ...
+				return new (lpStorage) Lambda(
+					AL::Move(function)
 				);
 			}
+
+			virtual T Execute(TArgs ... args) override
+			{
+				// Function is invoked through a const reference
+				if constexpr (IS_COPYABLE)
+				{
+
+					return static_cast<const F&>(function)(
+						Forward<TArgs>(args) ...
+					);
+				}
+				else
+				{
+
+					return function(
+						Forward<TArgs>(args) ...
+					);
+				}
+			}
 		};
 
 		ILambda* lpLambda;
+		alignas(::std::max_align_t) uint8 storage[INLINE_SIZE];
+
+		FunctionBase(FunctionBase&&) = delete;
+		FunctionBase(const FunctionBase&) = delete;
 
 	public:
-		Function()
+		FunctionBase()
 			: lpLambda(
 				nullptr
 			)
 		{
 		}
 
-		Function(Function&& function)
-			: lpLambda(
-				function.lpLambda
-			)
+		virtual ~FunctionBase()
 		{
-			function.lpLambda = nullptr;
+			Unbind();
 		}
-		Function(const Function& function)
-			: lpLambda(
-				function.lpLambda ? function.lpLambda->Copy() : nullptr
-			)
+
+		Bool IsBound() const
 		{
+			return lpLambda != nullptr;
 		}
 
-		template<typename F>
-		explicit Function(F&& function)
-			: lpLambda(
-				ILambda::Create(
-					Move(function)
-				)
-			)
+		// Bound callable is stored in the function rather than on the heap
+		Bool IsInline() const
 		{
+			return reinterpret_cast<const Void*>(lpLambda) == &storage[0];
 		}
-		explicit Function(T(*lpFunction)(TArgs ...))
-			: lpLambda(
-				ILambda::Create(
-					[lpFunction](TArgs ... _args)
-					{
-						return lpFunction(
-							Forward<TArgs>(_args) ...
-						);
-					}
-				)
-			)
+
+		auto GetHash() const
 		{
+			return lpLambda ? lpLambda->GetHash() : Type<T(TArgs ...)>::Hash;
 		}
-		template<typename C>
-		Function(T(C::*lpFunction)(TArgs ...), C& instance)
-			: lpLambda(
-				ILambda::Create(
-					[lpInstance = &instance, lpFunction](TArgs ... _args)
-					{
-						return (lpInstance->*lpFunction)(
-							Forward<TArgs>(_args) ...
-						);
-					}
-				)
-			)
+
+		Void Unbind()
 		{
+			if (IsBound())
+			{
+				if (IsInline())
+				{
+
+					lpLambda->~ILambda();
+				}
+				else
+				{
+
+					delete lpLambda;
+				}
+
+				lpLambda = nullptr;
+			}
 		}
-		template<typename C>
-		Function(T(C::*lpFunction)(TArgs ...) const, const C& instance)
-			: lpLambda(
-				ILambda::Create(
-					[lpInstance = &instance, lpFunction](TArgs ... _args)
-					{
-						return (lpInstance->*lpFunction)(
-							Forward<TArgs>(_args) ...
-						);
-					}
-				)
-			)
+
+		operator Bool () const
 		{
+			return IsBound();
 		}
 
-		virtual ~Function()
+	protected:
+		// this must be unbound
+		template<typename F>
+		Void Create(F&& function)
+		{
+			typedef typename Remove_Const<typename Remove_Reference<F>::Type>::Type _F;
+
+			lpLambda = Lambda<_F>::Create(
+				&storage[0],
+				Forward<F>(function)
+			);
+		}
+
+		// this must be unbound
+		Void Assign(const FunctionBase& function)
 		{
-			if (lpLambda != nullptr)
+			static_assert(
+				IS_COPYABLE,
+				"Function is not copyable"
+			);
+
+			lpLambda = function.lpLambda ? function.lpLambda->Copy(&storage[0]) : nullptr;
+		}
+		// this must be unbound
+		Void Assign(FunctionBase&& function)
+		{
+			if (function.IsInline())
 			{
-				ILambda::Destroy(
-					lpLambda
+				lpLambda = function.lpLambda->Move(
+					&storage[0]
 				);
 
-				lpLambda = nullptr;
+				function.Unbind();
+			}
+			else
+			{
+				lpLambda = function.lpLambda;
+				function.lpLambda = nullptr;
 			}
 		}
 
-		Bool IsBound() const
+		T Execute(TArgs ... args) const
 		{
-			return lpLambda != nullptr;
+			return lpLambda->Execute(
+				Forward<TArgs>(args) ...
+			);
 		}
 
-		auto GetHash() const
+		Bool Equals(const FunctionBase& function) const
+		{
+			if (lpLambda && function.lpLambda)
+			{
+
+				return GetHash() == function.GetHash();
+			}
+
+			return !lpLambda && !function.lpLambda;
+		}
+	};
+
+	template<typename F>
+	class Function;
+
+	template<typename T, typename ... TArgs>
+	class Function<T(TArgs ...)>
+		: public FunctionBase<True, T(TArgs ...)>
+	{
+		typedef FunctionBase<True, T(TArgs ...)> _Base;
+
+	public:
+		Function()
+		{
+		}
+
+		Function(Function&& function)
+		{
+			_Base::Assign(
+				Move(function)
+			);
+		}
+		Function(const Function& function)
+		{
+			_Base::Assign(
+				function
+			);
+		}
+
+		template<typename F>
+		explicit Function(F&& function)
+		{
+			Bind(
+				Forward<F>(function)
+			);
+		}
+		explicit Function(T(*lpFunction)(TArgs ...))
+		{
+			Bind(
+				lpFunction
+			);
+		}
+		template<typename C>
+		Function(T(C::*lpFunction)(TArgs ...), C& instance)
+		{
+			Bind(
+				lpFunction,
+				instance
+			);
+		}
+		template<typename C>
+		Function(T(C::*lpFunction)(TArgs ...) const, const C& instance)
+		{
+			Bind(
+				lpFunction,
+				instance
+			);
+		}
+
+		virtual ~Function()
 		{
-			return lpLambda ? lpLambda->GetHash() : Type<T(TArgs ...)>::Hash;
 		}
 
 		template<typename F>
 		Void Bind(F&& function)
 		{
-			if (lpLambda != nullptr)
+			typedef typename Remove_Const<typename Remove_Reference<F>::Type>::Type _F;
+
+			if constexpr (Is_Type<_F, Function>::Value)
 			{
 
-				ILambda::Destroy(
-					lpLambda
+				operator=(
+					Forward<F>(function)
 				);
 			}
+			else
+			{
+				_Base::Unbind();
 
-			lpLambda = ILambda::Create(
-				Move(function)
-			);
+				_Base::Create(
+					Forward<F>(function)
+				);
+			}
 		}
 		Void Bind(T(*lpFunction)(TArgs ...))
 		{
@@ -230,67 +373,45 @@ namespace AL
 			);
 		}
 
-		Void Unbind()
-		{
-			if (IsBound())
-			{
-				delete lpLambda;
-
-				lpLambda = nullptr;
-			}
-		}
-
-		operator Bool () const
-		{
-			return IsBound();
-		}
-
 		T operator () (TArgs ... args) const
 		{
-			return lpLambda->Execute(
+			return _Base::Execute(
 				Forward<TArgs>(args) ...
 			);
 		}
 
 		Function& operator = (Function&& function)
 		{
-			if (IsBound())
+			if (&function != this)
 			{
+				_Base::Unbind();
 
-				ILambda::Destroy(
-					lpLambda
+				_Base::Assign(
+					Move(function)
 				);
 			}
 
-			lpLambda = function.lpLambda;
-			function.lpLambda = nullptr;
-
 			return *this;
 		}
 		Function& operator = (const Function& function)
 		{
-			if (lpLambda)
+			if (&function != this)
 			{
+				_Base::Unbind();
 
-				ILambda::Destroy(
-					lpLambda
+				_Base::Assign(
+					function
 				);
 			}
 
-			lpLambda = function.lpLambda ? function.lpLambda->Copy() : nullptr;
-
 			return *this;
 		}
 
 		Bool operator == (const Function& function) const
 		{
-			if (lpLambda && function.lpLambda)
-			{
-
-				return GetHash() == function.GetHash();
-			}
-
-			return !lpLambda && !function.lpLambda;
+			return _Base::Equals(
+				function
+			);
 		}
 		Bool operator != (const Function& function) const
 		{
@@ -0,0 +1,580 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "AL/OS/Mutex.hpp"
+#include "AL/OS/ConditionVariable.hpp"
+
+#include <new> // placement new
+#include <atomic>
+#include <utility> // declval
+
+namespace AL
+{
+	template<typename T>
+	class Future;
+
+	template<typename T>
+	class Promise;
+
+	// Shared by a Promise and its Future
+	template<typename T>
+	class FutureState
+	{
+		typedef typename Conditional<Is_Type<T, Void>::Value, Bool, T>::Type _Type;
+
+		friend Future<T>;
+		friend Promise<T>;
+
+		::std::atomic<size_t>  referenceCount;
+
+		OS::Mutex              mutex;
+		OS::ConditionVariable  condition;
+
+		Bool                   isReady;
+		Bool                   isValueSet;
+		Exception*             lpException;
+		UniqueFunction<Void()> continuation;
+
+		alignas(_Type) uint8   value[sizeof(_Type)];
+
+		FutureState(FutureState&&) = delete;
+		FutureState(const FutureState&) = delete;
+
+	public:
+		FutureState()
+			: referenceCount(
+				1
+			),
+			isReady(
+				False
+			),
+			isValueSet(
+				False
+			),
+			lpException(
+				nullptr
+			)
+		{
+		}
+
+		virtual ~FutureState()
+		{
+			if (isValueSet)
+			{
+
+				GetValue().~_Type();
+			}
+
+			if (lpException != nullptr)
+			{
+
+				delete lpException;
+			}
+		}
+
+		Void AddReference()
+		{
+			referenceCount.fetch_add(
+				1,
+				::std::memory_order_relaxed
+			);
+		}
+
+		Void Release()
+		{
+			if (referenceCount.fetch_sub(1, ::std::memory_order_acq_rel) == 1)
+			{
+
+				delete this;
+			}
+		}
+
+		Bool IsReady()
+		{
+			OS::MutexGuard lock(
+				mutex
+			);
+
+			return isReady;
+		}
+
+		// @throw AL::Exception
+		Void Wait()
+		{
+			OS::MutexGuard lock(
+				mutex
+			);
+
+			while (!isReady)
+			{
+				condition.Sleep(
+					mutex
+				);
+			}
+		}
+		// @throw AL::Exception
+		// @return AL::False on timeout
+		Bool Wait(TimeSpan timeout)
+		{
+			OS::MutexGuard lock(
+				mutex
+			);
+
+			OS::Timer timer;
+
+			while (!isReady)
+			{
+				auto elapsed = timer.GetElapsed();
+
+				if ((elapsed >= timeout) || !condition.Sleep(mutex, timeout - elapsed))
+				{
+
+					return isReady;
+				}
+			}
+
+			return True;
+		}
+
+		_Type& GetValue()
+		{
+			return *reinterpret_cast<_Type*>(
+				&value[0]
+			);
+		}
+
+		template<typename ... TArgs>
+		Void SetValue(TArgs&& ... args)
+		{
+			new (&value[0]) _Type(
+				Forward<TArgs>(args) ...
+			);
+
+			isValueSet = True;
+
+			Complete();
+		}
+
+		Void SetException(Exception&& exception)
+		{
+			lpException = new Exception(
+				Move(exception)
+			);
+
+			Complete();
+		}
+
+		// Called by the thread that completes the state or immediately if already completed
+		Void SetContinuation(UniqueFunction<Void()>&& function)
+		{
+			{
+				OS::MutexGuard lock(
+					mutex
+				);
+
+				if (!isReady)
+				{
+					continuation = Move(
+						function
+					);
+
+					return;
+				}
+			}
+
+			function();
+		}
+
+	private:
+		Void Complete()
+		{
+			UniqueFunction<Void()> _continuation;
+
+			{
+				OS::MutexGuard lock(
+					mutex
+				);
+
+				isReady = True;
+
+				condition.WakeAll();
+
+				_continuation = Move(
+					continuation
+				);
+			}
+
+			if (_continuation)
+			{
+
+				_continuation();
+			}
+		}
+	};
+
+	// Result of an asynchronous operation
+	// - Move only; Then consumes the Future
+	template<typename T>
+	class Future
+	{
+		friend Promise<T>;
+
+		template<typename>
+		friend class Future;
+
+		FutureState<T>* lpState;
+
+		explicit Future(FutureState<T>* lpState)
+			: lpState(
+				lpState
+			)
+		{
+			lpState->AddReference();
+		}
+
+		Future(const Future&) = delete;
+
+	public:
+		typedef T Type;
+
+		Future()
+			: lpState(
+				nullptr
+			)
+		{
+		}
+
+		Future(Future&& future)
+			: lpState(
+				future.lpState
+			)
+		{
+			future.lpState = nullptr;
+		}
+
+		virtual ~Future()
+		{
+			if (lpState != nullptr)
+			{
+
+				lpState->Release();
+			}
+		}
+
+		Bool IsValid() const
+		{
+			return lpState != nullptr;
+		}
+
+		Bool IsReady() const
+		{
+			AL_ASSERT(
+				IsValid(),
+				"Future not valid"
+			);
+
+			return lpState->IsReady();
+		}
+
+		// @throw AL::Exception
+		Void Wait() const
+		{
+			AL_ASSERT(
+				IsValid(),
+				"Future not valid"
+			);
+
+			lpState->Wait();
+		}
+		// @throw AL::Exception
+		// @return AL::False on timeout
+		Bool Wait(TimeSpan timeout) const
+		{
+			AL_ASSERT(
+				IsValid(),
+				"Future not valid"
+			);
+
+			if (!lpState->Wait(timeout))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+
+		// Waits for the result
+		// @throw AL::Exception if the operation threw
+		decltype(auto) Get()
+		{
+			Wait();
+
+			if (auto lpException = lpState->lpException)
+			{
+
+				// the exception is kept for the next Get
+				throw CopyException(
+					*lpException
+				);
+			}
+
+			if constexpr (!Is_Type<T, Void>::Value)
+			{
+
+				return static_cast<T&>(
+					lpState->GetValue()
+				);
+			}
+		}
+
+		// Calls function with the result once ready
+		// - function is called by the thread that completes this Future, or immediately if already completed
+		// - exceptions thrown by this Future or function are forwarded to the returned Future
+		template<typename F>
+		auto Then(F&& function)
+		{
+			typedef typename Remove_Const<typename Remove_Reference<F>::Type>::Type _F;
+
+			typedef typename Remove_Const<typename Remove_Reference<decltype(InvokeContinuation(::std::declval<_F&>(), ::std::declval<FutureState<T>&>()))>::Type>::Type _T;
+
+			AL_ASSERT(
+				IsValid(),
+				"Future not valid"
+			);
+
+			Promise<_T> promise;
+			auto        future = promise.GetFuture();
+
+			auto lpState = this->lpState;
+			this->lpState = nullptr;
+
+			lpState->SetContinuation(
+				UniqueFunction<Void()>(
+					[lpState, promise = Move(promise), function = _F(Forward<F>(function))]() mutable
+					{
+						if (auto lpException = lpState->lpException)
+						{
+							lpState->lpException = nullptr;
+
+							promise.SetException(
+								Move(*lpException)
+							);
+
+							delete lpException;
+						}
+						else
+						{
+							try
+							{
+								if constexpr (Is_Type<_T, Void>::Value)
+								{
+									InvokeContinuation(
+										function,
+										*lpState
+									);
+
+									promise.SetValue();
+								}
+								else
+								{
+
+									promise.SetValue(
+										InvokeContinuation(
+											function,
+											*lpState
+										)
+									);
+								}
+							}
+							catch (Exception& exception)
+							{
+
+								promise.SetException(
+									Move(exception)
+								);
+							}
+						}
+
+						lpState->Release();
+					}
+				)
+			);
+
+			return future;
+		}
+
+		Future& operator = (Future&& future)
+		{
+			if (&future != this)
+			{
+				if (lpState != nullptr)
+				{
+
+					lpState->Release();
+				}
+
+				lpState = future.lpState;
+				future.lpState = nullptr;
+			}
+
+			return *this;
+		}
+
+	private:
+		static Exception CopyException(const Exception& exception)
+		{
+			if (auto lpInnerException = exception.GetInnerException())
+			{
+
+				return Exception(
+					CopyException(*lpInnerException),
+					String(exception.GetMessage())
+				);
+			}
+
+			return Exception(
+				String(exception.GetMessage())
+			);
+		}
+
+		template<typename F>
+		static decltype(auto) InvokeContinuation(F& function, FutureState<T>& state)
+		{
+			if constexpr (Is_Type<T, Void>::Value)
+			{
+
+				return function();
+			}
+			else
+			{
+
+				return function(
+					Move(state.GetValue())
+				);
+			}
+		}
+	};
+
+	// Producer side of a Future
+	// - Destroying a Promise without setting it completes the Future with an exception
+	template<typename T>
+	class Promise
+	{
+		FutureState<T>* lpState;
+		Bool            isFutureRetrieved;
+
+		Promise(const Promise&) = delete;
+
+	public:
+		typedef T Type;
+
+		Promise()
+			: lpState(
+				new FutureState<T>()
+			),
+			isFutureRetrieved(
+				False
+			)
+		{
+		}
+
+		Promise(Promise&& promise)
+			: lpState(
+				promise.lpState
+			),
+			isFutureRetrieved(
+				promise.isFutureRetrieved
+			)
+		{
+			promise.lpState = nullptr;
+		}
+
+		virtual ~Promise()
+		{
+			if (lpState != nullptr)
+			{
+				if (!lpState->isReady)
+				{
+
+					lpState->SetException(
+						Exception("Promise broken")
+					);
+				}
+
+				lpState->Release();
+			}
+		}
+
+		// May only be called once
+		Future<T> GetFuture()
+		{
+			AL_ASSERT(
+				lpState != nullptr,
+				"Promise not valid"
+			);
+
+			AL_ASSERT(
+				!isFutureRetrieved,
+				"Future already retrieved"
+			);
+
+			isFutureRetrieved = True;
+
+			return Future<T>(
+				lpState
+			);
+		}
+
+		template<typename ... TArgs>
+		Void SetValue(TArgs&& ... args)
+		{
+			AL_ASSERT(
+				(lpState != nullptr) && !lpState->isReady,
+				"Promise already set"
+			);
+
+			lpState->SetValue(
+				Forward<TArgs>(args) ...
+			);
+		}
+
+		Void SetException(Exception&& exception)
+		{
+			AL_ASSERT(
+				(lpState != nullptr) && !lpState->isReady,
+				"Promise already set"
+			);
+
+			lpState->SetException(
+				Move(exception)
+			);
+		}
+
+		Promise& operator = (Promise&& promise)
+		{
+			if (&promise != this)
+			{
+				if (lpState != nullptr)
+				{
+					if (!lpState->isReady)
+					{
+
+						lpState->SetException(
+							Exception("Promise broken")
+						);
+					}
+
+					lpState->Release();
+				}
+
+				lpState           = promise.lpState;
+				isFutureRetrieved = promise.isFutureRetrieved;
+
+				promise.lpState = nullptr;
+			}
+
+			return *this;
+		}
+	};
+}
@@ -1,8 +1,14 @@
 #pragma once
 #include "AL/Common.hpp"
 
+#include "AL/Collections/HashDictionary.hpp"
+
 #include <regex>
 
+#if !defined(AL_PLATFORM_PICO)
+	#include <mutex>
+#endif
+
 namespace AL
 {
 	template<typename F>
@@ -25,7 +31,7 @@ namespace AL
 		// @throw AL::Exception
 		static Bool IsMatch(const String& pattern, const String& buffer)
 		{
-			if (!_Regex(pattern).IsMatch(buffer))
+			if (!FromCache(pattern).IsMatch(buffer))
 			{
 
 				return False;
@@ -37,7 +43,7 @@ namespace AL
 		// @throw AL::Exception
 		static Bool Match(MatchCollection& match, const String& pattern, const String& buffer)
 		{
-			if (!_Regex(pattern).Match(match, buffer))
+			if (!FromCache(pattern).Match(match, buffer))
 			{
 
 				return False;
@@ -49,7 +55,7 @@ namespace AL
 		template<size_t S>
 		static Bool Match(MatchCollection& match, const Char(&pattern)[S], const String& buffer)
 		{
-			if (!_Regex(pattern).Match(match, buffer))
+			if (!FromCache(String(pattern, S - 1)).Match(match, buffer))
 			{
 
 				return False;
@@ -61,7 +67,7 @@ namespace AL
 		// @throw AL::Exception
 		static Bool MatchAll(const MatchAllCallback& callback, const String& pattern, const String& buffer)
 		{
-			if (!_Regex(pattern).MatchAll(callback, buffer))
+			if (!FromCache(pattern).MatchAll(callback, buffer))
 			{
 
 				return False;
@@ -73,7 +79,7 @@ namespace AL
 		template<size_t S>
 		static Bool MatchAll(const MatchAllCallback& callback, const Char(&pattern)[S], const String& buffer)
 		{
-			if (!_Regex(pattern).MatchAll(callback, buffer))
+			if (!FromCache(String(pattern, S - 1)).MatchAll(callback, buffer))
 			{
 
 				return False;
@@ -85,23 +91,10 @@ namespace AL
 		// @throw AL::Exception
 		_Regex(const String& pattern)
 			: regex(
-				[&pattern]()
-				{
-					try
-					{
-						return Regex(
-							pattern.GetCString(),
-							pattern.GetLength()
-						);
-					}
-					catch (const ::std::regex_error& error)
-					{
-
-						throw Exception(
-							error.what()
-						);
-					}
-				}()
+				Compile(
+					pattern.GetCString(),
+					pattern.GetLength()
+				)
 			)
 		{
 		}
@@ -110,23 +103,10 @@ namespace AL
 		template<size_t S>
 		_Regex(const Char(&pattern)[S])
 			: regex(
-				[pattern]()
-				{
-					try
-					{
-						return Regex(
-							&pattern[0],
-							S - 1
-						);
-					}
-					catch (const ::std::regex_error& error)
-					{
-
-						throw Exception(
-							error.what()
-						);
-					}
-				}()
+				Compile(
+					&pattern[0],
+					S - 1
+				)
 			)
 		{
 		}
@@ -237,9 +217,10 @@ namespace AL
 			return True;
 		}
 
+		// @throw AL::Exception
 		auto& operator = (const String& pattern)
 		{
-			regex = Regex(
+			regex = Compile(
 				pattern.GetCString(),
 				pattern.GetLength()
 			);
@@ -267,8 +248,246 @@ namespace AL
 
 			return True;
 		}
+
+	private:
+		// Process wide cache of compiled patterns used by the static helpers
+		// - The least recently used pattern is evicted once CAPACITY is reached
+		// - Copies of a compiled pattern share the same automaton
+		class Cache
+		{
+			static constexpr size_t CAPACITY = 64;
+
+			struct Entry
+			{
+				Regex  Value;
+				uint64 LastUsed;
+			};
+
+			uint64                                     clock = 0;
+			Collections::HashDictionary<String, Entry> entries;
+#if !defined(AL_PLATFORM_PICO)
+			::std::mutex                               mutex;
+#endif
+
+			Cache(Cache&&) = delete;
+			Cache(const Cache&) = delete;
+
+			Cache()
+			{
+			}
+
+		public:
+			static Cache& GetInstance()
+			{
+				static Cache cache;
+
+				return cache;
+			}
+
+			// @throw AL::Exception
+			Regex Get(const String& pattern)
+			{
+#if defined(AL_PLATFORM_PICO)
+				// avoids keeping compiled patterns on the heap
+
+				return Compile(
+					pattern.GetCString(),
+					pattern.GetLength()
+				);
+#else
+				{
+					::std::lock_guard<::std::mutex> lock(mutex);
+
+					if (auto it = entries.Find(pattern); it != entries.end())
+					{
+						it->Value.LastUsed = ++clock;
+
+						return it->Value.Value;
+					}
+				}
+
+				// compiling outside of the lock may compile the same pattern twice but never blocks other patterns
+				auto regex = Compile(
+					pattern.GetCString(),
+					pattern.GetLength()
+				);
+
+				{
+					::std::lock_guard<::std::mutex> lock(mutex);
+
+					if ((entries.GetSize() >= CAPACITY) && !entries.Contains(pattern))
+					{
+
+						Evict();
+					}
+
+					entries.Add(
+						pattern,
+						Entry
+						{
+							.Value    = regex,
+							.LastUsed = ++clock
+						}
+					);
+				}
+
+				return regex;
+#endif
+			}
+
+		private:
+			Void Evict()
+			{
+				auto it_LeastRecentlyUsed = entries.begin();
+
+				for (auto it = entries.begin(); it != entries.end(); ++it)
+				{
+					if (it->Value.LastUsed < it_LeastRecentlyUsed->Value.LastUsed)
+					{
+
+						it_LeastRecentlyUsed = it;
+					}
+				}
+
+				entries.Erase(
+					it_LeastRecentlyUsed
+				);
+			}
+		};
+
+		explicit _Regex(Regex&& regex)
+			: regex(
+				Move(regex)
+			)
+		{
+		}
+
+		// @throw AL::Exception
+		static _Regex FromCache(const String& pattern)
+		{
+			return _Regex(
+				Cache::GetInstance().Get(pattern)
+			);
+		}
+
+		// @throw AL::Exception
+		static Regex  Compile(const Char* lpPattern, size_t length)
+		{
+			try
+			{
+				return Regex(
+					lpPattern,
+					length
+				);
+			}
+			catch (const ::std::regex_error& error)
+			{
+
+				throw Exception(
+					error.what()
+				);
+			}
+		}
 	};
 
 	typedef _Regex<String>  Regex;
 	typedef _Regex<WString> RegexW;
+
+	// Pattern of a StaticRegex
+	template<typename T_CHAR, size_t S>
+	struct StaticRegexPattern
+	{
+		typedef T_CHAR Char;
+
+		static constexpr size_t LENGTH = S - 1;
+
+		Char Value[S];
+
+		constexpr StaticRegexPattern(const Char(&value)[S])
+		{
+			for (size_t i = 0; i < S; ++i)
+			{
+				Value[i] = value[i];
+			}
+		}
+	};
+
+	// Compiles PATTERN once, on first use, and shares it between every caller
+	// - StaticRegex<"^(\\d+)$">::Match(matches, buffer)
+	template<StaticRegexPattern PATTERN>
+	class StaticRegex
+	{
+		typedef typename decltype(PATTERN)::Char _Char;
+
+		static_assert(
+			Is_Type<_Char, char>::Value || Is_Type<_Char, wchar_t>::Value,
+			"PATTERN must be a char or wchar_t string literal"
+		);
+
+		StaticRegex() = delete;
+
+	public:
+		typedef typename Conditional<Is_Type<_Char, char>::Value, AL::Regex, RegexW>::Type Regex;
+
+		typedef typename Regex::Char                                                    Char;
+		typedef typename Regex::String                                                  String;
+		typedef typename Regex::MatchCollection                                         MatchCollection;
+		typedef typename Regex::MatchAllCallback                                        MatchAllCallback;
+
+		static constexpr const Char* GetPattern()
+		{
+			return &PATTERN.Value[0];
+		}
+
+		static constexpr size_t      GetPatternLength()
+		{
+			return PATTERN.LENGTH;
+		}
+
+		// @throw AL::Exception
+		static const Regex& GetRegex()
+		{
+			static const Regex regex(
+				PATTERN.Value
+			);
+
+			return regex;
+		}
+
+		// @throw AL::Exception
+		static Bool IsMatch(const String& buffer)
+		{
+			if (!GetRegex().IsMatch(buffer))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+
+		// @throw AL::Exception
+		static Bool Match(MatchCollection& match, const String& buffer)
+		{
+			if (!GetRegex().Match(match, buffer))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+
+		// @throw AL::Exception
+		static Bool MatchAll(const MatchAllCallback& callback, const String& buffer)
+		{
+			if (!GetRegex().MatchAll(callback, buffer))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+	};
 }
@@ -2,6 +2,10 @@
 #include "AL/Common.hpp"
 
 #include "AL/Collections/String.hpp"
+#include "AL/Collections/StringView.hpp"
+
+#include <cstdio> // snprintf
+#include <charconv> // std::to_chars
 
 #define AL_DEFINE_TO_STRING(__type__, ...) \
 	template<> \
@@ -21,8 +25,11 @@
 
 namespace AL
 {
-	typedef Collections::String  String;
-	typedef Collections::WString WString;
+	typedef Collections::String      String;
+	typedef Collections::WString     WString;
+
+	typedef Collections::StringView  StringView;
+	typedef Collections::WStringView WStringView;
 
 	template<typename T>
 	inline String ToString(T value)
@@ -207,12 +214,93 @@ namespace AL
 	}
 }
 
+namespace AL
+{
+	template<typename T_STRING>
+	inline T_STRING __ToString_FromBuffer(const char* lpBuffer, size_t length)
+	{
+		if constexpr (Is_Type<T_STRING, String>::Value)
+		{
+
+			return String(
+				lpBuffer,
+				length
+			);
+		}
+		else
+		{
+			WString wstring(
+				L'\0',
+				length
+			);
+
+			for (size_t i = 0; i < length; ++i)
+			{
+				wstring[i] = static_cast<wchar_t>(
+					lpBuffer[i]
+				);
+			}
+
+			return wstring;
+		}
+	}
+
+	// Converted with std::to_chars instead of parsing a printf format
+	template<typename T_STRING, typename T>
+	inline T_STRING __ToString_Integer(T value)
+	{
+		// 20 digits and sign
+		char buffer[24];
+
+		auto result = ::std::to_chars(
+			&buffer[0],
+			&buffer[sizeof(buffer)],
+			value
+		);
+
+		return __ToString_FromBuffer<T_STRING>(
+			&buffer[0],
+			static_cast<size_t>(result.ptr - &buffer[0])
+		);
+	}
+
+	// Same as %f
+	template<typename T_STRING, typename T>
+	inline T_STRING __ToString_Decimal(T value)
+	{
+		// 309 integer digits, sign, point and 6 decimals
+		char buffer[320];
+
+#if defined(__cpp_lib_to_chars)
+		auto result = ::std::to_chars(
+			&buffer[0],
+			&buffer[sizeof(buffer)],
+			value,
+			::std::chars_format::fixed,
+			6
+		);
+
+		auto length = static_cast<size_t>(
+			result.ptr - &buffer[0]
+		);
+#else
+		auto length = static_cast<size_t>(
+			::std::snprintf(&buffer[0], sizeof(buffer), "%f", static_cast<Double>(value))
+		);
+#endif
+
+		return __ToString_FromBuffer<T_STRING>(
+			&buffer[0],
+			length
+		);
+	}
+}
+
 AL_DEFINE_TO_STRING(
 	AL::int8,
 	(AL::int8 value)
 	{
-		return AL::String::Format(
-			"%i",
+		return AL::__ToString_Integer<AL::String>(
 			value
 		);
 	}
@@ -236,8 +324,7 @@ AL_DEFINE_TO_WSTRING(
 	AL::int8,
 	(AL::int8 value)
 	{
-		return AL::WString::Format(
-			L"%i",
+		return AL::__ToString_Integer<AL::WString>(
 			value
 		);
 	}
@@ -261,8 +348,7 @@ AL_DEFINE_TO_STRING(
 	AL::uint8,
 	(AL::uint8 value)
 	{
-		return AL::String::Format(
-			"%u",
+		return AL::__ToString_Integer<AL::String>(
 			value
 		);
 	}
@@ -286,8 +372,7 @@ AL_DEFINE_TO_WSTRING(
 	AL::uint8,
 	(AL::uint8 value)
 	{
-		return AL::WString::Format(
-			L"%u",
+		return AL::__ToString_Integer<AL::WString>(
 			value
 		);
 	}
@@ -312,8 +397,7 @@ AL_DEFINE_TO_STRING(
 	AL::int16,
 	(AL::int16 value)
 	{
-		return AL::String::Format(
-			"%i",
+		return AL::__ToString_Integer<AL::String>(
 			value
 		);
 	}
@@ -337,8 +421,7 @@ AL_DEFINE_TO_WSTRING(
 	AL::int16,
 	(AL::int16 value)
 	{
-		return AL::WString::Format(
-			L"%i",
+		return AL::__ToString_Integer<AL::WString>(
 			value
 		);
 	}
@@ -362,8 +445,7 @@ AL_DEFINE_TO_STRING(
 	AL::uint16,
 	(AL::uint16 value)
 	{
-		return AL::String::Format(
-			"%u",
+		return AL::__ToString_Integer<AL::String>(
 			value
 		);
 	}
@@ -387,8 +469,7 @@ AL_DEFINE_TO_WSTRING(
 	AL::uint16,
 	(AL::uint16 value)
 	{
-		return AL::WString::Format(
-			L"%u",
+		return AL::__ToString_Integer<AL::WString>(
 			value
 		);
 	}
@@ -413,8 +494,7 @@ AL_DEFINE_TO_STRING(
 	AL::int32,
 	(AL::int32 value)
 	{
-		return AL::String::Format(
-			"%i",
+		return AL::__ToString_Integer<AL::String>(
 			value
 		);
 	}
@@ -438,8 +518,7 @@ AL_DEFINE_TO_WSTRING(
 	AL::int32,
 	(AL::int32 value)
 	{
-		return AL::WString::Format(
-			L"%i",
+		return AL::__ToString_Integer<AL::WString>(
 			value
 		);
 	}
@@ -463,8 +542,7 @@ AL_DEFINE_TO_STRING(
 	AL::uint32,
 	(AL::uint32 value)
 	{
-		return AL::String::Format(
-			"%u",
+		return AL::__ToString_Integer<AL::String>(
 			value
 		);
 	}
@@ -488,8 +566,7 @@ AL_DEFINE_TO_WSTRING(
 	AL::uint32,
 	(AL::uint32 value)
 	{
-		return AL::WString::Format(
-			L"%u",
+		return AL::__ToString_Integer<AL::WString>(
 			value
 		);
 	}
@@ -514,8 +591,7 @@ AL_DEFINE_TO_STRING(
 	AL::int64,
 	(AL::int64 value)
 	{
-		return AL::String::Format(
-			"%lli",
+		return AL::__ToString_Integer<AL::String>(
 			value
 		);
 	}
@@ -539,8 +615,7 @@ AL_DEFINE_TO_WSTRING(
 	AL::int64,
 	(AL::int64 value)
 	{
-		return AL::WString::Format(
-			L"%lli",
+		return AL::__ToString_Integer<AL::WString>(
 			value
 		);
 	}
@@ -564,8 +639,7 @@ AL_DEFINE_TO_STRING(
 	AL::uint64,
 	(AL::uint64 value)
 	{
-		return AL::String::Format(
-			"%llu",
+		return AL::__ToString_Integer<AL::String>(
 			value
 		);
 	}
@@ -589,8 +663,7 @@ AL_DEFINE_TO_WSTRING(
 	AL::uint64,
 	(AL::uint64 value)
 	{
-		return AL::WString::Format(
-			L"%llu",
+		return AL::__ToString_Integer<AL::WString>(
 			value
 		);
 	}
@@ -615,8 +688,7 @@ AL_DEFINE_TO_STRING(
 	AL::Float,
 	(AL::Float value)
 	{
-		return AL::String::Format(
-			"%f",
+		return AL::__ToString_Decimal<AL::String>(
 			value
 		);
 	}
@@ -639,8 +711,7 @@ AL_DEFINE_TO_WSTRING(
 	AL::Float,
 	(AL::Float value)
 	{
-		return AL::WString::Format(
-			L"%f",
+		return AL::__ToString_Decimal<AL::WString>(
 			value
 		);
 	}
@@ -664,8 +735,7 @@ AL_DEFINE_TO_STRING(
 	AL::Double,
 	(AL::Double value)
 	{
-		return AL::String::Format(
-			"%f",
+		return AL::__ToString_Decimal<AL::String>(
 			value
 		);
 	}
@@ -688,8 +758,7 @@ AL_DEFINE_TO_WSTRING(
 	AL::Double,
 	(AL::Double value)
 	{
-		return AL::WString::Format(
-			L"%f",
+		return AL::__ToString_Decimal<AL::WString>(
 			value
 		);
 	}
@@ -313,6 +313,14 @@ namespace AL
 		static constexpr Bool Value = ::std::is_move_assignable<T>::value;
 	};
 
+	// Values that can be moved to new storage with memcpy without running constructors/destructors
+	// - Specialize for types that never store pointers to themselves
+	template<typename T>
+	struct Is_Trivially_Relocatable
+	{
+		static constexpr Bool Value = ::std::is_trivially_copyable<T>::value;
+	};
+
 	template<typename T>
 	struct Get_Array_Type;
 	template<typename T, size_t S>
@@ -498,6 +506,13 @@ namespace AL
 	{
 	};
 
+	// Excludes T from template argument deduction
+	template<typename T>
+	struct Type_Identity
+	{
+		typedef T Type;
+	};
+
 	template<typename ... TYPES>
 	struct Type_Sequence
 	{
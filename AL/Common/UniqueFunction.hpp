@@ -0,0 +1,157 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "Function.hpp"
+
+namespace AL
+{
+	template<typename F>
+	class UniqueFunction;
+
+	// Move-only Function
+	// - Bound callables don't need to be copyable
+	template<typename T, typename ... TArgs>
+	class UniqueFunction<T(TArgs ...)>
+		: public FunctionBase<False, T(TArgs ...)>
+	{
+		typedef FunctionBase<False, T(TArgs ...)> _Base;
+
+		UniqueFunction(const UniqueFunction&) = delete;
+
+	public:
+		UniqueFunction()
+		{
+		}
+
+		UniqueFunction(UniqueFunction&& function)
+		{
+			_Base::Assign(
+				Move(function)
+			);
+		}
+
+		template<typename F>
+		explicit UniqueFunction(F&& function)
+		{
+			Bind(
+				Forward<F>(function)
+			);
+		}
+		explicit UniqueFunction(T(*lpFunction)(TArgs ...))
+		{
+			Bind(
+				lpFunction
+			);
+		}
+		template<typename C>
+		UniqueFunction(T(C::*lpFunction)(TArgs ...), C& instance)
+		{
+			Bind(
+				lpFunction,
+				instance
+			);
+		}
+		template<typename C>
+		UniqueFunction(T(C::*lpFunction)(TArgs ...) const, const C& instance)
+		{
+			Bind(
+				lpFunction,
+				instance
+			);
+		}
+
+		virtual ~UniqueFunction()
+		{
+		}
+
+		template<typename F>
+		Void Bind(F&& function)
+		{
+			typedef typename Remove_Const<typename Remove_Reference<F>::Type>::Type _F;
+
+			static_assert(
+				!Is_Type<_F, UniqueFunction>::Value,
+				"UniqueFunction must be moved"
+			);
+
+			_Base::Unbind();
+
+			_Base::Create(
+				Forward<F>(function)
+			);
+		}
+		Void Bind(T(*lpFunction)(TArgs ...))
+		{
+			Bind(
+				[lpFunction](TArgs ... _args)
+				{
+					return lpFunction(
+						Forward<TArgs>(_args) ...
+					);
+				}
+			);
+		}
+		template<typename C>
+		Void Bind(T(C::*lpFunction)(TArgs ...), C& instance)
+		{
+			Bind(
+				[lpInstance = &instance, lpFunction](TArgs ... _args)
+				{
+					return (lpInstance->*lpFunction)(
+						Forward<TArgs>(_args) ...
+					);
+				}
+			);
+		}
+		template<typename C>
+		Void Bind(T(C::*lpFunction)(TArgs ...) const, const C& instance)
+		{
+			Bind(
+				[lpInstance = &instance, lpFunction](TArgs ... _args)
+				{
+					return (lpInstance->*lpFunction)(
+						Forward<TArgs>(_args) ...
+					);
+				}
+			);
+		}
+
+		T operator () (TArgs ... args)
+		{
+			return _Base::Execute(
+				Forward<TArgs>(args) ...
+			);
+		}
+
+		UniqueFunction& operator = (UniqueFunction&& function)
+		{
+			if (&function != this)
+			{
+				_Base::Unbind();
+
+				_Base::Assign(
+					Move(function)
+				);
+			}
+
+			return *this;
+		}
+
+		Bool operator == (const UniqueFunction& function) const
+		{
+			return _Base::Equals(
+				function
+			);
+		}
+		Bool operator != (const UniqueFunction& function) const
+		{
+			if (operator==(function))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+	};
+}
@@ -80,25 +80,59 @@ namespace AL::FileSystem
 		}
 
 		// @format: [Time: $timestamp] [Thread: $threadId] message
+		// - format is an AL::Format string checked at compile time
 		// @throw AL::Exception
 		template<typename ... TArgs>
-		Void WriteLine(const String& format, TArgs ... args)
+		Void Log(Format_String<TArgs ...> format, const TArgs& ... args)
 		{
 			AL_ASSERT(
 				IsOpen(),
 				"LogFile not open"
 			);
 
-			auto input = String::Format(
+			String line;
+
+			FormatTo(
+				line,
+				"[Time: {}] [Thread: {}] ",
+				OS::System::GetTimestamp().ToSeconds(),
+				OS::GetCurrentThreadId()
+			);
+
+			FormatTo(
+				line,
 				format,
-				Forward<TArgs>(args) ...
+				args ...
+			);
+
+			OS::MutexGuard lock(
+				mutex
+			);
+
+			file.WriteLine(
+				line
+			);
+		}
+
+		// @format: [Time: $timestamp] [Thread: $threadId] message
+		// @throw AL::Exception
+		template<typename ... TArgs>
+		Void WriteLine(const String& format, TArgs ... args)
+		{
+			AL_ASSERT(
+				IsOpen(),
+				"LogFile not open"
 			);
 
 			auto line = String::Format(
-				"[Time: %llu] [Thread: %lu] %s",
+				"[Time: %llu] [Thread: %lu] ",
 				OS::System::GetTimestamp().ToSeconds(),
-				OS::GetCurrentThreadId(),
-				input.GetCString()
+				OS::GetCurrentThreadId()
+			);
+
+			line.AppendFormat(
+				format,
+				Forward<TArgs>(args) ...
 			);
 
 			OS::MutexGuard lock(
@@ -9,7 +9,7 @@
 
 #include "AL/Collections/ByteBuffer.hpp"
 #include "AL/Collections/LinkedList.hpp"
-#include "AL/Collections/Dictionary.hpp"
+#include "AL/Collections/HashDictionary.hpp"
 
 namespace AL::Game::FileSystem
 {
@@ -72,7 +72,7 @@ namespace AL::Game::FileSystem
 #pragma pack(pop)
 
 		AL::FileSystem::File                  file;
-		Collections::Dictionary<_Key, _Value> sections;
+		Collections::HashDictionary<_Key, _Value> sections;
 
 	public:
 		typedef _Key   Key;
@@ -15,10 +15,11 @@ namespace AL::Game::Network
 		typedef typename _Session::OPCode OPCode;
 		typedef typename _Session::Packet Packet;
 
-		Client(size_t receiveBufferSize, size_t packetBuilderBufferSize)
+		// @param packetBufferSize added to receiveBufferSize to size the receive ring, which grows for larger packets
+		Client(size_t receiveBufferSize, size_t packetBufferSize)
 			: _Session(
 				receiveBufferSize,
-				packetBuilderBufferSize
+				packetBufferSize
 			)
 		{
 		}
@@ -45,6 +45,7 @@ namespace AL::Game::Network::Protocol
 		typedef Collections::ByteBuffer<Endians::Big> _Buffer;
 		typedef Protocol::PacketHeader<_OPCode>       _Header;
 
+		Bool    isView      = False;
 		Bool    isFinalized = False;
 
 		_Header header;
@@ -72,45 +73,17 @@ namespace AL::Game::Network::Protocol
 		// @throw AL::Exception
 		static Packet FromBuffer(const Void* lpBuffer, size_t size)
 		{
-			if (size < sizeof(_Header))
-			{
-
-				throw Exception(
-					"Unexpected end of buffer"
-				);
-			}
-
 			Packet packet;
 
-			AL::memcpy(
-				&packet.header,
+			ReadHeader(
+				packet.header,
 				lpBuffer,
-				sizeof(_Header)
+				size
 			);
 
 			size    -= sizeof(_Header);
 			lpBuffer = &reinterpret_cast<const uint8*>(lpBuffer)[sizeof(_Header)];
 
-			packet.header.OPCode   = FromEndian(packet.header.OPCode);
-			packet.header.DataSize = FromEndian(packet.header.DataSize);
-			packet.header.DataHash = FromEndian(packet.header.DataHash);
-
-			if (packet.header.DataSize != size)
-			{
-
-				throw Exception(
-					"Invalid data size"
-				);
-			}
-
-			if (packet.header.DataHash != _Hash::Calculate(lpBuffer, size))
-			{
-
-				throw Exception(
-					"Invalid data hash"
-				);
-			}
-
 			packet.isFinalized = True;
 
 			// This only fails if the buffer isn't self hosted, which it is
@@ -128,6 +101,25 @@ namespace AL::Game::Network::Protocol
 			return packet;
 		}
 
+		// Creates a read-only packet over lpBuffer instead of copying it
+		// - lpBuffer must outlive the packet, copies and moves of the packet own their data
+		// @throw AL::Exception
+		static Packet FromView(const Void* lpBuffer, size_t size)
+		{
+			_Header header;
+
+			ReadHeader(
+				header,
+				lpBuffer,
+				size
+			);
+
+			return Packet(
+				header,
+				_Buffer::CreateReader(lpBuffer, size)
+			);
+		}
+
 		Packet()
 			: buffer(
 				sizeof(_Header)
@@ -143,7 +135,7 @@ namespace AL::Game::Network::Protocol
 				Move(packet.header)
 			),
 			buffer(
-				Move(packet.buffer)
+				packet.IsView() ? packet.CopyBuffer() : Move(packet.buffer)
 			)
 		{
 			packet.isFinalized = False;
@@ -157,7 +149,7 @@ namespace AL::Game::Network::Protocol
 				packet.header
 			),
 			buffer(
-				packet.buffer
+				packet.IsView() ? packet.CopyBuffer() : packet.buffer
 			)
 		{
 		}
@@ -193,6 +185,12 @@ namespace AL::Game::Network::Protocol
 			return isFinalized;
 		}
 
+		// Created by FromView
+		Bool IsView() const
+		{
+			return isView;
+		}
+
 		auto GetSize() const
 		{
 			return header.DataSize;
@@ -308,9 +306,8 @@ namespace AL::Game::Network::Protocol
 				packet.header
 			);
 
-			buffer = Move(
-				packet.buffer
-			);
+			buffer = packet.IsView() ? packet.CopyBuffer() : Move(packet.buffer);
+			isView = False;
 
 			return *this;
 		}
@@ -319,7 +316,8 @@ namespace AL::Game::Network::Protocol
 			isFinalized = packet.isFinalized;
 
 			header      = packet.header;
-			buffer      = packet.buffer;
+			buffer      = packet.IsView() ? packet.CopyBuffer() : packet.buffer;
+			isView      = False;
 
 			return *this;
 		}
@@ -358,5 +356,81 @@ namespace AL::Game::Network::Protocol
 
 			return True;
 		}
+
+	private:
+		// @throw AL::Exception
+		static Void ReadHeader(_Header& header, const Void* lpBuffer, size_t size)
+		{
+			if (size < sizeof(_Header))
+			{
+
+				throw Exception(
+					"Unexpected end of buffer"
+				);
+			}
+
+			AL::memcpy(
+				&header,
+				lpBuffer,
+				sizeof(_Header)
+			);
+
+			size    -= sizeof(_Header);
+			lpBuffer = &reinterpret_cast<const uint8*>(lpBuffer)[sizeof(_Header)];
+
+			header.OPCode   = FromEndian(header.OPCode);
+			header.DataSize = FromEndian(header.DataSize);
+			header.DataHash = FromEndian(header.DataHash);
+
+			if (header.DataSize != size)
+			{
+
+				throw Exception(
+					"Invalid data size"
+				);
+			}
+
+			if (header.DataHash != _Hash::Calculate(lpBuffer, size))
+			{
+
+				throw Exception(
+					"Invalid data hash"
+				);
+			}
+		}
+
+		Packet(const _Header& header, _Buffer&& buffer)
+			: isView(
+				True
+			),
+			isFinalized(
+				True
+			),
+			header(
+				header
+			),
+			buffer(
+				Move(buffer)
+			)
+		{
+			this->buffer.SetReadPosition(
+				sizeof(_Header)
+			);
+		}
+
+		// Owned copy of the buffer of a view
+		_Buffer CopyBuffer() const
+		{
+			_Buffer buffer(
+				GetBuffer(),
+				GetBufferSize()
+			);
+
+			buffer.SetReadPosition(
+				this->buffer.GetReadPosition()
+			);
+
+			return buffer;
+		}
 	};
 }
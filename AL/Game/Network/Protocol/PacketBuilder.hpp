@@ -9,8 +9,10 @@
 
 namespace AL::Game::Network::Protocol
 {
+	// Deprecated, Session frames packets with PacketReceiveBuffer and no longer uses this
+	// - Will be removed in the next release
 	template<typename T_OPCODE>
-	class PacketBuilder
+	class AL_DEPRECATED("Use AL::Game::Network::Protocol::PacketReceiveBuffer") PacketBuilder
 	{
 		typedef T_OPCODE                        _OPCode;
 		typedef Protocol::Packet<_OPCode>       _Packet;
@@ -0,0 +1,159 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "Packet.hpp"
+#include "PacketHeader.hpp"
+
+#include "AL/Collections/Array.hpp"
+#include "AL/Collections/RingBuffer.hpp"
+
+namespace AL::Game::Network::Protocol
+{
+	// Receives into a ring buffer and frames packets in place
+	// - Packets are views over the buffer, they are only copied when they wrap the end of the buffer
+	// - The buffer grows to fit packets larger than its capacity
+	template<typename T_OPCODE>
+	class PacketReceiveBuffer
+	{
+		typedef T_OPCODE                        _OPCode;
+		typedef Protocol::Packet<_OPCode>       _Packet;
+		typedef Protocol::PacketHeader<_OPCode> _PacketHeader;
+
+		Collections::RingBuffer   buffer;
+		// packets wrapping the end of buffer
+		Collections::Array<uint8> packetBuffer;
+
+	public:
+		typedef _OPCode OPCode;
+		typedef _Packet Packet;
+
+		explicit PacketReceiveBuffer(size_t capacity)
+			: buffer(
+				(capacity >= sizeof(_PacketHeader)) ? capacity : sizeof(_PacketHeader)
+			)
+		{
+		}
+
+		PacketReceiveBuffer(PacketReceiveBuffer&& packetReceiveBuffer)
+			: buffer(
+				Move(packetReceiveBuffer.buffer)
+			),
+			packetBuffer(
+				Move(packetReceiveBuffer.packetBuffer)
+			)
+		{
+		}
+
+		virtual ~PacketReceiveBuffer()
+		{
+		}
+
+		auto GetSize() const
+		{
+			return buffer.GetSize();
+		}
+
+		auto GetCapacity() const
+		{
+			return buffer.GetCapacity();
+		}
+
+		// Free space for the next receive, committed with Commit
+		Collections::RingBufferSegment GetReceiveSegment()
+		{
+			Collections::RingBufferSegment segments[2];
+
+			if (buffer.GetWriteSegments(segments) == 0)
+			{
+				buffer.SetCapacity(
+					buffer.GetCapacity() * 2
+				);
+
+				buffer.GetWriteSegments(
+					segments
+				);
+			}
+
+			return segments[0];
+		}
+
+		Void Commit(size_t size)
+		{
+			buffer.Commit(
+				size
+			);
+		}
+
+		// Executes function for every complete packet until it returns AL::False
+		// - The packet is only valid until function returns
+		// @throw AL::Exception
+		template<typename F>
+		Void Dequeue(F&& function)
+		{
+			for (_PacketHeader header; buffer.Peek(&header, sizeof(_PacketHeader)); )
+			{
+				auto packetSize = sizeof(_PacketHeader) + _Packet::FromEndian(header.DataSize);
+
+				if (buffer.GetSize() < packetSize)
+				{
+					if (buffer.GetCapacity() < packetSize)
+					{
+
+						buffer.SetCapacity(
+							packetSize
+						);
+					}
+
+					break;
+				}
+
+				Collections::RingBufferSegment segments[2];
+
+				buffer.GetReadSegments(
+					segments
+				);
+
+				const Void* lpPacket = segments[0].lpBuffer;
+
+				if (segments[0].Size < packetSize)
+				{
+					if (packetBuffer.GetCapacity() < packetSize)
+					{
+
+						packetBuffer.SetCapacity(
+							packetSize
+						);
+					}
+
+					buffer.Peek(
+						&packetBuffer[0],
+						packetSize
+					);
+
+					lpPacket = &packetBuffer[0];
+				}
+
+				auto packet = _Packet::FromView(
+					lpPacket,
+					packetSize
+				);
+
+				// the memory stays untouched until the next receive
+				buffer.Skip(
+					packetSize
+				);
+
+				if (!function(packet))
+				{
+
+					break;
+				}
+			}
+		}
+
+		Void Clear()
+		{
+			buffer.Clear();
+		}
+	};
+}
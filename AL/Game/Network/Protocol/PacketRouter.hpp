@@ -4,7 +4,7 @@
 #include "Packet.hpp"
 #include "PacketHandler.hpp"
 
-#include "AL/Collections/Dictionary.hpp"
+#include "AL/Collections/HashDictionary.hpp"
 
 namespace AL::Game::Network::Protocol
 {
@@ -15,7 +15,7 @@ namespace AL::Game::Network::Protocol
 		typedef Protocol::Packet<_OPCode>        _Packet;
 		typedef Protocol::PacketHandler<_OPCode> _PacketHandler;
 
-		Collections::Dictionary<_OPCode, _PacketHandler> handlers;
+		Collections::HashDictionary<_OPCode, _PacketHandler> handlers;
 
 	public:
 		typedef _OPCode        OPCode;
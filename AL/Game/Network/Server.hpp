@@ -4,7 +4,14 @@
 #include "Socket.hpp"
 #include "ServerSession.hpp"
 
-#include "AL/Collections/LinkedList.hpp"
+#include "AL/Collections/Array.hpp"
+#include "AL/Collections/ArrayList.hpp"
+
+#if defined(AL_PLATFORM_LINUX)
+	#include "ServerShard.hpp"
+
+	#include "AL/Network/SocketPoller.hpp"
+#endif
 
 namespace AL::Game::Network
 {
@@ -29,6 +36,20 @@ namespace AL::Game::Network
 	template<typename T_OPCODE>
 	using ServerOnDisconnectedEventHandler = Function<Void(ServerSession<T_OPCODE>& session)>;
 
+	enum class ServerUpdateModes : uint8
+	{
+		// Update accepts pending connections and updates every session
+		Tick,
+		// Update only touches the listener and sessions with pending I/O (Linux only)
+		// - Session::Update and Session::OnUpdate are executed when data arrives instead of every tick
+		Readiness
+	};
+
+	// With shardCount != 0 (Linux only) sessions are spread across shards that each own an I/O thread
+	// - Connections are accepted by Update and handed to the shards round-robin
+	// - Packets are framed by the shards and routed by Update, handlers still run on the thread calling Update
+	// - Data sent by a session is handed to its shard once per Update
+	// - Session::Update, Session::OnUpdate and Session::OnReceive are never executed
 	template<typename T_OPCODE>
 	class Server
 	{
@@ -37,21 +58,68 @@ namespace AL::Game::Network
 		typedef ServerOnConnectedEventHandler<_OPCode>    _ServerOnConnectedEventHandler;
 		typedef ServerOnDisconnectedEventHandler<_OPCode> _ServerOnDisconnectedEventHandler;
 
-		Bool                                     isUpdating = False;
-		Bool                                     isShutdownPending = False;
+#if defined(AL_PLATFORM_LINUX)
+		typedef ServerShard<_OPCode>                      _ServerShard;
+		typedef ServerShardMessage<_OPCode>               _ServerShardMessage;
+		typedef ServerShardConnection<_OPCode>            _ServerShardConnection;
+#endif
 
-		Socket*                                  lpSocket = nullptr;
+		friend _ServerSession;
 
-		Collections::LinkedList<_ServerSession*> sessions;
+		static constexpr uint32 SESSION_SLOT_COUNT = 64;
+		static constexpr uint32 SESSION_SLOT_NONE  = Integer<uint32>::Maximum;
 
-		size_t                                   receiveBufferSize;
-		size_t                                   packetBuilderBufferSize;
+		// Free slots are chained through NextFree
+		struct SessionSlot
+		{
+			_ServerSession* lpSession;
+			uint32          Generation;
+			uint32          NextFree;
+		};
+
+		Bool                                        isUpdating = False;
+		Bool                                        isShutdownPending = False;
+
+		Socket*                                     lpSocket = nullptr;
+		ServerUpdateModes                           updateMode;
+#if defined(AL_PLATFORM_LINUX)
+		AL::Network::SocketPoller                   poller;
+#endif
+
+		Collections::Array<SessionSlot>             sessionSlots;
+		uint32                                      sessionSlotCount = 0;
+		uint32                                      sessionSlotFree = SESSION_SLOT_NONE;
+		size_t                                      sessionCount = 0;
+		// disconnected since the last update, released by Handle_OnUpdate_Disconnects
+		Collections::ArrayList<_ServerSession*>     disconnectedSessions;
+
+		TimeSpan                                    updateDelta;
+		size_t                                      acceptCount = 0;
+
+		// sessions with data queued since the last update
+		Collections::ArrayList<ServerSessionHandle> sendingSessions;
+		Collections::ArrayList<ServerSessionHandle> flushingSessions;
+		size_t                                      sendBufferSizeLimit = _ServerSession::SEND_BUFFER_SIZE_LIMIT;
+
+#if defined(AL_PLATFORM_LINUX)
+		size_t                                      shardCount;
+		size_t                                      shardNext = 0;
+		Collections::Array<_ServerShard*>           shards;
+		typename _ServerShard::MessageQueue         shardMessages;
+#endif
+
+		size_t                                      receiveBufferSize;
+		size_t                                      packetBufferSize;
 
 		Server(Server&&) = delete;
 		Server(const Server&) = delete;
 
 	public:
-		typedef _ServerSession Session;
+		typedef _ServerSession      Session;
+		typedef ServerSessionHandle SessionHandle;
+
+		// Maximum connections accepted per Update
+		static constexpr size_t ACCEPT_COUNT_MAXIMUM = 256;
 
 		// @throw AL::Exception
 		Event<ServerOnListenEventHandler>        OnListen;
@@ -70,14 +138,57 @@ namespace AL::Game::Network
 		// @throw AL::Exception
 		Event<_ServerOnDisconnectedEventHandler> OnDisconnected;
 
-		Server(size_t receiveBufferSize, size_t packetBuilderBufferSize)
-			: receiveBufferSize(
+		// @param packetBufferSize added to receiveBufferSize to size the receive ring, which grows for larger packets
+		Server(size_t receiveBufferSize, size_t packetBufferSize)
+			: Server(
+				receiveBufferSize,
+				packetBufferSize,
+				0
+			)
+		{
+		}
+
+		// @param packetBufferSize added to receiveBufferSize to size the receive ring, which grows for larger packets
+		// @param shardCount number of I/O threads, 0 to perform I/O in Update
+		Server(size_t receiveBufferSize, size_t packetBufferSize, size_t shardCount)
+			: Server(
+				receiveBufferSize,
+				packetBufferSize,
+				shardCount,
+				ServerUpdateModes::Tick
+			)
+		{
+		}
+
+		// @param packetBufferSize added to receiveBufferSize to size the receive ring, which grows for larger packets
+		// @param shardCount number of I/O threads, 0 to perform I/O in Update
+		Server(size_t receiveBufferSize, size_t packetBufferSize, size_t shardCount, ServerUpdateModes updateMode)
+			: updateMode(
+				updateMode
+			),
+#if defined(AL_PLATFORM_LINUX)
+			shardCount(
+				shardCount
+			),
+#endif
+			receiveBufferSize(
 				receiveBufferSize
 			),
-			packetBuilderBufferSize(
-				packetBuilderBufferSize
+			packetBufferSize(
+				packetBufferSize
 			)
 		{
+#if !defined(AL_PLATFORM_LINUX)
+			AL_ASSERT(
+				shardCount == 0,
+				"Sharded mode not supported"
+			);
+
+			AL_ASSERT(
+				updateMode == ServerUpdateModes::Tick,
+				"Readiness mode not supported"
+			);
+#endif
 		}
 
 		virtual ~Server()
@@ -94,9 +205,45 @@ namespace AL::Game::Network
 			return lpSocket != nullptr;
 		}
 
+		// Includes the port assigned when listening on port 0
+		const IPEndPoint& GetLocalEndPoint() const
+		{
+			AL_ASSERT(
+				IsListening(),
+				"Server not listening"
+			);
+
+			return lpSocket->GetLocalEndPoint();
+		}
+
 		auto GetSessionCount() const
 		{
-			return sessions.GetSize();
+			return sessionCount;
+		}
+
+		auto GetSendBufferSizeLimit() const
+		{
+			return sendBufferSizeLimit;
+		}
+
+		// Applies to sessions accepted afterwards
+		Void SetSendBufferSizeLimit(size_t value)
+		{
+			sendBufferSizeLimit = value;
+		}
+
+		// @return nullptr if the session was disconnected
+		Session* GetSession(SessionHandle handle) const
+		{
+			auto index = static_cast<uint32>(handle & Integer<uint32>::Maximum);
+
+			if ((index >= sessionSlotCount) || (sessionSlots[index].Generation != static_cast<uint32>(handle >> 32)))
+			{
+
+				return nullptr;
+			}
+
+			return sessionSlots[index].lpSession;
 		}
 
 		// @throw AL::Exception
@@ -185,12 +332,73 @@ namespace AL::Game::Network
 				);
 			}
 
+#if defined(AL_PLATFORM_LINUX)
+			try
+			{
+				if (updateMode == ServerUpdateModes::Readiness)
+				{
+					poller.Open();
+
+					poller.Add(
+						*lpSocket,
+						AL::Network::SocketPollerEvents::Read,
+						AL::Network::SocketPollerModes::Level,
+						[this](AL::Network::ISocket& _socket, AL::Network::SocketPollerEvents _events)
+						{
+							Handle_OnUpdate_Accept(
+								updateDelta
+							);
+						}
+					);
+				}
+			}
+			catch (Exception& exception)
+			{
+				poller.Close();
+
+				lpSocket->Close();
+
+				delete lpSocket;
+				lpSocket = nullptr;
+
+				throw Exception(
+					Move(exception),
+					"Error opening SocketPoller"
+				);
+			}
+
+			try
+			{
+				StartShards();
+			}
+			catch (Exception& exception)
+			{
+				poller.Close();
+
+				lpSocket->Close();
+
+				delete lpSocket;
+				lpSocket = nullptr;
+
+				throw Exception(
+					Move(exception),
+					"Error starting ServerShard(s)"
+				);
+			}
+#endif
+
 			try
 			{
 				OnListen.Execute();
 			}
 			catch (Exception& exception)
 			{
+#if defined(AL_PLATFORM_LINUX)
+				StopShards();
+
+				poller.Close();
+#endif
+
 				lpSocket->Close();
 
 				delete lpSocket;
@@ -211,19 +419,47 @@ namespace AL::Game::Network
 					return;
 				}
 
+#if defined(AL_PLATFORM_LINUX)
+				if (updateMode == ServerUpdateModes::Readiness)
+				{
+
+					poller.Remove(
+						*lpSocket
+					);
+				}
+#endif
+
 				lpSocket->Close();
 
-				for (auto it = sessions.begin(); it != sessions.end(); )
+				for (uint32 i = 0; i < sessionSlotCount; ++i)
 				{
-					auto lpSession = *it;
+					if (auto lpSession = sessionSlots[i].lpSession)
+					{
 
-					lpSession->Disconnect();
+						lpSession->Disconnect();
+					}
+				}
 
-					sessions.Erase(
-						it++
-					);
+				for (auto lpSession : disconnectedSessions)
+				{
+
+					delete lpSession;
 				}
 
+				disconnectedSessions.Clear();
+				sendingSessions.Clear();
+
+				sessionSlots.SetCapacity(0);
+				sessionSlotCount = 0;
+				sessionSlotFree  = SESSION_SLOT_NONE;
+
+#if defined(AL_PLATFORM_LINUX)
+				// shards release the connections queued above before stopping
+				StopShards();
+
+				poller.Close();
+#endif
+
 				OnShutdown.Execute();
 
 				delete lpSocket;
@@ -239,15 +475,28 @@ namespace AL::Game::Network
 				"Server not listening"
 			);
 
-			isUpdating = True;
+			isUpdating  = True;
+			updateDelta = delta;
+			acceptCount = 0;
 
-			Handle_OnUpdate(
-				delta
-			);
+			try
+			{
+				Handle_OnUpdate(
+					delta
+				);
 
-			OnUpdate.Execute(
-				delta
-			);
+				OnUpdate.Execute(
+					delta
+				);
+
+				Handle_OnUpdate_Send();
+			}
+			catch (Exception&)
+			{
+				isUpdating = False;
+
+				throw;
+			}
 
 			isUpdating = False;
 
@@ -263,12 +512,118 @@ namespace AL::Game::Network
 		// @throw AL::Exception
 		Void Handle_OnUpdate(TimeSpan delta)
 		{
-			try
+#if defined(AL_PLATFORM_LINUX)
+			if (updateMode == ServerUpdateModes::Readiness)
 			{
-				Handle_OnUpdate_Accept(
+				// a full batch may leave events pending
+				while (IsListening() && (poller.Poll(TimeSpan::Zero) == AL::Network::SocketPoller::EVENT_COUNT))
+				{
+				}
+			}
+			else
+			{
+
+				Handle_OnUpdate_Tick(
 					delta
 				);
 			}
+
+			if (shardCount != 0)
+			{
+
+				Handle_OnUpdate_Shards();
+			}
+#else
+			Handle_OnUpdate_Tick(
+				delta
+			);
+#endif
+
+			Handle_OnUpdate_Disconnects();
+		}
+
+		// @throw AL::Exception
+		Void Handle_OnUpdate_Tick(TimeSpan delta)
+		{
+			Handle_OnUpdate_Accept(
+				delta
+			);
+
+#if defined(AL_PLATFORM_LINUX)
+			// sharded sessions are never updated
+			if (shardCount != 0)
+			{
+
+				return;
+			}
+#endif
+
+			for (uint32 i = 0; i < sessionSlotCount; ++i)
+			{
+				if (auto lpSession = sessionSlots[i].lpSession)
+				{
+
+					Handle_OnUpdate_Session(
+						*lpSession,
+						delta
+					);
+				}
+			}
+		}
+
+		// @throw AL::Exception
+		Void Handle_OnUpdate_Accept(TimeSpan delta)
+		{
+			Socket socket(
+				lpSocket->GetAddressFamily()
+			);
+
+			try
+			{
+				while (IsListening() && (acceptCount < ACCEPT_COUNT_MAXIMUM) && lpSocket->Accept(socket))
+				{
+					++acceptCount;
+
+					if (!OnAccept.Execute(socket))
+					{
+						socket.Close();
+
+						continue;
+					}
+
+					auto lpSession = new Session(
+						*this,
+						Move(socket),
+						receiveBufferSize,
+						packetBufferSize
+					);
+
+					// the handle is valid in OnConnected
+					AddSession(
+						lpSession
+					);
+
+					try
+					{
+						OnConnected.Execute(
+							*lpSession
+						);
+					}
+					catch (Exception&)
+					{
+						lpSession->Disconnect();
+
+						// never reported to OnDisconnected
+						disconnectedSessions.Erase(
+							disconnectedSessions.Find(lpSession)
+						);
+
+						delete lpSession;
+
+						throw;
+					}
+				}
+			}
 			catch (Exception& exception)
 			{
 
@@ -277,10 +632,15 @@ namespace AL::Game::Network
 					"Error accepting new Session(s)"
 				);
 			}
+		}
 
+		// @throw AL::Exception
+		Void Handle_OnUpdate_Session(Session& session, TimeSpan delta)
+		{
 			try
 			{
-				Handle_OnUpdate_Sessions(
+				// Session::Update disconnects on failure
+				session.Update(
 					delta
 				);
 			}
@@ -294,74 +654,404 @@ namespace AL::Game::Network
 			}
 		}
 
+#if defined(AL_PLATFORM_LINUX)
+		// Routes packets and disconnects reported by the shards
 		// @throw AL::Exception
-		Void Handle_OnUpdate_Accept(TimeSpan delta)
+		Void Handle_OnUpdate_Shards()
 		{
-			Socket socket(
-				lpSocket->GetAddressFamily()
+			shardMessages.DequeueAll(
+				[this](_ServerShardMessage&& _message)
+				{
+					// disconnected by this thread since the message was queued
+					auto lpSession = GetSession(
+						_message.Session
+					);
+
+					if (lpSession == nullptr)
+					{
+
+						return;
+					}
+
+					switch (_message.Type)
+					{
+						case ServerShardMessageTypes::Packet:
+						{
+							try
+							{
+								lpSession->ExecutePacket(
+									_message.Packet
+								);
+							}
+							catch (Exception& exception)
+							{
+
+								throw Exception(
+									Move(exception),
+									"Error updating Session(s)"
+								);
+							}
+						}
+						break;
+
+						case ServerShardMessageTypes::Disconnected:
+							lpSession->Disconnect();
+							break;
+					}
+				}
 			);
+		}
 
-			while (IsListening() && lpSocket->Accept(socket))
+		// @throw AL::Exception
+		Void SendShard(Session& session)
+		{
+			if (session.shardSendBufferSize != 0)
 			{
-				if (!OnAccept.Execute(socket))
+				shards[session.shardIndex]->Send(
+					session.lpConnection,
+					Move(session.shardSendBuffer),
+					session.shardSendBufferSize
+				);
+
+				session.shardSendBufferSize = 0;
+			}
+		}
+
+		// @throw AL::Exception
+		Void StartShards()
+		{
+			if (shardCount != 0)
+			{
+				shards.SetCapacity(
+					shardCount
+				);
+
+				shards.Fill(
+					nullptr
+				);
+
+				try
 				{
-					socket.Close();
+					for (auto& lpShard : shards)
+					{
+						lpShard = new _ServerShard(
+							shardMessages
+						);
+
+						lpShard->Start();
+					}
+				}
+				catch (Exception&)
+				{
+					StopShards();
 
-					break;
+					throw;
 				}
+			}
+		}
 
-				auto lpSession = new Session(
-					*this,
-					Move(socket),
-					receiveBufferSize,
-					packetBuilderBufferSize
+		Void StopShards()
+		{
+			for (auto lpShard : shards)
+			{
+				if (lpShard != nullptr)
+				{
+					try
+					{
+						lpShard->Stop();
+					}
+					catch (Exception&)
+					{
+					}
+
+					delete lpShard;
+				}
+			}
+
+			shards.SetCapacity(0);
+			shardNext = 0;
+
+			// messages for sessions that no longer exist
+			shardMessages.Clear();
+		}
+#endif
+
+		// Flushes every session with queued data once, sharded sessions hand it to their shard instead
+		// @throw AL::Exception
+		Void Handle_OnUpdate_Send()
+		{
+			if (sendingSessions.GetSize() != 0)
+			{
+				// sessions may queue data while others are flushed
+				flushingSessions.Swap(
+					sendingSessions
 				);
 
+				for (auto handle : flushingSessions)
+				{
+					if (auto lpSession = GetSession(handle))
+					{
+#if defined(AL_PLATFORM_LINUX)
+						if (lpSession->lpConnection != nullptr)
+						{
+							SendShard(
+								*lpSession
+							);
+
+							continue;
+						}
+#endif
+
+						try
+						{
+							// data the socket did not accept is flushed by the next update
+							if (lpSession->Flush() && (lpSession->GetSendStatistics().QueuedBytes != 0))
+							{
+
+								sendingSessions.PushBack(
+									handle
+								);
+							}
+						}
+						catch (Exception&)
+						{
+							// socket errors close the session instead of failing the update
+							lpSession->Disconnect();
+						}
+					}
+				}
+
+				flushingSessions.Clear();
+			}
+
+#if defined(AL_PLATFORM_LINUX)
+			for (auto lpShard : shards)
+			{
+
+				lpShard->Flush();
+			}
+#endif
+		}
+
+		// Executed when a session queues data while its send buffer is empty
+		// @throw AL::Exception
+		Void Handle_OnSessionSend(Session& session)
+		{
+			sendingSessions.PushBack(
+				session.handle
+			);
+		}
+
+		// @throw AL::Exception
+		Void Handle_OnUpdate_Disconnects()
+		{
+			if (disconnectedSessions.GetSize() == 0)
+			{
+
+				return;
+			}
+
+			Collections::ArrayList<Session*> sessions;
+
+			// OnDisconnected may disconnect other sessions
+			sessions.Swap(
+				disconnectedSessions
+			);
+
+			for (size_t i = 0; i < sessions.GetSize(); ++i)
+			{
 				try
 				{
-					OnConnected.Execute(
-						*lpSession
+					OnDisconnected.Execute(
+						*sessions[i]
 					);
 				}
 				catch (Exception&)
 				{
-					lpSession->Disconnect();
+					for (size_t j = i; j < sessions.GetSize(); ++j)
+					{
 
-					delete lpSession;
+						delete sessions[j];
+					}
 
 					throw;
 				}
 
-				sessions.PushBack(
-					lpSession
+				delete sessions[i];
+			}
+		}
+
+		// Executed by Session::Disconnect before the socket is closed
+		Void Handle_OnSessionDisconnect(Session& session)
+		{
+#if defined(AL_PLATFORM_LINUX)
+			if (session.lpConnection != nullptr)
+			{
+				// data sent before Disconnect is delivered before the connection is closed
+				try
+				{
+					SendShard(
+						session
+					);
+
+					shards[session.shardIndex]->Release(
+						session.lpConnection
+					);
+				}
+				catch (Exception&)
+				{
+				}
+
+				session.lpConnection = nullptr;
+			}
+			else if (updateMode == ServerUpdateModes::Readiness)
+			{
+				poller.Remove(
+					session.GetSocket()
 				);
 			}
+#endif
+
+			RemoveSession(
+				session
+			);
+
+			disconnectedSessions.PushBack(
+				&session
+			);
 		}
 
 		// @throw AL::Exception
-		Void Handle_OnUpdate_Sessions(TimeSpan delta)
+		Void AddSession(Session* lpSession)
 		{
-			for (auto it = sessions.begin(); it != sessions.end(); )
+			if (sessionSlotFree == SESSION_SLOT_NONE)
 			{
-				auto lpSession = *it;
+				if (sessionSlotCount == sessionSlots.GetCapacity())
+				{
+					sessionSlots.SetSize(
+						(sessionSlotCount != 0) ? (sessionSlotCount * 2) : SESSION_SLOT_COUNT
+					);
+				}
 
-				if (!lpSession->Update(delta))
+				sessionSlots[sessionSlotCount] =
 				{
-					OnDisconnected.Execute(
-						*lpSession
+					.lpSession  = nullptr,
+					.Generation = 1,
+					.NextFree   = SESSION_SLOT_NONE
+				};
+
+				sessionSlotFree = sessionSlotCount++;
+			}
+
+			auto  index  = sessionSlotFree;
+			auto& slot   = sessionSlots[index];
+			auto  handle = (static_cast<SessionHandle>(slot.Generation) << 32) | index;
+
+			lpSession->SetSendBufferSizeLimit(
+				sendBufferSizeLimit
+			);
+
+#if defined(AL_PLATFORM_LINUX)
+			if (shardCount != 0)
+			{
+				auto lpConnection = new _ServerShardConnection
+				{
+					.ClientSocket        = Move(lpSession->GetSocket()),
+					.ReceiveBuffer       = Protocol::PacketReceiveBuffer<_OPCode>(receiveBufferSize + packetBufferSize),
+					.SendBuffer          = Collections::RingBuffer(),
+					.SendBufferSizeLimit = sendBufferSizeLimit,
+					.Session             = handle,
+					.IsClosed            = False
+				};
+
+				lpSession->lpConnection = lpConnection;
+				lpSession->shardIndex   = shardNext;
+
+				if (++shardNext == shardCount)
+				{
+
+					shardNext = 0;
+				}
+
+				try
+				{
+					shards[lpSession->shardIndex]->Add(
+						lpConnection
 					);
+				}
+				catch (Exception& exception)
+				{
+					delete lpConnection;
+
+					lpSession->lpConnection = nullptr;
+					lpSession->Disconnect();
 
 					delete lpSession;
 
-					sessions.Erase(
-						it++
+					throw Exception(
+						Move(exception),
+						"Error adding Session to ServerShard"
 					);
+				}
+			}
+			else if (updateMode == ServerUpdateModes::Readiness)
+			{
+				try
+				{
+					poller.Add(
+						lpSession->GetSocket(),
+						AL::Network::SocketPollerEvents::Read | AL::Network::SocketPollerEvents::HangUp,
+						AL::Network::SocketPollerModes::Edge,
+						// data received before the socket was added is reported by the first Poll
+						[this, lpSession](AL::Network::ISocket& _socket, AL::Network::SocketPollerEvents _events)
+						{
+							Handle_OnUpdate_Session(
+								*lpSession,
+								updateDelta
+							);
+						}
+					);
+				}
+				catch (Exception& exception)
+				{
+					lpSession->Disconnect();
 
-					continue;
+					delete lpSession;
+
+					throw Exception(
+						Move(exception),
+						"Error adding Session to SocketPoller"
+					);
 				}
+			}
+#endif
 
-				++it;
+			sessionSlotFree   = slot.NextFree;
+			slot.lpSession    = lpSession;
+			slot.NextFree     = SESSION_SLOT_NONE;
+			lpSession->handle = handle;
+
+			++sessionCount;
+		}
+
+		Void RemoveSession(Session& session)
+		{
+			auto  index = static_cast<uint32>(session.handle & Integer<uint32>::Maximum);
+			auto& slot  = sessionSlots[index];
+
+			// a stale handle never matches a reused slot
+			if (++slot.Generation == 0)
+			{
+
+				slot.Generation = 1;
 			}
+
+			slot.lpSession  = nullptr;
+			slot.NextFree   = sessionSlotFree;
+			sessionSlotFree = index;
+			session.handle  = 0;
+
+			--sessionCount;
 		}
 	};
 }
@@ -8,6 +8,13 @@ namespace AL::Game::Network
 	template<typename T_OPCODE>
 	class Server;
 
+	template<typename T_OPCODE>
+	struct ServerShardConnection;
+
+	// Slot index in the low 32 bits, slot generation in the high 32 bits
+	// - 0 is never a valid handle
+	typedef uint64 ServerSessionHandle;
+
 	template<typename T_OPCODE>
 	class ServerSession
 		: public Session<SessionTypes::Server, T_OPCODE>
@@ -15,17 +22,26 @@ namespace AL::Game::Network
 		typedef Server<T_OPCODE>                        _Server;
 		typedef Session<SessionTypes::Server, T_OPCODE> _Session;
 
-		_Server* const lpServer;
+		friend _Server;
+
+		_Server* const                   lpServer;
+		ServerSessionHandle              handle = 0;
+
+		// sharded mode, the shard owns the socket and data is handed to it once per tick
+		ServerShardConnection<T_OPCODE>* lpConnection = nullptr;
+		size_t                           shardIndex = 0;
+		Collections::Array<uint8>        shardSendBuffer;
+		size_t                           shardSendBufferSize = 0;
 
 	public:
 		typedef typename _Session::OPCode OPCode;
 		typedef typename _Session::Packet Packet;
 
-		ServerSession(_Server& server, Socket&& socket, size_t receiveBufferSize, size_t packetBuilderBufferSize)
+		ServerSession(_Server& server, Socket&& socket, size_t receiveBufferSize, size_t packetBufferSize)
 			: _Session(
 				Move(socket),
 				receiveBufferSize,
-				packetBuilderBufferSize
+				packetBufferSize
 			),
 			lpServer(
 				&server
@@ -33,6 +49,11 @@ namespace AL::Game::Network
 		{
 		}
 
+		auto GetHandle() const
+		{
+			return handle;
+		}
+
 		auto& GetServer()
 		{
 			return *lpServer;
@@ -41,5 +62,91 @@ namespace AL::Game::Network
 		{
 			return *lpServer;
 		}
+
+	protected:
+		virtual Void OnDisconnect() override
+		{
+			if (handle != 0)
+			{
+
+				lpServer->Handle_OnSessionDisconnect(
+					*this
+				);
+			}
+		}
+
+		// @throw AL::Exception
+		// @return AL::False if the send buffer size limit is exceeded
+		virtual Bool SendBuffer(const Void* lpBuffer, size_t size) override
+		{
+			Bool isIdle;
+
+			if (lpConnection == nullptr)
+			{
+				isIdle = this->GetSendStatistics().QueuedBytes == 0;
+
+				if (!_Session::SendBuffer(lpBuffer, size))
+				{
+
+					return False;
+				}
+			}
+			else
+			{
+				isIdle = shardSendBufferSize == 0;
+
+				if (!SendShardBuffer(lpBuffer, size))
+				{
+
+					return False;
+				}
+			}
+
+			if (isIdle)
+			{
+
+				lpServer->Handle_OnSessionSend(
+					*this
+				);
+			}
+
+			return True;
+		}
+
+	private:
+		// @return AL::False if the send buffer size limit is exceeded
+		Bool SendShardBuffer(const Void* lpBuffer, size_t size)
+		{
+			if ((shardSendBufferSize + size) > this->GetSendBufferSizeLimit())
+			{
+
+				return False;
+			}
+
+			if ((shardSendBuffer.GetCapacity() - shardSendBufferSize) < size)
+			{
+				auto capacity = (shardSendBuffer.GetCapacity() != 0) ? (shardSendBuffer.GetCapacity() * 2) : _Session::SEND_BUFFER_SIZE_MINIMUM;
+
+				while (capacity < (shardSendBufferSize + size))
+				{
+
+					capacity *= 2;
+				}
+
+				shardSendBuffer.SetSize(
+					capacity
+				);
+			}
+
+			memcpy(
+				&shardSendBuffer[shardSendBufferSize],
+				lpBuffer,
+				size
+			);
+
+			shardSendBufferSize += size;
+
+			return True;
+		}
 	};
 }
@@ -0,0 +1,560 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#if !defined(AL_PLATFORM_LINUX)
+	#error Platform not supported
+#endif
+
+#include "Socket.hpp"
+#include "ServerSession.hpp"
+
+#include "Protocol/Packet.hpp"
+#include "Protocol/PacketReceiveBuffer.hpp"
+
+#include "AL/OS/Thread.hpp"
+
+#include "AL/Network/SocketPoller.hpp"
+
+#include "AL/Collections/Array.hpp"
+#include "AL/Collections/MPSCQueue.hpp"
+#include "AL/Collections/RingBuffer.hpp"
+
+#include <atomic>
+
+namespace AL::Game::Network
+{
+	enum class ServerShardMessageTypes : uint8
+	{
+		Packet,
+		Disconnected
+	};
+
+	// Sent from a shard to the game thread
+	template<typename T_OPCODE>
+	struct ServerShardMessage
+	{
+		ServerShardMessageTypes    Type;
+		ServerSessionHandle        Session;
+		Protocol::Packet<T_OPCODE> Packet;
+	};
+
+	// Socket and framing state of a session owned by a shard
+	template<typename T_OPCODE>
+	struct ServerShardConnection
+	{
+		Socket                                  ClientSocket;
+		Protocol::PacketReceiveBuffer<T_OPCODE> ReceiveBuffer;
+		// data the socket did not accept yet, written when the socket becomes writable
+		Collections::RingBuffer                 SendBuffer;
+		size_t                                  SendBufferSizeLimit;
+		ServerSessionHandle                     Session;
+		// closed by the shard, waiting for Release
+		Bool                                    IsClosed;
+	};
+
+	// Owns the sockets of a subset of the sessions and performs their I/O on a dedicated thread
+	// - Packets are framed on the shard and delivered to the game thread through a lock-free queue
+	// - Outgoing data is handed over once per tick per session and written without blocking
+	// - Connections queuing more than their send buffer size limit are closed
+	template<typename T_OPCODE>
+	class ServerShard
+	{
+		typedef T_OPCODE                    _OPCode;
+		typedef Protocol::Packet<_OPCode>   _Packet;
+		typedef ServerShardMessage<_OPCode> _Message;
+
+	public:
+		typedef ServerShardConnection<_OPCode>         Connection;
+		// one message per packet, nodes are recycled
+		typedef Collections::MPSCQueue<_Message, True> MessageQueue;
+
+	private:
+		enum class CommandTypes : uint8
+		{
+			Add,
+			Send,
+			Release
+		};
+
+		struct Command
+		{
+			CommandTypes              Type;
+			Connection*               lpConnection;
+			Collections::Array<uint8> Buffer;
+			size_t                    BufferSize;
+		};
+
+		::std::atomic<Bool>                   isRunning;
+		Bool                                  isWakeupPending = False;
+
+		OS::Thread                            thread;
+		AL::Network::SocketPoller             poller;
+
+		Collections::MPSCQueue<Command>       commands;
+		MessageQueue*                         lpMessages;
+
+		ServerShard(ServerShard&&) = delete;
+		ServerShard(const ServerShard&) = delete;
+
+	public:
+		explicit ServerShard(MessageQueue& messages)
+			: isRunning(
+				False
+			),
+			lpMessages(
+				&messages
+			)
+		{
+		}
+
+		virtual ~ServerShard()
+		{
+			if (IsRunning())
+			{
+
+				Stop();
+			}
+		}
+
+		Bool IsRunning() const
+		{
+			return isRunning.load(
+				::std::memory_order_acquire
+			);
+		}
+
+		// @throw AL::Exception
+		Void Start()
+		{
+			AL_ASSERT(
+				!IsRunning(),
+				"ServerShard already running"
+			);
+
+			poller.Open();
+
+			poller.OnWakeup.Register(
+				[this]()
+				{
+					Handle_Commands();
+				}
+			);
+
+			isRunning.store(
+				True,
+				::std::memory_order_release
+			);
+
+			try
+			{
+				thread.Start(
+					[this]()
+					{
+						Thread_Main();
+					}
+				);
+			}
+			catch (Exception& exception)
+			{
+				isRunning.store(
+					False,
+					::std::memory_order_release
+				);
+
+				poller.OnWakeup.Clear();
+				poller.Close();
+
+				throw Exception(
+					Move(exception),
+					"Error starting OS::Thread"
+				);
+			}
+		}
+
+		// Connections must be released first
+		// @throw AL::Exception
+		Void Stop()
+		{
+			if (IsRunning())
+			{
+				isRunning.store(
+					False,
+					::std::memory_order_release
+				);
+
+				poller.Wakeup();
+
+				thread.Join();
+
+				poller.OnWakeup.Clear();
+				poller.Close();
+
+				isWakeupPending = False;
+			}
+		}
+
+		// Game thread
+		// @throw AL::Exception
+		Void Add(Connection* lpConnection)
+		{
+			commands.Enqueue(
+				Command
+				{
+					.Type         = CommandTypes::Add,
+					.lpConnection = lpConnection,
+					.Buffer       = Collections::Array<uint8>(),
+					.BufferSize   = 0
+				}
+			);
+
+			isWakeupPending = True;
+		}
+
+		// Game thread
+		// @throw AL::Exception
+		Void Send(Connection* lpConnection, Collections::Array<uint8>&& buffer, size_t size)
+		{
+			commands.Enqueue(
+				Command
+				{
+					.Type         = CommandTypes::Send,
+					.lpConnection = lpConnection,
+					.Buffer       = Move(buffer),
+					.BufferSize   = size
+				}
+			);
+
+			isWakeupPending = True;
+		}
+
+		// Closes the connection if still open and deletes it
+		// - Game thread
+		// @throw AL::Exception
+		Void Release(Connection* lpConnection)
+		{
+			commands.Enqueue(
+				Command
+				{
+					.Type         = CommandTypes::Release,
+					.lpConnection = lpConnection,
+					.Buffer       = Collections::Array<uint8>(),
+					.BufferSize   = 0
+				}
+			);
+
+			isWakeupPending = True;
+		}
+
+		// Wakes the shard once for every command queued since the last flush
+		// - Game thread
+		// @throw AL::Exception
+		Void Flush()
+		{
+			if (isWakeupPending)
+			{
+				isWakeupPending = False;
+
+				poller.Wakeup();
+			}
+		}
+
+	private:
+		Void Thread_Main()
+		{
+			while (IsRunning())
+			{
+				try
+				{
+					poller.Poll();
+				}
+				catch (Exception&)
+				{
+					// connection errors are handled by Handle_Connection, anything else is fatal to the shard
+					break;
+				}
+			}
+
+			// releases queued during shutdown
+			try
+			{
+				Handle_Commands();
+			}
+			catch (Exception&)
+			{
+			}
+		}
+
+		// @throw AL::Exception
+		Void Handle_Commands()
+		{
+			commands.DequeueAll(
+				[this](Command&& _command)
+				{
+					auto lpConnection = _command.lpConnection;
+
+					switch (_command.Type)
+					{
+						case CommandTypes::Add:
+						{
+							try
+							{
+								// writable events only matter while data is queued
+								poller.Add(
+									lpConnection->ClientSocket,
+									AL::Network::SocketPollerEvents::Read | AL::Network::SocketPollerEvents::Write | AL::Network::SocketPollerEvents::HangUp,
+									AL::Network::SocketPollerModes::Edge,
+									[this, lpConnection](AL::Network::ISocket& __socket, AL::Network::SocketPollerEvents __events)
+									{
+										if (BitMask<AL::Network::SocketPollerEvents>::IsSet(__events, AL::Network::SocketPollerEvents::Write))
+										{
+
+											Handle_Connection_Send(
+												*lpConnection
+											);
+										}
+
+										if (__events != AL::Network::SocketPollerEvents::Write)
+										{
+
+											Handle_Connection(
+												*lpConnection
+											);
+										}
+									}
+								);
+							}
+							catch (Exception&)
+							{
+
+								Close(*lpConnection);
+							}
+						}
+						break;
+
+						case CommandTypes::Send:
+						{
+							if (!lpConnection->IsClosed)
+							{
+
+								Send(
+									*lpConnection,
+									&_command.Buffer[0],
+									_command.BufferSize
+								);
+							}
+						}
+						break;
+
+						case CommandTypes::Release:
+						{
+							if (!lpConnection->IsClosed)
+							{
+								poller.Remove(
+									lpConnection->ClientSocket
+								);
+
+								lpConnection->ClientSocket.Close();
+							}
+
+							delete lpConnection;
+						}
+						break;
+					}
+				}
+			);
+		}
+
+		// @throw AL::Exception
+		Void Handle_Connection(Connection& connection)
+		{
+			try
+			{
+				// edge triggered, receive until the socket would block
+				while (!connection.IsClosed)
+				{
+					auto segment = connection.ReceiveBuffer.GetReceiveSegment();
+
+					size_t numberOfBytesReceived;
+
+					if (!connection.ClientSocket.Receive(segment.lpBuffer, segment.Size, numberOfBytesReceived))
+					{
+						Close(
+							connection
+						);
+
+						break;
+					}
+
+					if (numberOfBytesReceived == 0)
+					{
+
+						break;
+					}
+
+					connection.ReceiveBuffer.Commit(
+						numberOfBytesReceived
+					);
+
+					// packets cross threads, the message owns a copy
+					connection.ReceiveBuffer.Dequeue(
+						[this, &connection](_Packet& _packet)
+						{
+							lpMessages->Enqueue(
+								_Message
+								{
+									.Type    = ServerShardMessageTypes::Packet,
+									.Session = connection.Session,
+									.Packet  = _Packet(_packet)
+								}
+							);
+
+							return True;
+						}
+					);
+				}
+			}
+			catch (Exception&)
+			{
+				// malformed packets close the connection
+				Close(
+					connection
+				);
+			}
+		}
+
+		// Writes the data directly while nothing is queued, the rest is written by Handle_Connection_Send
+		Void Send(Connection& connection, const uint8* lpBuffer, size_t size)
+		{
+			try
+			{
+				if (connection.SendBuffer.GetSize() == 0)
+				{
+					size_t numberOfBytesSent;
+
+					if (!connection.ClientSocket.Send(lpBuffer, size, numberOfBytesSent, AL::Network::SocketFlags::NoSignal))
+					{
+						Close(
+							connection
+						);
+
+						return;
+					}
+
+					lpBuffer += numberOfBytesSent;
+					size     -= numberOfBytesSent;
+				}
+
+				if (size != 0)
+				{
+					auto sendBufferSize = connection.SendBuffer.GetSize();
+
+					// slow client
+					if ((sendBufferSize + size) > connection.SendBufferSizeLimit)
+					{
+						Close(
+							connection
+						);
+
+						return;
+					}
+
+					if (connection.SendBuffer.GetFreeSize() < size)
+					{
+						auto capacity = (connection.SendBuffer.GetCapacity() != 0) ? (connection.SendBuffer.GetCapacity() * 2) : size;
+
+						while (capacity < (sendBufferSize + size))
+						{
+
+							capacity *= 2;
+						}
+
+						connection.SendBuffer.SetCapacity(
+							(capacity <= connection.SendBufferSizeLimit) ? capacity : connection.SendBufferSizeLimit
+						);
+					}
+
+					connection.SendBuffer.Write(
+						lpBuffer,
+						size
+					);
+				}
+			}
+			catch (Exception&)
+			{
+				Close(
+					connection
+				);
+			}
+		}
+
+		Void Handle_Connection_Send(Connection& connection)
+		{
+			try
+			{
+				while (!connection.IsClosed && (connection.SendBuffer.GetSize() != 0))
+				{
+					Collections::RingBufferSegment segments[2];
+					SocketBuffer                   buffers[2];
+					size_t                         bufferCount = connection.SendBuffer.GetReadSegments(segments);
+
+					for (size_t i = 0; i < bufferCount; ++i)
+					{
+						buffers[i].lpBuffer = segments[i].lpBuffer;
+						buffers[i].Size     = segments[i].Size;
+					}
+
+					size_t numberOfBytesSent;
+
+					if (!connection.ClientSocket.Send(&buffers[0], bufferCount, numberOfBytesSent, AL::Network::SocketFlags::NoSignal))
+					{
+						Close(
+							connection
+						);
+
+						break;
+					}
+
+					if (numberOfBytesSent == 0)
+					{
+
+						break;
+					}
+
+					connection.SendBuffer.Skip(
+						numberOfBytesSent
+					);
+				}
+			}
+			catch (Exception&)
+			{
+				Close(
+					connection
+				);
+			}
+		}
+
+		// @throw AL::Exception
+		Void Close(Connection& connection)
+		{
+			if (!connection.IsClosed)
+			{
+				connection.IsClosed = True;
+
+				poller.Remove(
+					connection.ClientSocket
+				);
+
+				connection.ClientSocket.Close();
+
+				lpMessages->Enqueue(
+					_Message
+					{
+						.Type    = ServerShardMessageTypes::Disconnected,
+						.Session = connection.Session,
+						.Packet  = _Packet()
+					}
+				);
+			}
+		}
+	};
+}
@@ -5,9 +5,12 @@
 
 #include "Protocol/Packet.hpp"
 #include "Protocol/PacketRouter.hpp"
-#include "Protocol/PacketBuilder.hpp"
+#include "Protocol/PacketReceiveBuffer.hpp"
+
+#include "AL/OS/Timer.hpp"
 
 #include "AL/Collections/Array.hpp"
+#include "AL/Collections/RingBuffer.hpp"
 
 namespace AL::Game::Network
 {
@@ -30,25 +33,52 @@ namespace AL::Game::Network
 	typedef EventHandler<Void()>                                  SessionOnConnectedEventHandler;
 	typedef EventHandler<Void()>                                  SessionOnDisconnectedEventHandler;
 
+	struct SessionSendStatistics
+	{
+		// bytes waiting to be sent
+		size_t   QueuedBytes;
+		size_t   QueuedBytesMaximum;
+		// time between data being queued and the queue being fully flushed
+		TimeSpan FlushLatency;
+		TimeSpan FlushLatencyMaximum;
+		uint64   FlushCount;
+	};
+
+	// Packets are queued by Send and written with a single system call by Flush
+	// - Client sessions are flushed by Update, server sessions once per Server::Update
+	// - Sessions queuing more than the send buffer size limit are disconnected
+	// Packets are framed in place in the receive buffer
+	// - Packets passed to handlers reference the receive buffer, copy them to keep them after the handler returns
 	template<SessionTypes TYPE, typename T_OPCODE>
 	class Session
 	{
-		typedef T_OPCODE                         _OPCode;
-		typedef Protocol::Packet<_OPCode>        _Packet;
-		typedef Protocol::PacketRouter<_OPCode>  _PacketRouter;
-		typedef Protocol::PacketBuilder<_OPCode> _PacketBuilder;
+		typedef T_OPCODE                               _OPCode;
+		typedef Protocol::Packet<_OPCode>              _Packet;
+		typedef Protocol::PacketRouter<_OPCode>        _PacketRouter;
+		typedef Protocol::PacketReceiveBuffer<_OPCode> _PacketReceiveBuffer;
 
 		Socket*                   lpSocket = nullptr;
 
-		Collections::Array<uint8> recvBuffer;
+		_PacketReceiveBuffer      recvBuffer;
+
+		Collections::RingBuffer   sendBuffer;
+		size_t                    sendBufferSizeLimit = SEND_BUFFER_SIZE_LIMIT;
+		// time since the send buffer was last empty
+		OS::Timer                 sendTimer;
+		SessionSendStatistics     sendStatistics = { };
 
-		_Packet                   packet;
 		_PacketRouter             packetRouter;
-		_PacketBuilder            packetBuilder;
 
 		IPEndPoint                localEndPoint;
 		IPEndPoint                remoteEndPoint;
 
+#if defined(AL_PLATFORM_LINUX)
+		// closed connections are reported by Send instead of raising SIGPIPE
+		static constexpr SocketFlags SEND_FLAGS = SocketFlags::NoSignal;
+#else
+		static constexpr SocketFlags SEND_FLAGS = SocketFlags::None;
+#endif
+
 		Session(Session&&) = delete;
 		Session(const Session&) = delete;
 
@@ -57,6 +87,9 @@ namespace AL::Game::Network
 		typedef _Packet                               Packet;
 		typedef typename _PacketRouter::PacketHandler PacketHandler;
 
+		static constexpr size_t SEND_BUFFER_SIZE_LIMIT   = 0x100000;
+		static constexpr size_t SEND_BUFFER_SIZE_MINIMUM = 0x400;
+
 		// @throw AL::Exception
 		Event<SessionOnSendEventHandler>         OnSend;
 		// @throw AL::Exception
@@ -71,28 +104,22 @@ namespace AL::Game::Network
 		Event<SessionOnDisconnectedEventHandler> OnDisconnected;
 
 		template<SessionTypes _TYPE = TYPE>
-		Session(typename Enable_If<_TYPE == SessionTypes::Client, size_t>::Type receiveBufferSize, size_t packetBuilderBufferSize)
+		Session(typename Enable_If<_TYPE == SessionTypes::Client, size_t>::Type receiveBufferSize, size_t packetBufferSize)
 			: recvBuffer(
-				receiveBufferSize
-			),
-			packetBuilder(
-				packetBuilderBufferSize
+				receiveBufferSize + packetBufferSize
 			)
 		{
 		}
 
 		template<SessionTypes _TYPE = TYPE>
-		Session(Socket&& socket, typename Enable_If<_TYPE == SessionTypes::Server, size_t>::Type receiveBufferSize, size_t packetBuilderBufferSize)
+		Session(Socket&& socket, typename Enable_If<_TYPE == SessionTypes::Server, size_t>::Type receiveBufferSize, size_t packetBufferSize)
 			: lpSocket(
 				new Socket(
 					Move(socket)
 				)
 			),
 			recvBuffer(
-				receiveBufferSize
-			),
-			packetBuilder(
-				packetBuilderBufferSize
+				receiveBufferSize + packetBufferSize
 			),
 			localEndPoint(
 				lpSocket->GetLocalEndPoint()
@@ -127,6 +154,21 @@ namespace AL::Game::Network
 			return remoteEndPoint;
 		}
 
+		auto& GetSendStatistics() const
+		{
+			return sendStatistics;
+		}
+
+		auto GetSendBufferSizeLimit() const
+		{
+			return sendBufferSizeLimit;
+		}
+
+		Void SetSendBufferSizeLimit(size_t value)
+		{
+			sendBufferSizeLimit = value;
+		}
+
 		// @throw AL::Exception
 		// @return AL::False on timeout
 		template<SessionTypes _TYPE = TYPE>
@@ -224,8 +266,21 @@ namespace AL::Game::Network
 		{
 			if (IsConnected())
 			{
+				// data queued before Disconnect is sent if the socket accepts it
+				try
+				{
+					Handle_Flush();
+				}
+				catch (Exception&)
+				{
+				}
+
+				OnDisconnect();
+
 				lpSocket->Close();
 
+				Handle_OnDisconnected();
+
 				try
 				{
 					OnDisconnected.Execute();
@@ -254,9 +309,7 @@ namespace AL::Game::Network
 				return False;
 			}
 
-			size_t numberOfBytesSent;
-
-			if (!SocketExtensions::SendAll(*lpSocket, packet.GetBuffer(), packet.GetBufferSize(), numberOfBytesSent))
+			if (!SendBuffer(packet.GetBuffer(), packet.GetBufferSize()))
 			{
 				Disconnect();
 
@@ -298,6 +351,36 @@ namespace AL::Game::Network
 				return False;
 			}
 
+			if constexpr (TYPE == SessionTypes::Client)
+			{
+				if (!Flush())
+				{
+
+					return False;
+				}
+			}
+
+			return True;
+		}
+
+		// Sends queued data without blocking, data the socket does not accept stays queued
+		// @throw AL::Exception
+		// @return AL::False on connection closed
+		Bool Flush()
+		{
+			if (!IsConnected())
+			{
+
+				return False;
+			}
+
+			if (!Handle_Flush())
+			{
+				Disconnect();
+
+				return False;
+			}
+
 			return True;
 		}
 
@@ -317,7 +400,142 @@ namespace AL::Game::Network
 			);
 		}
 
+	protected:
+		auto& GetSocket()
+		{
+			return *lpSocket;
+		}
+		auto& GetSocket() const
+		{
+			return *lpSocket;
+		}
+
+		// Executed by Disconnect while the socket is still open
+		virtual Void OnDisconnect()
+		{
+		}
+
+		// @throw AL::Exception
+		// @return AL::False on connection closed
+		// @return AL::False if the send buffer size limit is exceeded
+		virtual Bool SendBuffer(const Void* lpBuffer, size_t size)
+		{
+			auto sendBufferSize = sendBuffer.GetSize();
+
+			if ((sendBufferSize + size) > sendBufferSizeLimit)
+			{
+
+				return False;
+			}
+
+			if (sendBuffer.GetFreeSize() < size)
+			{
+				auto capacity = (sendBuffer.GetCapacity() != 0) ? (sendBuffer.GetCapacity() * 2) : SEND_BUFFER_SIZE_MINIMUM;
+
+				while (capacity < (sendBufferSize + size))
+				{
+
+					capacity *= 2;
+				}
+
+				sendBuffer.SetCapacity(
+					(capacity <= sendBufferSizeLimit) ? capacity : sendBufferSizeLimit
+				);
+			}
+
+			if (sendBufferSize == 0)
+			{
+
+				sendTimer.Reset();
+			}
+
+			sendBuffer.Write(
+				lpBuffer,
+				size
+			);
+
+			if ((sendStatistics.QueuedBytes = sendBuffer.GetSize()) > sendStatistics.QueuedBytesMaximum)
+			{
+
+				sendStatistics.QueuedBytesMaximum = sendStatistics.QueuedBytes;
+			}
+
+			return True;
+		}
+
+		// Routes a received packet
+		// @throw AL::Exception
+		// @return AL::False if unhandled (the session is disconnected)
+		Bool ExecutePacket(Packet& packet)
+		{
+			if (!packetRouter.Execute(packet))
+			{
+				Disconnect();
+
+				return False;
+			}
+
+			return True;
+		}
+
 	private:
+		// @throw AL::Exception
+		// @return AL::False on connection closed
+		Bool Handle_Flush()
+		{
+			if (sendBuffer.GetSize() == 0)
+			{
+
+				return True;
+			}
+
+			do
+			{
+				Collections::RingBufferSegment segments[2];
+				SocketBuffer                   buffers[2];
+				size_t                         bufferCount = sendBuffer.GetReadSegments(segments);
+
+				for (size_t i = 0; i < bufferCount; ++i)
+				{
+					buffers[i].lpBuffer = segments[i].lpBuffer;
+					buffers[i].Size     = segments[i].Size;
+				}
+
+				size_t numberOfBytesSent;
+
+				if (!lpSocket->Send(&buffers[0], bufferCount, numberOfBytesSent, SEND_FLAGS))
+				{
+
+					return False;
+				}
+
+				if (numberOfBytesSent == 0)
+				{
+
+					break;
+				}
+
+				sendBuffer.Skip(
+					numberOfBytesSent
+				);
+			} while (sendBuffer.GetSize() != 0);
+
+			if ((sendStatistics.QueuedBytes = sendBuffer.GetSize()) == 0)
+			{
+				sendStatistics.FlushLatency = sendTimer.GetElapsed();
+
+				if (sendStatistics.FlushLatency > sendStatistics.FlushLatencyMaximum)
+				{
+
+					sendStatistics.FlushLatencyMaximum = sendStatistics.FlushLatency;
+				}
+
+				++sendStatistics.FlushCount;
+			}
+
+			return True;
+		}
+
 		// @throw AL::Exception
 		Void Handle_OnConnected()
 		{
@@ -325,7 +543,10 @@ namespace AL::Game::Network
 
 		Void Handle_OnDisconnected()
 		{
-			packetBuilder.Clear();
+			recvBuffer.Clear();
+
+			sendBuffer.Clear();
+			sendStatistics.QueuedBytes = 0;
 		}
 
 		// @throw AL::Exception
@@ -336,9 +557,6 @@ namespace AL::Game::Network
 		// @throw AL::Exception
 		Void Handle_OnReceive(const Void* lpBuffer, size_t size)
 		{
-			if (packetBuilder.Append(lpBuffer, size))
-			{
-			}
 		}
 
 		// @throw AL::Exception
@@ -371,9 +589,11 @@ namespace AL::Game::Network
 		{
 			while (IsConnected())
 			{
+				auto segment = recvBuffer.GetReceiveSegment();
+
 				size_t numberOfBytesReceived;
 
-				if (!lpSocket->Receive(&recvBuffer[0], recvBuffer.GetCapacity(), numberOfBytesReceived))
+				if (!lpSocket->Receive(segment.lpBuffer, segment.Size, numberOfBytesReceived))
 				{
 
 					return False;
@@ -385,25 +605,26 @@ namespace AL::Game::Network
 					break;
 				}
 
+				recvBuffer.Commit(
+					numberOfBytesReceived
+				);
+
 				Handle_OnReceive(
-					&recvBuffer[0],
+					segment.lpBuffer,
 					static_cast<size_t>(numberOfBytesReceived)
 				);
 
 				OnReceive.Execute(
-					&recvBuffer[0],
+					segment.lpBuffer,
 					static_cast<size_t>(numberOfBytesReceived)
 				);
 
-				while (packetBuilder.Dequeue(packet))
-				{
-					if (!packetRouter.Execute(packet))
+				recvBuffer.Dequeue(
+					[this](_Packet& _packet)
 					{
-						Disconnect();
-
-						break;
+						return ExecutePacket(_packet) && IsConnected();
 					}
-				}
+				);
 			}
 
 			return True;
@@ -12,6 +12,8 @@ namespace AL::Game::Network
 	typedef AL::Network::AddressFamilies     AddressFamilies;
 
 	typedef AL::Network::TcpSocket           Socket;
+	typedef AL::Network::SocketFlags         SocketFlags;
+	typedef AL::Network::SocketBuffer        SocketBuffer;
 	typedef AL::Network::SocketException     SocketException;
 	typedef AL::Network::SocketExtensions    SocketExtensions;
 	typedef AL::Network::SocketShutdownTypes SocketShutdownTypes;
@@ -1,9 +1,10 @@
 #pragma once
 #include "AL/Common.hpp"
 
-#include "AL/Collections/Dictionary.hpp"
+#include "AL/Collections/HashDictionary.hpp"
 
 namespace AL::Network::HTTP
 {
-	typedef Collections::Dictionary<String, String> Header;
+	// Unordered, fields are written in hash order rather than insertion order
+	typedef Collections::HashDictionary<String, String> Header;
 }
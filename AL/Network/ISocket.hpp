@@ -52,6 +52,12 @@ namespace AL::Network
 
 	AL_DEFINE_ENUM_FLAG_OPERATORS(SocketFlags);
 
+	struct SocketBuffer
+	{
+		const Void* lpBuffer;
+		size_t      Size;
+	};
+
 	class ISocket
 	{
 		ISocket(const ISocket&) = delete;
@@ -0,0 +1,851 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "ISocket.hpp"
+
+#include "AL/OS/Timer.hpp"
+
+#include "AL/Collections/Array.hpp"
+#include "AL/Collections/LinkedList.hpp"
+#include "AL/Collections/HashDictionary.hpp"
+
+#if defined(AL_PLATFORM_LINUX)
+	#include <unistd.h>
+
+	#include <sys/epoll.h>
+	#include <sys/eventfd.h>
+#else
+	#error Platform not supported
+#endif
+
+namespace AL::Network
+{
+	enum class SocketPollerEvents : uint8
+	{
+		None   = 0x0,
+		Read   = 0x1,
+		Write  = 0x2,
+		HangUp = 0x4,
+		// always reported
+		Error  = 0x8
+	};
+
+	AL_DEFINE_ENUM_FLAG_OPERATORS(SocketPollerEvents);
+
+	enum class SocketPollerModes : uint8
+	{
+		// reported until the condition is cleared
+		Level,
+		// reported once per transition, the socket must be drained until it would block
+		Edge
+	};
+
+	typedef uint32 SocketPollerTimer;
+
+	// @throw AL::Exception
+	typedef Function<Void(ISocket& socket, SocketPollerEvents events)> SocketPollerOnReadyEventHandler;
+
+	// @throw AL::Exception
+	typedef Function<Void()>                                           SocketPollerOnWakeupEventHandler;
+
+	// @throw AL::Exception
+	typedef Function<Void(SocketPollerTimer timer)>                    SocketPollerTimerHandler;
+
+	// Dispatches readiness of ISocket handles and timers from a single epoll
+	// - UnixSocket can't be added, it is not an ISocket and its Linux Send/Receive are not implemented
+	class SocketPoller
+	{
+		typedef SocketPollerOnReadyEventHandler _Handler;
+
+		struct Registration
+		{
+			ISocket*           lpSocket;
+			int                Handle;
+			SocketPollerEvents Events;
+			SocketPollerModes  Mode;
+			_Handler           Handler;
+			Bool               IsRemoved;
+		};
+
+		struct Timer
+		{
+			SocketPollerTimer        Id;
+			TimeSpan                 Deadline;
+			TimeSpan                 Interval;
+			Bool                     IsRepeating;
+			SocketPollerTimerHandler Handler;
+		};
+
+		Bool                                                 isOpen          = False;
+		Bool                                                 isPolling       = False;
+
+		int                                                  epoll;
+		int                                                  eventfd;
+
+		OS::Timer                                            clock;
+		Collections::Array<::epoll_event>                    events;
+		Collections::HashDictionary<ISocket*, Registration*> registrations;
+		// removed while polling, released once dispatch completes
+		Collections::LinkedList<Registration*>               releasedRegistrations;
+
+		// sorted by deadline
+		Collections::LinkedList<Timer>                       timers;
+		SocketPollerTimer                                    timerId         = 0;
+		SocketPollerTimer                                    firingTimerId   = 0;
+		Bool                                                 isFiringStopped = False;
+
+		SocketPoller(SocketPoller&&) = delete;
+		SocketPoller(const SocketPoller&) = delete;
+
+	public:
+		static constexpr size_t EVENT_COUNT = 256;
+
+		typedef _Handler Handler;
+
+		// @throw AL::Exception
+		// Executed for sockets added without a handler
+		Event<SocketPollerOnReadyEventHandler>  OnReady;
+
+		// @throw AL::Exception
+		Event<SocketPollerOnWakeupEventHandler> OnWakeup;
+
+		SocketPoller()
+			: SocketPoller(
+				EVENT_COUNT
+			)
+		{
+		}
+
+		// @param eventCount maximum readiness events dispatched per epoll_wait
+		explicit SocketPoller(size_t eventCount)
+			: events(
+				eventCount
+			)
+		{
+		}
+
+		virtual ~SocketPoller()
+		{
+			if (IsOpen())
+			{
+
+				Close();
+			}
+		}
+
+		Bool IsOpen() const
+		{
+			return isOpen;
+		}
+
+		Bool IsPolling() const
+		{
+			return isPolling;
+		}
+
+		auto GetSocketCount() const
+		{
+			return registrations.GetSize();
+		}
+
+		auto GetTimerCount() const
+		{
+			return timers.GetSize();
+		}
+
+		Bool Contains(const ISocket& socket) const
+		{
+			return registrations.Contains(
+				const_cast<ISocket*>(&socket)
+			);
+		}
+
+		// @throw AL::Exception
+		Void Open()
+		{
+			AL_ASSERT(
+				!IsOpen(),
+				"SocketPoller already open"
+			);
+
+			if ((epoll = ::epoll_create1(EPOLL_CLOEXEC)) == -1)
+			{
+
+				throw SocketException(
+					"epoll_create1"
+				);
+			}
+
+			if ((eventfd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) == -1)
+			{
+				auto errorCode = GetLastError();
+
+				::close(
+					epoll
+				);
+
+				throw SocketException(
+					"eventfd",
+					errorCode
+				);
+			}
+
+			// the wakeup event is identified by a null registration
+			::epoll_event event =
+			{
+				.events = EPOLLIN,
+				.data   = { .ptr = nullptr }
+			};
+
+			if (::epoll_ctl(epoll, EPOLL_CTL_ADD, eventfd, &event) == -1)
+			{
+				auto errorCode = GetLastError();
+
+				::close(
+					eventfd
+				);
+
+				::close(
+					epoll
+				);
+
+				throw SocketException(
+					"epoll_ctl",
+					errorCode
+				);
+			}
+
+			clock.Reset();
+
+			isOpen = True;
+		}
+
+		Void Close()
+		{
+			if (IsOpen())
+			{
+				AL_ASSERT(
+					!IsPolling(),
+					"SocketPoller cannot be closed while polling"
+				);
+
+				for (auto& registration : registrations)
+				{
+
+					delete registration.Value;
+				}
+
+				registrations.Clear();
+
+				ReleaseRegistrations();
+
+				timers.Clear();
+
+				::close(
+					eventfd
+				);
+
+				::close(
+					epoll
+				);
+
+				isOpen = False;
+			}
+		}
+
+		// @throw AL::Exception
+		template<typename T_SOCKET>
+		Void Add(T_SOCKET& socket, SocketPollerEvents events, SocketPollerModes mode = SocketPollerModes::Level)
+		{
+			Add(
+				socket,
+				events,
+				mode,
+				Handler()
+			);
+		}
+		// @throw AL::Exception
+		template<typename T_SOCKET, typename F>
+		Void Add(T_SOCKET& socket, SocketPollerEvents events, SocketPollerModes mode, F&& function)
+		{
+			Add(
+				socket,
+				events,
+				mode,
+				Handler(Move(function))
+			);
+		}
+		// @throw AL::Exception
+		template<typename T_SOCKET>
+		Void Add(T_SOCKET& socket, SocketPollerEvents events, SocketPollerModes mode, Handler&& handler)
+		{
+			static_assert(
+				Is_Base_Of<ISocket, T_SOCKET>::Value,
+				"T_SOCKET must inherit ISocket"
+			);
+
+			AL_ASSERT(
+				IsOpen(),
+				"SocketPoller not open"
+			);
+
+			AL_ASSERT(
+				socket.IsOpen(),
+				"T_SOCKET not open"
+			);
+
+			AL_ASSERT(
+				!Contains(socket),
+				"T_SOCKET already added"
+			);
+
+			auto lpRegistration = new Registration
+			{
+				.lpSocket  = &socket,
+				.Handle    = static_cast<int>(socket.GetHandle()),
+				.Events    = events,
+				.Mode      = mode,
+				.Handler   = Move(handler),
+				.IsRemoved = False
+			};
+
+			::epoll_event event =
+			{
+				.events = GetNativeEvents(events, mode),
+				.data   = { .ptr = lpRegistration }
+			};
+
+			if (::epoll_ctl(epoll, EPOLL_CTL_ADD, lpRegistration->Handle, &event) == -1)
+			{
+				auto errorCode = GetLastError();
+
+				delete lpRegistration;
+
+				throw SocketException(
+					"epoll_ctl",
+					errorCode
+				);
+			}
+
+			registrations.Add(
+				&socket,
+				lpRegistration
+			);
+		}
+
+		// @throw AL::Exception
+		Void Modify(ISocket& socket, SocketPollerEvents events)
+		{
+			AL_ASSERT(
+				IsOpen(),
+				"SocketPoller not open"
+			);
+
+			auto it = registrations.Find(
+				&socket
+			);
+
+			AL_ASSERT(
+				it != registrations.end(),
+				"ISocket not added"
+			);
+
+			auto lpRegistration = it->Value;
+
+			if (lpRegistration->Events != events)
+			{
+				::epoll_event event =
+				{
+					.events = GetNativeEvents(events, lpRegistration->Mode),
+					.data   = { .ptr = lpRegistration }
+				};
+
+				if (::epoll_ctl(epoll, EPOLL_CTL_MOD, lpRegistration->Handle, &event) == -1)
+				{
+
+					throw SocketException(
+						"epoll_ctl"
+					);
+				}
+
+				lpRegistration->Events = events;
+			}
+		}
+
+		// @throw AL::Exception
+		// @return AL::False if not found
+		Bool Remove(ISocket& socket)
+		{
+			AL_ASSERT(
+				IsOpen(),
+				"SocketPoller not open"
+			);
+
+			auto it = registrations.Find(
+				&socket
+			);
+
+			if (it == registrations.end())
+			{
+
+				return False;
+			}
+
+			auto lpRegistration = it->Value;
+
+			registrations.Erase(
+				it
+			);
+
+			// ::close already released a closed socket and its handle may have been reused since
+			if (socket.IsOpen() && (::epoll_ctl(epoll, EPOLL_CTL_DEL, lpRegistration->Handle, nullptr) == -1))
+			{
+				auto errorCode = GetLastError();
+
+				if ((errorCode != EBADF) && (errorCode != ENOENT))
+				{
+					ReleaseRegistration(
+						lpRegistration
+					);
+
+					throw SocketException(
+						"epoll_ctl",
+						errorCode
+					);
+				}
+			}
+
+			ReleaseRegistration(
+				lpRegistration
+			);
+
+			return True;
+		}
+
+		// @return timer passed to handler and StopTimer
+		template<typename F>
+		SocketPollerTimer StartTimer(TimeSpan interval, Bool repeat, F&& function)
+		{
+			return StartTimer(
+				interval,
+				repeat,
+				SocketPollerTimerHandler(Move(function))
+			);
+		}
+		// @return timer passed to handler and StopTimer
+		SocketPollerTimer StartTimer(TimeSpan interval, Bool repeat, SocketPollerTimerHandler&& handler)
+		{
+			AL_ASSERT(
+				IsOpen(),
+				"SocketPoller not open"
+			);
+
+			if (++timerId == 0)
+			{
+
+				++timerId;
+			}
+
+			InsertTimer(
+				Timer
+				{
+					.Id          = timerId,
+					.Deadline    = clock.GetElapsed() + interval,
+					.Interval    = interval,
+					.IsRepeating = repeat,
+					.Handler     = Move(handler)
+				}
+			);
+
+			return timerId;
+		}
+
+		// @return AL::False if not found
+		Bool StopTimer(SocketPollerTimer timer)
+		{
+			if ((timer != 0) && (timer == firingTimerId))
+			{
+				isFiringStopped = True;
+
+				return True;
+			}
+
+			for (auto it = timers.begin(); it != timers.end(); ++it)
+			{
+				if (it->Id == timer)
+				{
+					timers.Erase(
+						it
+					);
+
+					return True;
+				}
+			}
+
+			return False;
+		}
+
+		// Interrupts Poll
+		// - Safe to call from any thread
+		// @throw AL::Exception
+		Void Wakeup()
+		{
+			AL_ASSERT(
+				IsOpen(),
+				"SocketPoller not open"
+			);
+
+			uint64 value = 1;
+
+			if (::write(eventfd, &value, sizeof(uint64)) == -1)
+			{
+				auto errorCode = GetLastError();
+
+				// counter saturated, a wakeup is already pending
+				if (errorCode != EAGAIN)
+				{
+
+					throw SocketException(
+						"write",
+						errorCode
+					);
+				}
+			}
+		}
+
+		// Waits until a socket is ready, a timer expires, Wakeup is called or timeout elapses
+		// @throw AL::Exception
+		// @return number of socket readiness events dispatched
+		size_t Poll(TimeSpan timeout = TimeSpan::Infinite)
+		{
+			AL_ASSERT(
+				IsOpen(),
+				"SocketPoller not open"
+			);
+
+			AL_ASSERT(
+				!IsPolling(),
+				"SocketPoller already polling"
+			);
+
+			int eventCount;
+
+			if ((eventCount = ::epoll_wait(epoll, &events[0], static_cast<int>(events.GetCapacity()), GetWaitTimeout(timeout))) == -1)
+			{
+				auto errorCode = GetLastError();
+
+				if (errorCode == EINTR)
+				{
+
+					eventCount = 0;
+				}
+				else
+				{
+
+					throw SocketException(
+						"epoll_wait",
+						errorCode
+					);
+				}
+			}
+
+			size_t count = 0;
+
+			isPolling = True;
+
+			try
+			{
+				for (int i = 0; i < eventCount; ++i)
+				{
+					auto& event          = events[i];
+					auto  lpRegistration = static_cast<Registration*>(event.data.ptr);
+
+					if (lpRegistration == nullptr)
+					{
+						Handle_Wakeup();
+
+						continue;
+					}
+
+					// removed by a previous handler
+					if (lpRegistration->IsRemoved)
+					{
+
+						continue;
+					}
+
+					Handle_Ready(
+						*lpRegistration,
+						GetEvents(event.events)
+					);
+
+					++count;
+				}
+
+				Handle_Timers();
+			}
+			catch (Exception&)
+			{
+				isPolling = False;
+
+				ReleaseRegistrations();
+
+				throw;
+			}
+
+			isPolling = False;
+
+			ReleaseRegistrations();
+
+			return count;
+		}
+
+	private:
+		// @throw AL::Exception
+		Void Handle_Ready(Registration& registration, SocketPollerEvents events)
+		{
+			if (registration.Handler)
+			{
+				registration.Handler(
+					*registration.lpSocket,
+					events
+				);
+			}
+			else
+			{
+				OnReady.Execute(
+					*registration.lpSocket,
+					events
+				);
+			}
+		}
+
+		// @throw AL::Exception
+		Void Handle_Wakeup()
+		{
+			uint64 value;
+
+			if (::read(eventfd, &value, sizeof(uint64)) == -1)
+			{
+				auto errorCode = GetLastError();
+
+				if (errorCode == EAGAIN)
+				{
+
+					return;
+				}
+
+				throw SocketException(
+					"read",
+					errorCode
+				);
+			}
+
+			OnWakeup.Execute();
+		}
+
+		// @throw AL::Exception
+		Void Handle_Timers()
+		{
+			if (timers.GetSize() == 0)
+			{
+
+				return;
+			}
+
+			auto now = clock.GetElapsed();
+
+			// timers started by a handler wait for the next Poll
+			for (auto count = timers.GetSize(); (count != 0) && (timers.GetSize() != 0) && (timers.begin()->Deadline <= now); --count)
+			{
+				auto timer = Move(
+					*timers.begin()
+				);
+
+				timers.PopFront();
+
+				firingTimerId   = timer.Id;
+				isFiringStopped = False;
+
+				try
+				{
+					timer.Handler(
+						timer.Id
+					);
+				}
+				catch (Exception&)
+				{
+					firingTimerId = 0;
+
+					throw;
+				}
+
+				firingTimerId = 0;
+
+				if (timer.IsRepeating && !isFiringStopped)
+				{
+					timer.Deadline += timer.Interval;
+
+					// skip missed intervals instead of firing in a burst
+					if (timer.Deadline <= now)
+					{
+
+						timer.Deadline = now + timer.Interval;
+					}
+
+					InsertTimer(
+						Move(timer)
+					);
+				}
+			}
+		}
+
+		Void InsertTimer(Timer&& timer)
+		{
+			auto it = timers.begin();
+
+			while ((it != timers.end()) && (it->Deadline <= timer.Deadline))
+			{
+
+				++it;
+			}
+
+			timers.Insert(
+				it,
+				Move(timer)
+			);
+		}
+
+		Void ReleaseRegistration(Registration* lpRegistration)
+		{
+			if (IsPolling())
+			{
+				lpRegistration->IsRemoved = True;
+
+				releasedRegistrations.PushBack(
+					lpRegistration
+				);
+
+				return;
+			}
+
+			delete lpRegistration;
+		}
+
+		Void ReleaseRegistrations()
+		{
+			for (auto lpRegistration : releasedRegistrations)
+			{
+
+				delete lpRegistration;
+			}
+
+			releasedRegistrations.Clear();
+		}
+
+		// @throw AL::Exception
+		int GetWaitTimeout(TimeSpan timeout)
+		{
+			auto isInfinite = timeout.ToNanoseconds() >= TimeSpan::Infinite;
+
+			if (timers.GetSize() != 0)
+			{
+				auto now      = clock.GetElapsed();
+				auto deadline = timers.begin()->Deadline;
+
+				if (deadline <= now)
+				{
+
+					return 0;
+				}
+
+				if (isInfinite || ((deadline - now) < timeout))
+				{
+					timeout    = deadline - now;
+					isInfinite = False;
+				}
+			}
+
+			if (isInfinite)
+			{
+
+				return -1;
+			}
+
+			// round up so an expiring timer is not polled early
+			auto milliseconds = (timeout.ToNanoseconds() + 999999) / 1000000;
+
+			if (milliseconds > static_cast<uint64>(Integer<int>::Maximum))
+			{
+
+				milliseconds = Integer<int>::Maximum;
+			}
+
+			return static_cast<int>(
+				milliseconds
+			);
+		}
+
+		static uint32 GetNativeEvents(SocketPollerEvents events, SocketPollerModes mode)
+		{
+			uint32 value = 0;
+
+			if (BitMask<SocketPollerEvents>::IsSet(events, SocketPollerEvents::Read))
+			{
+
+				value |= EPOLLIN;
+			}
+
+			if (BitMask<SocketPollerEvents>::IsSet(events, SocketPollerEvents::Write))
+			{
+
+				value |= EPOLLOUT;
+			}
+
+			if (BitMask<SocketPollerEvents>::IsSet(events, SocketPollerEvents::HangUp))
+			{
+
+				value |= EPOLLRDHUP;
+			}
+
+			if (mode == SocketPollerModes::Edge)
+			{
+
+				value |= EPOLLET;
+			}
+
+			return value;
+		}
+
+		static SocketPollerEvents GetEvents(uint32 value)
+		{
+			auto events = SocketPollerEvents::None;
+
+			if (value & EPOLLIN)
+			{
+
+				events |= SocketPollerEvents::Read;
+			}
+
+			if (value & EPOLLOUT)
+			{
+
+				events |= SocketPollerEvents::Write;
+			}
+
+			if (value & (EPOLLHUP | EPOLLRDHUP))
+			{
+
+				events |= SocketPollerEvents::HangUp;
+			}
+
+			if (value & EPOLLERR)
+			{
+
+				events |= SocketPollerEvents::Error;
+			}
+
+			return events;
+		}
+	};
+}
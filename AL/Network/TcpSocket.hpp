@@ -50,6 +50,9 @@ namespace AL::Network
 		::SOCKET        socket;
 #endif
 
+		// buffers per system call in Send(const SocketBuffer*, ...)
+		static constexpr size_t SEND_BUFFER_COUNT_MAXIMUM = 16;
+
 	public:
 #if defined(AL_PLATFORM_PICO)
 		typedef typename LWIP::TcpSocket::Handle Handle;
@@ -330,6 +333,8 @@ namespace AL::Network
 					"Error binding LWIP::TcpSocket"
 				);
 			}
+
+			localEP = ep;
 #elif defined(AL_PLATFORM_LINUX) || defined(AL_PLATFORM_WINDOWS)
 			auto address = GetNativeSocketAddress(
 				ep
@@ -352,11 +357,39 @@ namespace AL::Network
 				);
 			}
 	#endif
+
+	#if defined(AL_PLATFORM_LINUX)
+			if (GetAddressFamily() == AddressFamilies::Unix)
+			{
+
+				localEP = ep;
+			}
+			else
+	#endif
+			{
+				// reports the port assigned when binding to port 0
+				try
+				{
+					ISocket::GetLocalEndPoint(
+						localEP,
+						GetHandle(),
+						GetType(),
+						GetAddressFamily()
+					);
+				}
+				catch (Exception& exception)
+				{
+
+					throw Exception(
+						Move(exception),
+						"Error getting local end point"
+					);
+				}
+			}
 #else
 			throw NotImplementedException();
 #endif
 
-			localEP = ep;
 			isBound = True;
 		}
 
@@ -879,6 +912,166 @@ namespace AL::Network
 			return True;
 		}
 
+		// Sends multiple buffers with a single system call where supported
+		// @throw AL::Exception
+		// @return AL::False on connection closed
+		virtual Bool Send(const SocketBuffer* lpBuffers, size_t count, size_t& numberOfBytesSent, SocketFlags flags = SocketFlags::None)
+		{
+			AL_ASSERT(
+				IsOpen(),
+				"TcpSocket not open"
+			);
+
+			AL_ASSERT(
+				IsConnected(),
+				"TcpSocket not connected"
+			);
+
+			numberOfBytesSent = 0;
+
+#if defined(AL_PLATFORM_PICO)
+			for (size_t i = 0; i < count; ++i)
+			{
+				size_t bufferNumberOfBytesSent;
+
+				if (!Send(lpBuffers[i].lpBuffer, lpBuffers[i].Size, bufferNumberOfBytesSent, flags))
+				{
+
+					return False;
+				}
+
+				numberOfBytesSent += bufferNumberOfBytesSent;
+
+				if (bufferNumberOfBytesSent < lpBuffers[i].Size)
+				{
+
+					break;
+				}
+			}
+#elif defined(AL_PLATFORM_LINUX)
+			for (size_t i = 0; i < count; )
+			{
+				::iovec buffers[SEND_BUFFER_COUNT_MAXIMUM];
+				size_t  bufferCount = 0;
+				size_t  bufferSize  = 0;
+
+				for (; (i < count) && (bufferCount < SEND_BUFFER_COUNT_MAXIMUM); ++i, ++bufferCount)
+				{
+					buffers[bufferCount].iov_base = const_cast<Void*>(lpBuffers[i].lpBuffer);
+					buffers[bufferCount].iov_len  = lpBuffers[i].Size;
+
+					bufferSize += lpBuffers[i].Size;
+				}
+
+				::msghdr message = {};
+				message.msg_iov    = &buffers[0];
+				message.msg_iovlen = bufferCount;
+
+				ssize_t _numberOfBytesSent;
+
+				if ((_numberOfBytesSent = ::sendmsg(GetHandle(), &message, static_cast<int>(flags))) == -1)
+				{
+					auto errorCode = GetLastError();
+
+					if ((errorCode == EAGAIN) || (errorCode == EWOULDBLOCK))
+					{
+
+						return True;
+					}
+
+					Close();
+
+					if ((errorCode == EHOSTDOWN) || (errorCode == ECONNRESET) || (errorCode == EHOSTUNREACH) || (errorCode == EPIPE))
+					{
+
+						return False;
+					}
+
+					throw SocketException(
+						"sendmsg",
+						errorCode
+					);
+				}
+				else if ((_numberOfBytesSent == 0) && (bufferSize != 0))
+				{
+					Close();
+
+					return False;
+				}
+
+				numberOfBytesSent += static_cast<size_t>(
+					_numberOfBytesSent & Integer<ssize_t>::SignedCastMask
+				);
+
+				if (static_cast<size_t>(_numberOfBytesSent) < bufferSize)
+				{
+
+					break;
+				}
+			}
+#elif defined(AL_PLATFORM_WINDOWS)
+			for (size_t i = 0; i < count; )
+			{
+				::WSABUF buffers[SEND_BUFFER_COUNT_MAXIMUM];
+				::DWORD  bufferCount = 0;
+				size_t   bufferSize  = 0;
+
+				for (; (i < count) && (bufferCount < SEND_BUFFER_COUNT_MAXIMUM); ++i, ++bufferCount)
+				{
+					buffers[bufferCount].buf = reinterpret_cast<CHAR*>(const_cast<Void*>(lpBuffers[i].lpBuffer));
+					buffers[bufferCount].len = static_cast<ULONG>(lpBuffers[i].Size & Integer<ULONG>::Maximum);
+
+					bufferSize += lpBuffers[i].Size;
+				}
+
+				::DWORD _numberOfBytesSent;
+
+				if (::WSASend(GetHandle(), &buffers[0], bufferCount, &_numberOfBytesSent, static_cast<::DWORD>(flags), nullptr, nullptr) == SOCKET_ERROR)
+				{
+					ErrorCode errorCode;
+
+					switch (errorCode = GetLastError())
+					{
+						case WSAEWOULDBLOCK:
+							return True;
+
+						case WSAENETDOWN:
+						case WSAENETRESET:
+						case WSAETIMEDOUT:
+						case WSAECONNRESET:
+						case WSAECONNABORTED:
+						case WSAEHOSTUNREACH:
+							Close();
+							return False;
+					}
+
+					throw SocketException(
+						"WSASend",
+						errorCode
+					);
+				}
+				else if ((_numberOfBytesSent == 0) && (bufferSize != 0))
+				{
+					Close();
+
+					return False;
+				}
+
+				numberOfBytesSent += _numberOfBytesSent;
+
+				if (_numberOfBytesSent < bufferSize)
+				{
+
+					break;
+				}
+			}
+#else
+			throw NotImplementedException();
+#endif
+
+			return True;
+		}
+
 		// @throw AL::Exception
 		// @return AL::False on connection closed
 		virtual Bool Receive(Void* lpBuffer, size_t size, size_t& numberOfBytesReceived, SocketFlags flags = SocketFlags::None)
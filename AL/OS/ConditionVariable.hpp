@@ -121,6 +121,75 @@ namespace AL::OS
 
 			return True;
 		}
+		// @throw AL::Exception
+		// @return AL::False on timeout
+		// mutex must be locked by the caller and is locked again on return
+		Bool Sleep(Mutex& mutex, TimeSpan timeout = TimeSpan::Infinite)
+		{
+#if defined(AL_PLATFORM_WINDOWS)
+			if (!::SleepConditionVariableCS(&condition, &(mutex.operator AL::OS::Mutex::Type&()), (timeout == TimeSpan::Infinite) ? INFINITE : static_cast<::DWORD>(timeout.ToMilliseconds())))
+			{
+				auto errorCode = GetLastError();
+
+				if (errorCode == ERROR_TIMEOUT)
+				{
+
+					return False;
+				}
+
+				throw SystemException(
+					"SleepConditionVariableCS",
+					errorCode
+				);
+			}
+#else
+			std::unique_lock<std::mutex> lock(
+				mutex,
+				::std::adopt_lock
+			);
+
+			::std::cv_status status = ::std::cv_status::no_timeout;
+
+			try
+			{
+				if (timeout == TimeSpan::Infinite)
+				{
+
+					condition.wait(
+						lock
+					);
+				}
+				else
+				{
+
+					status = condition.wait_for(
+						lock,
+						::std::chrono::milliseconds(
+							timeout.ToMilliseconds()
+						)
+					);
+				}
+			}
+			catch (const ::std::exception& exception)
+			{
+				lock.release();
+
+				throw Exception(
+					exception.what()
+				);
+			}
+
+			lock.release();
+
+			if (status == ::std::cv_status::timeout)
+			{
+
+				return False;
+			}
+#endif
+
+			return True;
+		}
 
 		operator Type& ()
 		{
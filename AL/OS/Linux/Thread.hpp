@@ -8,6 +8,7 @@
 #include "AL/OS/Timer.hpp"
 #include "AL/OS/SystemException.hpp"
 
+#include <atomic>
 #include <unistd.h>
 
 #if !AL_HAS_INCLUDE(<pthread.h>)
@@ -45,6 +46,9 @@ namespace AL::OS::Linux
 
 			virtual Bool IsDetatched() const = 0;
 
+			// Started and not yet joined or detatched
+			virtual Bool IsJoinable() const = 0;
+
 			virtual ::pthread_t* GetHandle() const = 0;
 
 			// @throw AL::Exception
@@ -65,8 +69,9 @@ namespace AL::OS::Linux
 		class NativeThread
 			: public INativeThread
 		{
-			Bool isRunning = False;
-			Bool isDetatched = False;
+			::std::atomic<Bool> isRunning   = False;
+			Bool                isJoinable  = False;
+			Bool                isDetatched = False;
 
 			F function;
 
@@ -94,6 +99,11 @@ namespace AL::OS::Linux
 				return isDetatched;
 			}
 
+			virtual Bool IsJoinable() const override
+			{
+				return isJoinable;
+			}
+
 			virtual ::pthread_t* GetHandle() const override
 			{
 				return const_cast<::pthread_t*>(
@@ -130,8 +140,12 @@ namespace AL::OS::Linux
 
 				ErrorCode errorCode;
 
+				// set before the thread can clear it
+				isRunning = True;
+
 				if ((errorCode = ::pthread_create(&pthread, nullptr, function_detour, this)) != 0)
 				{
+					isRunning = False;
 
 					throw SystemException(
 						"pthread_create",
@@ -139,7 +153,7 @@ namespace AL::OS::Linux
 					);
 				}
 
-				isRunning = True;
+				isJoinable = True;
 			}
 
 			// @throw AL::Exception
@@ -161,6 +175,7 @@ namespace AL::OS::Linux
 					);
 				}
 
+				isJoinable  = False;
 				isDetatched = True;
 			}
 
@@ -191,33 +206,56 @@ namespace AL::OS::Linux
 			virtual Bool Join(TimeSpan maxWaitTime) override
 			{
 				AL_ASSERT(
-					IsRunning(),
-					"NativeThread not running"
+					IsJoinable(),
+					"NativeThread not joinable"
 				);
 
-				Timer timer;
+				ErrorCode errorCode;
+				Void*     threadRetValue;
 
-				while (timer.GetElapsed() < maxWaitTime)
+				if (maxWaitTime == TimeSpan::Infinite)
 				{
-					ErrorCode errorCode;
-					Void*     threadRetValue;
-
 					if ((errorCode = ::pthread_join(pthread, &threadRetValue)) != 0)
 					{
-						if (errorCode == ESRCH)
+
+						throw SystemException(
+							"pthread_join",
+							errorCode
+						);
+					}
+				}
+				else
+				{
+					::timespec deadline;
+
+					::timespec_get(
+						&deadline,
+						TIME_UTC
+					);
+
+					auto deadline_Nanoseconds = (static_cast<uint64>(deadline.tv_sec) * 1000000000) + deadline.tv_nsec + maxWaitTime.ToNanoseconds();
+					deadline.tv_sec           = static_cast<::time_t>(deadline_Nanoseconds / 1000000000);
+					deadline.tv_nsec          = static_cast<long>(deadline_Nanoseconds % 1000000000);
+
+					if ((errorCode = ::pthread_timedjoin_np(pthread, &threadRetValue, &deadline)) != 0)
+					{
+						if (errorCode == ETIMEDOUT)
 						{
 
-							return True;
+							return False;
 						}
 
 						throw SystemException(
-							"pthread_join",
+							"pthread_timedjoin_np",
 							errorCode
 						);
 					}
 				}
 
-				return !IsRunning();
+				isJoinable = False;
+				isRunning  = False;
+
+				return True;
 			}
 		};
 
@@ -425,7 +463,8 @@ namespace AL::OS::Linux
 		// @return AL::False if time elapsed and Thread is still running
 		Bool Join(TimeSpan maxWaitTime = TimeSpan::Infinite)
 		{
-			if (IsRunning() && !lpNativeThread->Join(maxWaitTime))
+			// the thread may have already returned without being joined
+			if ((lpNativeThread != nullptr) && lpNativeThread->IsJoinable() && !lpNativeThread->Join(maxWaitTime))
 			{
 
 				return False;
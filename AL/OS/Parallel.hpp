@@ -0,0 +1,286 @@
+#pragma once
+#include "AL/Common.hpp"
+
+#include "ThreadPool.hpp"
+
+#include "AL/Collections/Array.hpp"
+#include "AL/Collections/ArrayList.hpp"
+
+namespace AL::OS
+{
+	class Parallel
+	{
+		// Tasks created per thread when the grain size is chosen automatically
+		// - More tasks than threads lets stolen work even out items of uneven cost
+		static constexpr size_t TASKS_PER_THREAD = 8;
+
+		Parallel() = delete;
+
+	public:
+		// Items per task when grainSize is 0
+		static size_t GetGrainSize(const ThreadPool& pool, size_t count)
+		{
+			// the calling thread executes tasks while waiting
+			auto grainSize = count / ((pool.GetCount() + 1) * TASKS_PER_THREAD);
+
+			return (grainSize != 0) ? grainSize : 1;
+		}
+
+		// Calls function(index) for every index in [begin, end)
+		// @throw AL::Exception if function threw
+		template<typename F>
+		static Void For(ThreadPool& pool, size_t begin, size_t end, F&& function, size_t grainSize = 0)
+		{
+			ForRange(
+				pool,
+				begin,
+				end,
+				grainSize,
+				[&function](size_t _begin, size_t _end)
+				{
+					for (auto i = _begin; i < _end; ++i)
+					{
+						function(
+							i
+						);
+					}
+				}
+			);
+		}
+		// Calls function(value) for every value in array
+		// @throw AL::Exception if function threw
+		template<typename T, typename F>
+		static Void For(ThreadPool& pool, Collections::Array<T>& array, F&& function, size_t grainSize = 0)
+		{
+			ForEach(
+				pool,
+				array,
+				function,
+				grainSize
+			);
+		}
+		// Calls function(value) for every value in arrayList
+		// @throw AL::Exception if function threw
+		template<typename T, typename F>
+		static Void For(ThreadPool& pool, Collections::ArrayList<T>& arrayList, F&& function, size_t grainSize = 0)
+		{
+			ForEach(
+				pool,
+				arrayList,
+				function,
+				grainSize
+			);
+		}
+
+		// Folds [begin, end) with accumulate(T_RESULT, index) and merges the partial results with combine(T_RESULT, T_RESULT)
+		// - Partial results are combined in index order so the result doesn't depend on scheduling
+		// @throw AL::Exception if accumulate threw
+		template<typename T_RESULT, typename F_ACCUMULATE, typename F_COMBINE>
+		static T_RESULT Reduce(ThreadPool& pool, size_t begin, size_t end, const T_RESULT& identity, F_ACCUMULATE&& accumulate, F_COMBINE&& combine, size_t grainSize = 0)
+		{
+			if (end <= begin)
+			{
+
+				return identity;
+			}
+
+			auto count = end - begin;
+
+			if (grainSize == 0)
+			{
+
+				grainSize = GetGrainSize(
+					pool,
+					count
+				);
+			}
+
+			// value/count/reserve overload is unambiguous when T_RESULT is size_t
+			Collections::Array<T_RESULT> results(
+				identity,
+				(count + grainSize - 1) / grainSize,
+				0
+			);
+
+			ForRange(
+				pool,
+				begin,
+				end,
+				grainSize,
+				[begin, grainSize, &accumulate, &results](size_t _begin, size_t _end)
+				{
+					auto& result = results[(_begin - begin) / grainSize];
+
+					for (auto i = _begin; i < _end; ++i)
+					{
+						result = accumulate(
+							Move(result),
+							i
+						);
+					}
+				}
+			);
+
+			T_RESULT result(
+				Move(results[0])
+			);
+
+			for (size_t i = 1; i < results.GetSize(); ++i)
+			{
+				result = combine(
+					Move(result),
+					Move(results[i])
+				);
+			}
+
+			return result;
+		}
+		// Folds array with accumulate(T_RESULT, value) and merges the partial results with combine(T_RESULT, T_RESULT)
+		// @throw AL::Exception if accumulate threw
+		template<typename T, typename T_RESULT, typename F_ACCUMULATE, typename F_COMBINE>
+		static T_RESULT Reduce(ThreadPool& pool, const Collections::Array<T>& array, const T_RESULT& identity, F_ACCUMULATE&& accumulate, F_COMBINE&& combine, size_t grainSize = 0)
+		{
+			return ReduceEach(
+				pool,
+				array,
+				identity,
+				accumulate,
+				combine,
+				grainSize
+			);
+		}
+		// Folds arrayList with accumulate(T_RESULT, value) and merges the partial results with combine(T_RESULT, T_RESULT)
+		// @throw AL::Exception if accumulate threw
+		template<typename T, typename T_RESULT, typename F_ACCUMULATE, typename F_COMBINE>
+		static T_RESULT Reduce(ThreadPool& pool, const Collections::ArrayList<T>& arrayList, const T_RESULT& identity, F_ACCUMULATE&& accumulate, F_COMBINE&& combine, size_t grainSize = 0)
+		{
+			return ReduceEach(
+				pool,
+				arrayList,
+				identity,
+				accumulate,
+				combine,
+				grainSize
+			);
+		}
+
+	private:
+		// Calls function(begin, end) for sub ranges of at most grainSize items
+		// @throw AL::Exception
+		template<typename F>
+		static Void ForRange(ThreadPool& pool, size_t begin, size_t end, size_t grainSize, const F& function)
+		{
+			if (end <= begin)
+			{
+
+				return;
+			}
+
+			if (grainSize == 0)
+			{
+
+				grainSize = GetGrainSize(
+					pool,
+					end - begin
+				);
+			}
+
+			if (!pool.IsRunning() || ((end - begin) <= grainSize))
+			{
+				function(
+					begin,
+					end
+				);
+
+				return;
+			}
+
+			TaskGroup group(
+				pool
+			);
+
+			Split(
+				group,
+				begin,
+				end,
+				grainSize,
+				function
+			);
+
+			group.Wait();
+		}
+
+		// Halves the range until it fits in grainSize, posting the upper halves to group
+		// - Tasks are split again by whichever thread runs (or steals) them
+		template<typename F>
+		static Void Split(TaskGroup& group, size_t begin, size_t end, size_t grainSize, const F& function)
+		{
+			while ((end - begin) > grainSize)
+			{
+				// split on a multiple of grainSize so sub ranges line up with Reduce's results
+				auto chunkCount = (end - begin + grainSize - 1) / grainSize;
+				auto middle     = begin + ((chunkCount / 2) * grainSize);
+
+				group.Post(
+					[&group, middle, end, grainSize, &function]()
+					{
+						Split(
+							group,
+							middle,
+							end,
+							grainSize,
+							function
+						);
+					}
+				);
+
+				end = middle;
+			}
+
+			function(
+				begin,
+				end
+			);
+		}
+
+		template<typename T_COLLECTION, typename F>
+		static Void ForEach(ThreadPool& pool, T_COLLECTION& collection, F& function, size_t grainSize)
+		{
+			ForRange(
+				pool,
+				0,
+				collection.GetSize(),
+				grainSize,
+				[&collection, &function](size_t _begin, size_t _end)
+				{
+					for (auto i = _begin; i < _end; ++i)
+					{
+						function(
+							collection[i]
+						);
+					}
+				}
+			);
+		}
+
+		template<typename T_COLLECTION, typename T_RESULT, typename F_ACCUMULATE, typename F_COMBINE>
+		static T_RESULT ReduceEach(ThreadPool& pool, const T_COLLECTION& collection, const T_RESULT& identity, F_ACCUMULATE& accumulate, F_COMBINE& combine, size_t grainSize)
+		{
+			return Reduce(
+				pool,
+				0,
+				collection.GetSize(),
+				identity,
+				[&collection, &accumulate](T_RESULT&& _result, size_t _index)
+				{
+					return accumulate(
+						Move(_result),
+						collection[_index]
+					);
+				},
+				combine,
+				grainSize
+			);
+		}
+	};
+}
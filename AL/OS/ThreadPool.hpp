@@ -1,29 +1,77 @@
 #pragma once
 #include "AL/Common.hpp"
 
+#include "AL/Common/Future.hpp"
+
+#include "Mutex.hpp"
 #include "Thread.hpp"
+#include "ConditionVariable.hpp"
 
 #include "AL/Collections/Array.hpp"
 #include "AL/Collections/Tuple.hpp"
-#include "AL/Collections/MPSCQueue.hpp"
+#include "AL/Collections/WorkStealingDeque.hpp"
+
+#include <atomic>
 
 namespace AL::OS
 {
+	// Work stealing thread pool
+	// - Tasks posted by a worker are pushed to its own deque
+	// - Tasks posted by any other thread are pushed to a shared injection queue
+	// - Idle workers steal from their peers before sleeping
+	// - Executed tasks are kept for reuse by the worker that executed them, or by the injection queue
+	class TaskGroup;
+
 	class ThreadPool
 	{
-		typedef Function<Void()>                   ThreadTask;
-		typedef Collections::MPSCQueue<ThreadTask> ThreadTaskQueue;
+		friend TaskGroup;
+
+		// Maximum tasks kept for reuse by each worker and by the injection queue
+		static constexpr size_t FREE_TASK_COUNT_MAXIMUM = 256;
+
+		struct ThreadTask
+		{
+			UniqueFunction<Void()> Function;
+			// next task in the injection queue or a free list
+			ThreadTask*            lpNext;
+		};
+
+		typedef Collections::WorkStealingDeque<ThreadTask*> ThreadTaskDeque;
+
+		// tasks that are not queued, only used by one thread or while locked
+		struct ThreadTaskList
+		{
+			ThreadTask* lpFront = nullptr;
+			size_t      Size    = 0;
+		};
 
 		struct ThreadContext
 		{
 			OS::Thread      Thread;
-			ThreadTaskQueue TaskQueue;
+			ThreadTaskDeque TaskDeque;
+			ThreadTaskList  FreeTasks;
+
+			size_t          Index;
+			ThreadPool*     lpPool;
 		};
 
-		Bool isRunning  = False;
-		Bool isStopping = False;
+		Bool                  isRunning  = False;
+		::std::atomic<Bool>   isStopping = False;
+
+		Collections::Array<ThreadContext*> threads;
+
+		Mutex                 taskQueueMutex;
+		ThreadTask*           lpTaskQueueFront = nullptr;
+		ThreadTask*           lpTaskQueueBack  = nullptr;
+		::std::atomic<size_t> taskQueueSize    = 0;
+		ThreadTaskList        freeTasks;
+
+		Mutex                 sleepMutex;
+		ConditionVariable     sleepCondition;
+		::std::atomic<size_t> sleepingThreadCount = 0;
 
-		Collections::Array<ThreadContext> threads;
+		ThreadPool(ThreadPool&&) = delete;
+		ThreadPool(const ThreadPool&) = delete;
 
 	public:
 		explicit ThreadPool(size_t count)
@@ -31,6 +79,14 @@ namespace AL::OS
 				count
 			)
 		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				auto lpContext    = new ThreadContext();
+				lpContext->Index  = i;
+				lpContext->lpPool = this;
+
+				threads[i] = lpContext;
+			}
 		}
 
 		virtual ~ThreadPool()
@@ -40,6 +96,30 @@ namespace AL::OS
 
 				Stop();
 			}
+
+			ThreadTask* lpTask;
+
+			for (auto lpContext : threads)
+			{
+				while (lpContext->TaskDeque.Pop(lpTask))
+				{
+					delete lpTask;
+				}
+
+				DeleteTasks(
+					lpContext->FreeTasks.lpFront
+				);
+
+				delete lpContext;
+			}
+
+			DeleteTasks(
+				lpTaskQueueFront
+			);
+
+			DeleteTasks(
+				freeTasks.lpFront
+			);
 		}
 
 		Bool IsRunning() const
@@ -62,20 +142,20 @@ namespace AL::OS
 
 			for (size_t i = 0; i < threads.GetSize(); ++i)
 			{
-				auto& context = threads[i];
+				auto lpContext = threads[i];
 
 				Function<Void()> threadStart(
-					[this, &context]()
+					[this, lpContext]()
 					{
 						Thread_Main(
-							context
+							*lpContext
 						);
 					}
 				);
 
 				try
 				{
-					context.Thread.Start(
+					lpContext->Thread.Start(
 						Move(threadStart)
 					);
 				}
@@ -93,6 +173,7 @@ namespace AL::OS
 			isRunning = True;
 		}
 
+		// Blocks until every queued task has been executed
 		Void Stop()
 		{
 			if (IsRunning())
@@ -105,67 +186,345 @@ namespace AL::OS
 
 		template<typename F, typename ... TArgs>
 		Void Post(F&& function, TArgs ... args)
+		{
+			PostTask(
+				[f = Move(function), f_args = Collections::Tuple<TArgs ...>(Forward<TArgs>(args) ...)]()
+				{
+					f_args.Invoke(
+						f
+					);
+				}
+			);
+		}
+
+		// Same as Post but the result (or AL::Exception thrown) is delivered through the returned Future
+		template<typename F, typename ... TArgs>
+		auto Submit(F&& function, TArgs ... args)
+		{
+			typedef typename Remove_Const<typename Remove_Reference<decltype(function(args ...))>::Type>::Type T;
+
+			Promise<T> promise;
+			auto       future = promise.GetFuture();
+
+			PostTask(
+				[promise = Move(promise), f = Move(function), f_args = Collections::Tuple<TArgs ...>(Forward<TArgs>(args) ...)]() mutable
+				{
+					try
+					{
+						if constexpr (Is_Type<T, Void>::Value)
+						{
+							f_args.Invoke(
+								f
+							);
+
+							promise.SetValue();
+						}
+						else
+						{
+
+							promise.SetValue(
+								f_args.Invoke(
+									f
+								)
+							);
+						}
+					}
+					catch (Exception& exception)
+					{
+
+						promise.SetException(
+							Move(exception)
+						);
+					}
+				}
+			);
+
+			return future;
+		}
+
+		// Executes a single queued task on the calling thread
+		// @return AL::False if no task was available
+		Bool TryExecuteTask()
+		{
+			auto lpContext = GetCurrentContext();
+
+			if ((lpContext != nullptr) && (lpContext->lpPool != this))
+			{
+
+				lpContext = nullptr;
+			}
+
+			ThreadTask* lpTask;
+
+			if (lpContext != nullptr)
+			{
+				if (!TryGetTask(*lpContext, lpTask))
+				{
+
+					return False;
+				}
+			}
+			// not a worker of this pool so every thread may be stolen from
+			else if (!TryDequeueTask(lpTask) && !TryStealTask(Integer<size_t>::Maximum, lpTask))
+			{
+
+				return False;
+			}
+
+			ExecuteTask(
+				lpContext,
+				lpTask
+			);
+
+			return True;
+		}
+
+	private:
+		template<typename F>
+		Void PostTask(F&& function)
 		{
 			AL_ASSERT(
 				IsRunning(),
 				"ThreadPool not running"
 			);
 
+			auto lpContext = GetCurrentContext();
+
+			if ((lpContext != nullptr) && (lpContext->lpPool != this))
+			{
+
+				lpContext = nullptr;
+			}
+
+			// workers may still post while stopping, their tasks are executed before Stop returns
 			AL_ASSERT(
-				!isStopping,
+				!isStopping || (lpContext != nullptr),
 				"ThreadPool is stopping"
 			);
 
-			ThreadContext* lpThreadContext = &threads[0];
-			ThreadContext* lpSelectedThreadContext = nullptr;
+			if (lpContext != nullptr)
+			{
+				lpContext->TaskDeque.Push(
+					CreateTask(lpContext->FreeTasks, Forward<F>(function))
+				);
+			}
+			else
+			{
+				MutexGuard lock(
+					taskQueueMutex
+				);
+
+				auto lpTask = CreateTask(
+					freeTasks,
+					Forward<F>(function)
+				);
+
+				if (lpTaskQueueBack != nullptr)
+					lpTaskQueueBack->lpNext = lpTask;
+				else
+					lpTaskQueueFront = lpTask;
+
+				lpTaskQueueBack = lpTask;
+
+				taskQueueSize.fetch_add(
+					1,
+					::std::memory_order_release
+				);
+			}
 
-			for (size_t i = 0; i < threads.GetSize(); ++i, ++lpThreadContext)
+			WakeThread();
+		}
+
+		// Reuses a free task if available
+		// @throw AL::Exception
+		template<typename F>
+		static ThreadTask* CreateTask(ThreadTaskList& list, F&& function)
+		{
+			if (auto lpTask = list.lpFront)
 			{
-				if (lpThreadContext->TaskQueue.GetSize() == 0)
-				{
-					lpSelectedThreadContext = lpThreadContext;
+				// bound before it leaves the list so it isn't lost if binding throws
+				lpTask->Function.Bind(
+					Forward<F>(function)
+				);
 
-					break;
-				}
-				else if (lpSelectedThreadContext == nullptr)
-				{
-					lpSelectedThreadContext = lpThreadContext;
+				list.lpFront = lpTask->lpNext;
+				--list.Size;
 
-					if (lpThreadContext->TaskQueue.GetSize() == 0)
-					{
+				lpTask->lpNext = nullptr;
 
-						break;
-					}
-				}
-				else if (lpThreadContext->TaskQueue.GetSize() < lpSelectedThreadContext->TaskQueue.GetSize())
+				return lpTask;
+			}
+
+			return new ThreadTask
+			{
+				.Function = UniqueFunction<Void()>(Forward<F>(function)),
+				.lpNext   = nullptr
+			};
+		}
+
+		// Executes lpTask and keeps it for reuse by lpContext (or the injection queue if nullptr)
+		Void ExecuteTask(ThreadContext* lpContext, ThreadTask* lpTask)
+		{
+			lpTask->Function();
+
+			// captures are released now rather than when the task is reused
+			lpTask->Function.Unbind();
+
+			if ((lpContext != nullptr) && (lpContext->FreeTasks.Size < FREE_TASK_COUNT_MAXIMUM))
+			{
+				lpTask->lpNext = lpContext->FreeTasks.lpFront;
+
+				lpContext->FreeTasks.lpFront = lpTask;
+				++lpContext->FreeTasks.Size;
+
+				return;
+			}
+
+			{
+				MutexGuard lock(
+					taskQueueMutex
+				);
+
+				if (freeTasks.Size < FREE_TASK_COUNT_MAXIMUM)
 				{
+					lpTask->lpNext = freeTasks.lpFront;
+
+					freeTasks.lpFront = lpTask;
+					++freeTasks.Size;
 
-					lpSelectedThreadContext = lpThreadContext;
+					return;
 				}
 			}
 
-			ThreadTask task(
-				[f = Move(function), f_args = Collections::Tuple<TArgs ...>(Forward<TArgs>(args) ...)]()
+			delete lpTask;
+		}
+
+		static Void DeleteTasks(ThreadTask* lpTask)
+		{
+			while (lpTask != nullptr)
+			{
+				auto lpNext = lpTask->lpNext;
+
+				delete lpTask;
+
+				lpTask = lpNext;
+			}
+		}
+
+		static ThreadContext*& GetCurrentContext()
+		{
+			static thread_local ThreadContext* lpContext = nullptr;
+
+			return lpContext;
+		}
+
+		Void StopThreads()
+		{
+			isStopping = True;
+
+			{
+				MutexGuard lock(
+					sleepMutex
+				);
+
+				sleepCondition.WakeAll();
+			}
+
+			for (auto lpContext : threads)
+			{
+				lpContext->Thread.Join();
+			}
+
+			isStopping = False;
+		}
+
+		// Pairs with the check in Thread_Sleep so a task posted while a worker is going to sleep is never missed
+		Void WakeThread()
+		{
+			::std::atomic_thread_fence(
+				::std::memory_order_seq_cst
+			);
+
+			if (sleepingThreadCount.load(::std::memory_order_relaxed) != 0)
+			{
+				MutexGuard lock(
+					sleepMutex
+				);
+
+				sleepCondition.WakeOne();
+			}
+		}
+
+		Bool IsAnyTaskQueued() const
+		{
+			if (taskQueueSize.load(::std::memory_order_acquire) != 0)
+			{
+
+				return True;
+			}
+
+			for (auto lpContext : threads)
+			{
+				if (!lpContext->TaskDeque.IsEmpty())
 				{
-					f_args.Invoke(
-						f
-					);
+
+					return True;
 				}
+			}
+
+			return False;
+		}
+
+		Bool TryDequeueTask(ThreadTask*& lpTask)
+		{
+			if (taskQueueSize.load(::std::memory_order_acquire) == 0)
+			{
+
+				return False;
+			}
+
+			MutexGuard lock(
+				taskQueueMutex
 			);
 
-			lpSelectedThreadContext->TaskQueue.Enqueue(
-				Move(task)
+			if ((lpTask = lpTaskQueueFront) == nullptr)
+			{
+
+				return False;
+			}
+
+			if ((lpTaskQueueFront = lpTask->lpNext) == nullptr)
+			{
+
+				lpTaskQueueBack = nullptr;
+			}
+
+			lpTask->lpNext = nullptr;
+
+			taskQueueSize.fetch_sub(
+				1,
+				::std::memory_order_relaxed
 			);
+
+			return True;
 		}
 
-	private:
-		Bool IsAnyThreadRunning() const
+		// Tries every thread after threads[index]
+		Bool TryStealTask(size_t index, ThreadTask*& lpTask)
 		{
-			auto lpContext = &threads[0];
+			auto count = threads.GetSize();
 
-			for (size_t i = 0; i < threads.GetSize(); ++i, ++lpContext)
+			for (size_t i = 1; i <= count; ++i)
 			{
-				if (lpContext->Thread.IsRunning())
+				auto victimIndex = (index + i) % count;
+
+				if (victimIndex == index)
+				{
+
+					continue;
+				}
+
+				if (threads[victimIndex]->TaskDeque.Steal(lpTask))
 				{
 
 					return True;
@@ -175,40 +534,242 @@ namespace AL::OS
 			return False;
 		}
 
-		Void StopThreads()
+		Bool TryGetTask(ThreadContext& context, ThreadTask*& lpTask)
 		{
-			isStopping = True;
+			if (context.TaskDeque.Pop(lpTask))
+			{
+
+				return True;
+			}
 
-			while (IsAnyThreadRunning())
+			if (TryDequeueTask(lpTask))
 			{
-				Sleep(
-					TimeSpan::FromMilliseconds(10)
+
+				return True;
+			}
+
+			if (TryStealTask(context.Index, lpTask))
+			{
+
+				return True;
+			}
+
+			return False;
+		}
+
+		Void Thread_Sleep()
+		{
+			MutexGuard lock(
+				sleepMutex
+			);
+
+			sleepingThreadCount.fetch_add(
+				1,
+				::std::memory_order_relaxed
+			);
+
+			::std::atomic_thread_fence(
+				::std::memory_order_seq_cst
+			);
+
+			if (!isStopping && !IsAnyTaskQueued())
+			{
+
+				sleepCondition.Sleep(
+					sleepMutex
 				);
 			}
 
-			isStopping = False;
+			sleepingThreadCount.fetch_sub(
+				1,
+				::std::memory_order_relaxed
+			);
 		}
 
 		Void Thread_Main(ThreadContext& context)
 		{
-			ThreadTask task;
+			GetCurrentContext() = &context;
+
+			ThreadTask* lpTask;
 
-			do
+			for (;;)
 			{
-				while (context.TaskQueue.Dequeue(task))
+				if (TryGetTask(context, lpTask))
 				{
+					ExecuteTask(
+						&context,
+						lpTask
+					);
 
-					task();
+					continue;
 				}
 
-				if (!isStopping)
+				// a failed steal may have lost a race so only give up once nothing is queued anywhere
+				if (IsAnyTaskQueued())
 				{
 
-					Sleep(
-						TimeSpan::FromMilliseconds(10)
+					continue;
+				}
+
+				if (isStopping)
+				{
+
+					break;
+				}
+
+				Thread_Sleep();
+			}
+
+			GetCurrentContext() = nullptr;
+		}
+	};
+
+	// Tracks a batch of tasks posted to a ThreadPool
+	class TaskGroup
+	{
+		ThreadPool*           lpPool;
+
+		::std::atomic<size_t> pendingCount;
+
+		Mutex                 mutex;
+		ConditionVariable     condition;
+		Exception*            lpException;
+
+		TaskGroup(TaskGroup&&) = delete;
+		TaskGroup(const TaskGroup&) = delete;
+
+	public:
+		explicit TaskGroup(ThreadPool& pool)
+			: lpPool(
+				&pool
+			),
+			pendingCount(
+				0
+			),
+			lpException(
+				nullptr
+			)
+		{
+		}
+
+		virtual ~TaskGroup()
+		{
+			WaitForTasks();
+
+			if (lpException != nullptr)
+			{
+
+				delete lpException;
+			}
+		}
+
+		auto& GetPool()
+		{
+			return *lpPool;
+		}
+
+		size_t GetPendingCount() const
+		{
+			return pendingCount.load(
+				::std::memory_order_acquire
+			);
+		}
+
+		template<typename F, typename ... TArgs>
+		Void Post(F&& function, TArgs ... args)
+		{
+			pendingCount.fetch_add(
+				1,
+				::std::memory_order_relaxed
+			);
+
+			lpPool->Post(
+				[this, f = Move(function), f_args = Collections::Tuple<TArgs ...>(Forward<TArgs>(args) ...)]()
+				{
+					try
+					{
+						f_args.Invoke(
+							f
+						);
+					}
+					catch (Exception& exception)
+					{
+						MutexGuard lock(
+							mutex
+						);
+
+						if (lpException == nullptr)
+						{
+
+							lpException = new Exception(
+								Move(exception)
+							);
+						}
+					}
+
+					// decremented while locked so Wait can't return (and destroy this) before WakeAll
+					MutexGuard lock(
+						mutex
+					);
+
+					if (pendingCount.fetch_sub(1, ::std::memory_order_acq_rel) == 1)
+					{
+
+						condition.WakeAll();
+					}
+				}
+			);
+		}
+
+		// Executes queued tasks on the calling thread until every task in this group has completed
+		// @throw AL::Exception if a task threw (only the first exception is kept)
+		Void Wait()
+		{
+			WaitForTasks();
+
+			if (auto _lpException = lpException)
+			{
+				lpException = nullptr;
+
+				Exception exception(
+					Move(*_lpException)
+				);
+
+				delete _lpException;
+
+				throw Exception(
+					Move(exception)
+				);
+			}
+		}
+
+	private:
+		Void WaitForTasks()
+		{
+			while (GetPendingCount() != 0)
+			{
+				if (!lpPool->TryExecuteTask())
+				{
+					MutexGuard lock(
+						mutex
 					);
+
+					// timeout covers tasks posted to the pool by other threads after TryExecuteTask failed
+					if (GetPendingCount() != 0)
+					{
+
+						condition.Sleep(
+							mutex,
+							TimeSpan::FromMilliseconds(1)
+						);
+					}
 				}
-			} while (!isStopping || (context.TaskQueue.GetSize() != 0));
+			}
+
+			// last task may still be holding the lock
+			MutexGuard lock(
+				mutex
+			);
 		}
 	};
 }
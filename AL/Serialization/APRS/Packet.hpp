@@ -86,7 +86,7 @@ namespace AL::Serialization::APRS
 
 		throw OperationNotSupportedException();
 	}
-	static Bool   QConstruct_FromString(QConstructs& qConstruct, const String& value)
+	static Bool   QConstruct_FromString(QConstructs& qConstruct, const StringView& value)
 	{
 		if (value.Compare("qAC"))
 		{
@@ -142,6 +142,20 @@ namespace AL::Serialization::APRS
 		return False;
 	}
 
+	// Fields of a packet as views into the line it was parsed from
+	struct PacketView
+	{
+		static constexpr size_t PATH_CAPACITY = 8;
+
+		StringView  Path[PATH_CAPACITY];
+		size_t      PathSize = 0;
+		StringView  IGate;
+		StringView  ToCall;
+		StringView  Sender;
+		StringView  Content;
+		QConstructs QConstruct = QConstructs::None;
+	};
+
 	class Packet
 	{
 		friend class Message;
@@ -151,16 +165,6 @@ namespace AL::Serialization::APRS
 
 		friend Bool DigiPath_FromString(DigiPath&, const String&);
 
-		struct Context
-		{
-			DigiPath    Path;
-			String      IGate;
-			String      ToCall;
-			String      Sender;
-			String      Content;
-			QConstructs QConstruct;
-		};
-
 		PacketTypes type;
 		DigiPath    path;
 		String      igate;
@@ -304,19 +308,149 @@ namespace AL::Serialization::APRS
 		}
 
 		// @throw AL::Exception
-		static Packet FromString(const String& value)
+		static Packet FromString(const StringView& value)
 		{
-			Context context;
+			PacketView view;
 
-			if (!GetContext(context, value))
+			if (!Parse(view, value))
 				throw Exception("Invalid format");
 
+			DigiPath path;
+
+			for (size_t i = 0; i < view.PathSize; ++i)
+			{
+				path[i] = view.Path[i].ToString();
+			}
+
+			auto content = view.Content.ToString();
+
 			PacketTypes type;
 
-			if (!GetType(type, context.Content))
+			if (!GetType(type, content))
 				type = PacketTypes::Unknown;
 
-			return Packet(type, Move(context.Sender), Move(context.ToCall), Move(context.Path), Move(context.IGate), context.QConstruct, Move(context.Content));
+			return Packet(type, view.Sender.ToString(), view.ToCall.ToString(), Move(path), view.IGate.ToString(), view.QConstruct, Move(content));
+		}
+
+		// Parses value in a single pass without copying
+		// - Every field of view points into value
+		static Bool Parse(PacketView& view, const StringView& value)
+		{
+			// ^([^>]{3,9})>([^,]+),([^:]+):(.+)$
+			auto senderEnd = value.IndexOf(
+				'>'
+			);
+
+			if ((senderEnd == StringView::NPOS) || !Math::IsInRange<size_t>(senderEnd, 3, 9))
+			{
+
+				return False;
+			}
+
+			auto tocallEnd = value.IndexOfAt(
+				',',
+				senderEnd + 1
+			);
+
+			if ((tocallEnd == StringView::NPOS) || (tocallEnd == (senderEnd + 1)))
+			{
+
+				return False;
+			}
+
+			auto pathEnd = value.IndexOfAt(
+				':',
+				tocallEnd + 1
+			);
+
+			if ((pathEnd == StringView::NPOS) || (pathEnd == (tocallEnd + 1)) || ((pathEnd + 1) == value.GetLength()))
+			{
+
+				return False;
+			}
+
+			view.Sender  = value.SubView(0, senderEnd);
+			view.ToCall  = value.SubView(senderEnd + 1, tocallEnd - senderEnd - 1);
+			view.Content = value.SubView(pathEnd + 1);
+
+			if (GetLineLength(view.Content) != view.Content.GetLength())
+			{
+
+				return False;
+			}
+
+			if (!Validate_ToCall(view.ToCall, False))
+			{
+
+				return False;
+			}
+
+			if (!Validate_StationName(view.Sender, False))
+			{
+
+				return False;
+			}
+
+			auto path = value.SubView(
+				tocallEnd + 1,
+				pathEnd - tocallEnd - 1
+			);
+
+			view.IGate      = StringView();
+			view.QConstruct = QConstructs::None;
+
+			// ^((\S+?(?=,qA\w)),(qA\w),(.+))|(\S+)$
+			for (size_t i = 1; (i < path.GetLength()) && !IsSpace(path[i - 1]); ++i)
+			{
+				if (((i + 5) < path.GetLength()) && (path[i] == ',') && (path[i + 1] == 'q') && (path[i + 2] == 'A') && IsWord(path[i + 3]) && (path[i + 4] == ',') && (path[i + 5] != '\r') && (path[i + 5] != '\n'))
+				{
+					view.IGate = path.SubView(i + 5);
+					view.IGate = view.IGate.SubView(0, GetLineLength(view.IGate));
+
+					if (!Validate_DigiPath(view.IGate, False))
+					{
+
+						return False;
+					}
+
+					if (!GetPath(view, path.SubView(0, i)))
+					{
+
+						return False;
+					}
+
+					if (!QConstruct_FromString(view.QConstruct, path.SubView(i + 1, 3)))
+					{
+
+						return False;
+					}
+
+					return True;
+				}
+			}
+
+			size_t pathStart = path.GetLength();
+
+			while ((pathStart != 0) && !IsSpace(path[pathStart - 1]))
+			{
+				--pathStart;
+			}
+
+			if (pathStart != path.GetLength())
+			{
+
+				path = path.SubView(
+					pathStart
+				);
+			}
+
+			if (!GetPath(view, path))
+			{
+
+				return False;
+			}
+
+			return True;
 		}
 
 		Packet()
@@ -466,80 +600,98 @@ namespace AL::Serialization::APRS
 			return False;
 		}
 
-		static Bool GetContext(Context& context, const String& value)
+		static constexpr Bool IsSpace(String::Char c)
 		{
-			Regex::MatchCollection matches;
-
-			if (!Regex::Match(matches, "^([^>]{3,9})>([^,]+),([^:]+):(.+)$", value))
+			switch (c)
 			{
-
-				return False;
+				case ' ':
+				case '\t':
+				case '\n':
+				case '\v':
+				case '\f':
+				case '\r':
+					return True;
 			}
 
-			if (!Validate_ToCall(matches[2], False))
+			return False;
+		}
+
+		static constexpr Bool IsWord(String::Char c)
+		{
+			if (((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')) || (c == '_'))
 			{
 
-				return False;
+				return True;
 			}
 
-			if (!Validate_StationName(matches[1], False))
+			return False;
+		}
+
+		// Length up to the first line terminator
+		static constexpr size_t GetLineLength(const StringView& value)
+		{
+			for (size_t i = 0; i < value.GetLength(); ++i)
 			{
+				if ((value[i] == '\r') || (value[i] == '\n'))
+				{
 
-				return False;
+					return i;
+				}
 			}
 
-			context.IGate.Clear();
-			context.Sender     = Move(matches[1]);
-			context.ToCall     = Move(matches[2]);
-			context.Content    = Move(matches[4]);
-			context.QConstruct = QConstructs::None;
+			return value.GetLength();
+		}
+
+		// Splits value on ',' the same way as String::Split
+		static Bool GetPath(PacketView& view, const StringView& value)
+		{
+			view.PathSize = 0;
 
-			if (Regex::Match(matches, "^((\\S+?(?=,qA\\w)),(qA\\w),(.+))|(\\S+)$", String(matches[3])))
+			for (size_t i = 0; i < value.GetLength(); )
 			{
-				if (matches[5].GetLength() == 0)
-				{
-					if (!Validate_DigiPath(matches[4], False))
-					{
+				auto chunkEnd = value.IndexOfAt(
+					',',
+					i
+				);
 
-						return False;
-					}
+				if (chunkEnd == StringView::NPOS)
+				{
 
-					context.IGate = Move(matches[4]);
+					chunkEnd = value.GetLength();
+				}
 
-					if (!DigiPath_FromString(context.Path, matches[2]))
-					{
+				if (view.PathSize == PacketView::PATH_CAPACITY)
+				{
 
-						return False;
-					}
+					return False;
+				}
 
-					if (!QConstruct_FromString(context.QConstruct, matches[3]))
-					{
+				auto chunk = value.SubView(
+					i,
+					chunkEnd - i
+				);
 
-						return False;
-					}
-				}
-				else if (!DigiPath_FromString(context.Path, matches[5]))
+				if (!Validate_DigiPath(chunk))
 				{
 
 					return False;
 				}
-			}
-			else if (!DigiPath_FromString(context.Path, matches[3]))
-			{
 
-				return False;
+				view.Path[view.PathSize++] = chunk;
+
+				i = chunkEnd + 1;
 			}
 
 			return True;
 		}
 
-		static Bool Validate_ToCall(const String& value, Bool strict = True)
+		static Bool Validate_ToCall(const StringView& value, Bool strict = True)
 		{
 			// TODO: better filter
 			return Math::IsInRange<size_t>(value.GetLength(), 2, 9);
 		}
 
-		static Bool Validate_DigiPath(const String& value, Bool strict = True)
+		static Bool Validate_DigiPath(const StringView& value, Bool strict = True)
 		{
 			// TODO: better filter
 			return Math::IsInRange<size_t>(value.GetLength(), 2, 9);
@@ -578,7 +730,7 @@ namespace AL::Serialization::APRS
 			return Regex::IsMatch("^qA.$", value);
 		}
 
-		static Bool Validate_StationName(const String& value, Bool strict = True)
+		static Bool Validate_StationName(const StringView& value, Bool strict = True)
 		{
 			// TODO: better filter
 			return Math::IsInRange<size_t>(value.GetLength(), 2, 9);
@@ -588,23 +740,17 @@ namespace AL::Serialization::APRS
 
 inline AL::Bool AL::Serialization::APRS::DigiPath_FromString(DigiPath& path, const String& value)
 {
-	size_t pathSize = 0;
+	PacketView view;
 
-	for (auto& pathChunk : value.Split(','))
+	if (!Packet::GetPath(view, value))
 	{
-		if (pathSize == path.GetCapacity())
-		{
 
-			return False;
-		}
-
-		if (!Packet::Validate_DigiPath(pathChunk))
-		{
-
-			return False;
-		}
+		return False;
+	}
 
-		path[pathSize++] = Move(pathChunk);
+	for (size_t i = 0; i < view.PathSize; ++i)
+	{
+		path[i] = view.Path[i].ToString();
 	}
 
 	return True;
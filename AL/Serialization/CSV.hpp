@@ -5,13 +5,929 @@
 
 #include "AL/Collections/Array.hpp"
 #include "AL/Collections/Tuple.hpp"
-#include "AL/Collections/LinkedList.hpp"
+
+#if !defined(AL_PLATFORM_PICO)
+	#include "AL/OS/Parallel.hpp"
+#endif
+
+#include <bit> // std::popcount, std::countr_zero
+
+#if defined(AL_FEATURE_SSE2)
+	#include <emmintrin.h>
+#endif
 
 namespace AL::Serialization
 {
+	struct __CSV_Utility
+	{
+		// @return lpEnd if not found
+		static const char* FindDelimiter(const char* lpChar, const char* lpEnd)
+		{
+#if defined(AL_FEATURE_SSE2)
+			auto comma   = ::_mm_set1_epi8(',');
+			auto newLine = ::_mm_set1_epi8('\n');
+
+			for (; (lpEnd - lpChar) >= 16; lpChar += 16)
+			{
+				auto chunk = ::_mm_loadu_si128(
+					reinterpret_cast<const __m128i*>(lpChar)
+				);
+
+				auto mask = ::_mm_movemask_epi8(
+					::_mm_or_si128(::_mm_cmpeq_epi8(chunk, comma), ::_mm_cmpeq_epi8(chunk, newLine))
+				);
+
+				if (mask != 0)
+				{
+
+					return lpChar + ::std::countr_zero(static_cast<uint32>(mask));
+				}
+			}
+#endif
+
+			for (; lpChar != lpEnd; ++lpChar)
+			{
+				if ((*lpChar == ',') || (*lpChar == '\n'))
+				{
+
+					break;
+				}
+			}
+
+			return lpChar;
+		}
+
+		// @return lpEnd if not found
+		static const char* FindQuote(const char* lpChar, const char* lpEnd)
+		{
+#if defined(AL_FEATURE_SSE2)
+			auto quote = ::_mm_set1_epi8('"');
+
+			for (; (lpEnd - lpChar) >= 16; lpChar += 16)
+			{
+				auto mask = ::_mm_movemask_epi8(
+					::_mm_cmpeq_epi8(::_mm_loadu_si128(reinterpret_cast<const __m128i*>(lpChar)), quote)
+				);
+
+				if (mask != 0)
+				{
+
+					return lpChar + ::std::countr_zero(static_cast<uint32>(mask));
+				}
+			}
+#endif
+
+			for (; lpChar != lpEnd; ++lpChar)
+			{
+				if (*lpChar == '"')
+				{
+
+					break;
+				}
+			}
+
+			return lpChar;
+		}
+
+		static size_t CountQuotes(const char* lpChar, const char* lpEnd)
+		{
+			size_t count = 0;
+
+#if defined(AL_FEATURE_SSE2)
+			auto quote = ::_mm_set1_epi8('"');
+
+			for (; (lpEnd - lpChar) >= 16; lpChar += 16)
+			{
+				count += ::std::popcount(
+					static_cast<uint32>(::_mm_movemask_epi8(::_mm_cmpeq_epi8(::_mm_loadu_si128(reinterpret_cast<const __m128i*>(lpChar)), quote)))
+				);
+			}
+#endif
+
+			for (; lpChar != lpEnd; ++lpChar)
+			{
+				if (*lpChar == '"')
+				{
+					++count;
+				}
+			}
+
+			return count;
+		}
+
+		// Escaped quotes toggle isQuoted twice so only the parity of the quotes before lpChar matters
+		// - lpChar[-1] must be readable when lineEnding is CRLF
+		// @return first character after the next line ending outside of quotes, lpEnd if not found
+		static const char* FindRecordBegin(const char* lpChar, const char* lpEnd, Bool isQuoted, TextLineEndings lineEnding)
+		{
+			while (lpChar != lpEnd)
+			{
+				if (isQuoted)
+				{
+					if ((lpChar = FindQuote(lpChar, lpEnd)) == lpEnd)
+					{
+
+						break;
+					}
+
+					isQuoted = False;
+				}
+				else if (*lpChar == '"')
+				{
+					isQuoted = True;
+				}
+				else if ((*lpChar == '\n') && ((lineEnding != TextLineEndings::CRLF) || (lpChar[-1] == '\r')))
+				{
+
+					return lpChar + 1;
+				}
+
+				++lpChar;
+			}
+
+			return lpEnd;
+		}
+	};
+
+	// Reads typed records straight from a buffer or FileSystem::File
+	// - Any T_FILE with size_t Read(Void*, size_t) can be read from
+	// - Records end with LF or CRLF when lineEnding is Auto, otherwise only with lineEnding
+	// - Blank lines are skipped
+	// - Quoted fields may contain delimiters, line endings and quotes escaped as ""
+	// - Files are read in chunks of BUFFER_SIZE, the buffer grows if a record does not fit
+	template<typename ... T_VALUES>
+	class CSVReader
+	{
+		static constexpr size_t BUFFER_SIZE = 0x10000;
+		static constexpr size_t FIELD_COUNT = sizeof ...(T_VALUES);
+
+		template<size_t _I>
+		using Get_Value_Type = Get_Type_Sequence<_I, T_VALUES ...>;
+
+		struct Field
+		{
+			const char* lpBuffer;
+			size_t      Length;
+			Bool        IsEscaped;
+		};
+
+		Void*                    lpFile = nullptr;
+		size_t                 (*lpFileRead)(Void* lpFile, Void* lpBuffer, size_t size) = nullptr;
+		Collections::Array<char> buffer;
+
+		// unread input
+		const char*              lpBegin;
+		const char*              lpEnd;
+		Bool                     isEndOfInput;
+
+		TextLineEndings          lineEnding;
+
+		size_t                   line     = 0;
+		uint64                   position = 0;
+		Field                    fields[FIELD_COUNT];
+
+	public:
+		typedef Collections::Tuple<T_VALUES ...> Row;
+
+		// lpBuffer must outlive the reader
+		CSVReader(const Void* lpBuffer, size_t size, TextLineEndings lineEnding = TextLineEndings::Auto)
+			: lpBegin(
+				static_cast<const char*>(lpBuffer)
+			),
+			lpEnd(
+				static_cast<const char*>(lpBuffer) + size
+			),
+			isEndOfInput(
+				True
+			),
+			lineEnding(
+				lineEnding
+			)
+		{
+		}
+
+		// file must be open and outlive the reader
+		template<typename T_FILE>
+		explicit CSVReader(T_FILE& file, TextLineEndings lineEnding = TextLineEndings::Auto)
+			: lpFile(
+				&file
+			),
+			lpFileRead(
+				&ReadFile<T_FILE>
+			),
+			buffer(
+				BUFFER_SIZE
+			),
+			lpBegin(
+				&buffer[0]
+			),
+			lpEnd(
+				&buffer[0]
+			),
+			isEndOfInput(
+				False
+			),
+			lineEnding(
+				lineEnding
+			)
+		{
+		}
+
+		CSVReader(CSVReader&&) = delete;
+		CSVReader(const CSVReader&) = delete;
+
+		virtual ~CSVReader()
+		{
+		}
+
+		// Number of records read or skipped
+		size_t GetLine() const
+		{
+			return line;
+		}
+
+		// Number of bytes read or skipped
+		uint64 GetPosition() const
+		{
+			return position;
+		}
+
+		// @throw AL::Exception
+		// @return AL::False if end of input
+		Bool Read(Row& row)
+		{
+			if (!ReadFields())
+			{
+
+				return False;
+			}
+
+			ReadValues(
+				row,
+				typename Make_Index_Sequence<FIELD_COUNT>::Type {}
+			);
+
+			return True;
+		}
+
+		// @throw AL::Exception
+		// @return AL::False if end of input
+		Bool Skip()
+		{
+			if (!ReadFields())
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+
+		// Skips a line of text without reading it as a record
+		// - Quotes are not interpreted, a quoted line ending ends the line like Text::ReadLine
+		// @throw AL::Exception
+		// @return AL::False if end of input
+		Bool SkipLine()
+		{
+			for (;;)
+			{
+				auto lpNext = FindLineEnd();
+
+				if (lpNext == nullptr)
+				{
+					if (!isEndOfInput)
+					{
+						Fill();
+
+						continue;
+					}
+
+					if (lpBegin == lpEnd)
+					{
+
+						return False;
+					}
+
+					// last line without a line ending
+					lpNext = lpEnd;
+				}
+
+				position += static_cast<uint64>(lpNext - lpBegin);
+				lpBegin   = lpNext;
+
+				++line;
+
+				return True;
+			}
+		}
+
+		CSVReader& operator = (CSVReader&&) = delete;
+		CSVReader& operator = (const CSVReader&) = delete;
+
+	private:
+		// @return first character after the next line ending, nullptr if not found
+		const char* FindLineEnd() const
+		{
+			for (auto lpChar = lpBegin; lpChar != lpEnd; ++lpChar)
+			{
+				if ((lpChar = static_cast<const char*>(memchr(lpChar, '\n', static_cast<size_t>(lpEnd - lpChar)))) == nullptr)
+				{
+
+					break;
+				}
+
+				// a LF without CR is part of the line
+				if ((lineEnding != TextLineEndings::CRLF) || ((lpChar != lpBegin) && (lpChar[-1] == '\r')))
+				{
+
+					return lpChar + 1;
+				}
+			}
+
+			return nullptr;
+		}
+
+		// @throw AL::Exception
+		// @return AL::False if end of input
+		Bool ReadFields()
+		{
+			for (;;)
+			{
+				const char* lpNext;
+
+				if ((lpBegin == lpEnd) || ((lpNext = ReadRecord()) == nullptr))
+				{
+					if (isEndOfInput)
+					{
+
+						return False;
+					}
+
+					Fill();
+
+					continue;
+				}
+
+				// a single unquoted empty field, "" is an empty value rather than a blank line
+				auto isBlank = (fields[0].lpBuffer == lpBegin) && (fields[0].Length == 0) && ((FIELD_COUNT == 1) || (fields[1].lpBuffer == nullptr));
+
+				position += static_cast<uint64>(lpNext - lpBegin);
+				lpBegin   = lpNext;
+
+				++line;
+
+				if (isBlank)
+				{
+
+					continue;
+				}
+
+				if (fields[FIELD_COUNT - 1].lpBuffer == nullptr)
+				{
+
+					throw Exception(
+						"Invalid chunk count at line %s",
+						AL::ToString(line - 1).GetCString()
+					);
+				}
+
+				return True;
+			}
+		}
+
+		// @throw AL::Exception
+		// @return nullptr if more input is required
+		const char* ReadRecord()
+		{
+			for (size_t i = 0; i < FIELD_COUNT; ++i)
+			{
+				fields[i].lpBuffer = nullptr;
+			}
+
+			auto lpChar = lpBegin;
+
+			for (size_t i = 0; ; )
+			{
+				if (i == FIELD_COUNT)
+				{
+
+					throw Exception(
+						"Invalid chunk count at line %s",
+						AL::ToString(line).GetCString()
+					);
+				}
+
+				auto& field = fields[i++];
+
+				field.IsEscaped = False;
+
+				if ((lpChar == lpEnd) || (*lpChar != '"'))
+				{
+					field.lpBuffer = lpChar;
+
+					for (;; ++lpChar)
+					{
+						if ((lpChar = __CSV_Utility::FindDelimiter(lpChar, lpEnd)) == lpEnd)
+						{
+							if (!isEndOfInput)
+							{
+
+								return nullptr;
+							}
+
+							field.Length = static_cast<size_t>(lpEnd - field.lpBuffer);
+
+							return lpEnd;
+						}
+
+						// a LF without CR is part of the field
+						if ((*lpChar == ',') || (lineEnding != TextLineEndings::CRLF) || ((lpChar != field.lpBuffer) && (lpChar[-1] == '\r')))
+						{
+
+							break;
+						}
+					}
+
+					field.Length = static_cast<size_t>(lpChar - field.lpBuffer);
+
+					if (*lpChar++ == ',')
+					{
+
+						continue;
+					}
+
+					// a CR before LF is part of the field
+					if ((lineEnding != TextLineEndings::LF) && (field.Length != 0) && (field.lpBuffer[field.Length - 1] == '\r'))
+					{
+
+						--field.Length;
+					}
+
+					return lpChar;
+				}
+
+				field.lpBuffer = ++lpChar;
+
+				for (;; lpChar += 2)
+				{
+					if ((lpChar = __CSV_Utility::FindQuote(lpChar, lpEnd)) == lpEnd)
+					{
+						if (!isEndOfInput)
+						{
+
+							return nullptr;
+						}
+
+						throw Exception(
+							"No terminating quote on line %s [Chunk: %s, Offset: %s]",
+							AL::ToString(line).GetCString(),
+							AL::ToString(i - 1).GetCString(),
+							AL::ToString(static_cast<size_t>(field.lpBuffer - 1 - lpBegin)).GetCString()
+						);
+					}
+
+					// need the next character to tell an escaped quote from the end of the field
+					if (((lpChar + 1) == lpEnd) && !isEndOfInput)
+					{
+
+						return nullptr;
+					}
+
+					if (((lpChar + 1) == lpEnd) || (lpChar[1] != '"'))
+					{
+
+						break;
+					}
+
+					field.IsEscaped = True;
+				}
+
+				field.Length = static_cast<size_t>(lpChar++ - field.lpBuffer);
+
+				if (lpChar == lpEnd)
+				{
+					if (!isEndOfInput)
+					{
+
+						return nullptr;
+					}
+
+					return lpEnd;
+				}
+
+				switch (*lpChar)
+				{
+					case ',':
+						++lpChar;
+						continue;
+
+					case '\n':
+					{
+						if (lineEnding != TextLineEndings::CRLF)
+						{
+
+							return lpChar + 1;
+						}
+					}
+					break;
+
+					case '\r':
+					{
+						if (lineEnding == TextLineEndings::LF)
+						{
+
+							break;
+						}
+
+						if (((lpChar + 1) == lpEnd) && !isEndOfInput)
+						{
+
+							return nullptr;
+						}
+
+						if (((lpChar + 1) != lpEnd) && (lpChar[1] == '\n'))
+						{
+
+							return lpChar + 2;
+						}
+					}
+					break;
+				}
+
+				throw Exception(
+					"Unexpected character after quote on line %s [Chunk: %s]",
+					AL::ToString(line).GetCString(),
+					AL::ToString(i - 1).GetCString()
+				);
+			}
+		}
+
+		// Moves the unread input to the front of the buffer and reads more
+		// @throw AL::Exception
+		Void Fill()
+		{
+			auto size = static_cast<size_t>(lpEnd - lpBegin);
+
+			if (size == buffer.GetCapacity())
+			{
+				// a record larger than the buffer
+				buffer.SetSize(
+					buffer.GetCapacity() * 2
+				);
+			}
+			else if ((size != 0) && (lpBegin != &buffer[0]))
+			{
+				memmove(
+					&buffer[0],
+					lpBegin,
+					size
+				);
+			}
+
+			auto numberOfBytesRead = lpFileRead(
+				lpFile,
+				&buffer[size],
+				buffer.GetCapacity() - size
+			);
+
+			lpBegin      = &buffer[0];
+			lpEnd        = &buffer[size + numberOfBytesRead];
+			isEndOfInput = numberOfBytesRead == 0;
+		}
+
+		// @throw AL::Exception
+		template<typename T_FILE>
+		static size_t ReadFile(Void* lpFile, Void* lpBuffer, size_t size)
+		{
+			return static_cast<T_FILE*>(lpFile)->Read(
+				lpBuffer,
+				size
+			);
+		}
+
+		template<size_t I>
+		Void ReadValue(Row& row)
+		{
+			typedef typename Get_Value_Type<I>::Type T;
+
+			auto& field = fields[I];
+
+			String value(
+				field.lpBuffer,
+				field.Length
+			);
+
+			if (field.IsEscaped)
+			{
+				size_t length = 0;
+
+				// "" to ", in place
+				for (size_t i = 0; i < field.Length; ++i, ++length)
+				{
+					value[length] = field.lpBuffer[i];
+
+					if (field.lpBuffer[i] == '"')
+					{
+						++i;
+					}
+				}
+
+				value.Erase(
+					length,
+					field.Length - length
+				);
+			}
+
+			if constexpr (Is_Type<String, T>::Value)
+			{
+				row.template Set<I>(
+					Move(value)
+				);
+			}
+			else if constexpr (Is_Type<WString, T>::Value)
+			{
+				row.template Set<I>(
+					value.ToWString()
+				);
+			}
+			else
+			{
+				row.template Set<I>(
+					AL::FromString<T>(
+						value
+					)
+				);
+			}
+		}
+		template<size_t ... INDEXES>
+		Void ReadValues(Row& row, Index_Sequence<INDEXES ...>)
+		{
+			(ReadValue<INDEXES>(row), ...);
+		}
+	};
+
+	// Writes CSV records into a StringBuilder or FileSystem::File
+	// - Output is buffered, call Flush when done
+	// - String and WString values are quoted, quotes are escaped as ""
+	template<typename T_OUTPUT>
+	class CSVWriter
+	{
+		// StringBuilder is already buffered, its staging buffer only batches appends
+		static constexpr size_t BUFFER_SIZE = Is_Type<T_OUTPUT, StringBuilder>::Value ? 0x400 : 0x4000;
+
+		T_OUTPUT*                lpOutput;
+		TextLineEndings          lineEnding;
+
+		size_t                   bufferSize = 0;
+		// on the heap so writers can live on small stacks
+		Collections::Array<char> buffer;
+
+	public:
+		explicit CSVWriter(T_OUTPUT& output, TextLineEndings lineEnding = TextLineEndings::Auto)
+			: lpOutput(
+				&output
+			),
+			lineEnding(
+				lineEnding
+			),
+			buffer(
+				BUFFER_SIZE
+			)
+		{
+		}
+
+		CSVWriter(CSVWriter&&) = delete;
+		CSVWriter(const CSVWriter&) = delete;
+
+		virtual ~CSVWriter()
+		{
+		}
+
+		// @throw AL::Exception
+		Void Flush()
+		{
+			if (bufferSize != 0)
+			{
+				WriteOutput(
+					*lpOutput,
+					&buffer[0],
+					bufferSize
+				);
+
+				bufferSize = 0;
+			}
+		}
+
+		// @throw AL::Exception
+		template<typename ... T_VALUES>
+		Void Write(const T_VALUES& ... values)
+		{
+			size_t i = 0;
+
+			(WriteValue(values, i++), ...);
+
+			WriteLineEnding();
+		}
+		// @throw AL::Exception
+		template<typename ... T_VALUES>
+		Void Write(const Collections::Tuple<T_VALUES ...>& row)
+		{
+			WriteRow(
+				row,
+				typename Make_Index_Sequence<sizeof ...(T_VALUES)>::Type {}
+			);
+		}
+
+		CSVWriter& operator = (CSVWriter&&) = delete;
+		CSVWriter& operator = (const CSVWriter&) = delete;
+
+	private:
+		// @throw AL::Exception
+		template<typename ... T_VALUES, size_t ... INDEXES>
+		Void WriteRow(const Collections::Tuple<T_VALUES ...>& row, Index_Sequence<INDEXES ...>)
+		{
+			Write(
+				row.template Get<INDEXES>() ...
+			);
+		}
+
+		// @throw AL::Exception
+		template<typename T>
+		Void WriteValue(const T& value, size_t index)
+		{
+			if (index != 0)
+			{
+
+				WriteRaw(
+					','
+				);
+			}
+
+			if constexpr (Is_Type<String, T>::Value)
+			{
+				WriteQuoted(
+					value.GetCString(),
+					value.GetLength()
+				);
+			}
+			else if constexpr (Is_Type<WString, T>::Value)
+			{
+				auto string = value.ToString();
+
+				WriteQuoted(
+					string.GetCString(),
+					string.GetLength()
+				);
+			}
+			else
+			{
+				auto string = AL::ToString(
+					value
+				);
+
+				WriteRaw(
+					string.GetCString(),
+					string.GetLength()
+				);
+			}
+		}
+
+		// @throw AL::Exception
+		Void WriteQuoted(const char* lpChar, size_t length)
+		{
+			auto lpEnd = lpChar + length;
+
+			WriteRaw(
+				'"'
+			);
+
+			for (const char* lpQuote; (lpQuote = __CSV_Utility::FindQuote(lpChar, lpEnd)) != lpEnd; lpChar = lpQuote + 1)
+			{
+				WriteRaw(
+					lpChar,
+					static_cast<size_t>(lpQuote - lpChar) + 1
+				);
+
+				WriteRaw(
+					'"'
+				);
+			}
+
+			WriteRaw(
+				lpChar,
+				static_cast<size_t>(lpEnd - lpChar)
+			);
+
+			WriteRaw(
+				'"'
+			);
+		}
+
+		// @throw AL::Exception
+		Void WriteLineEnding()
+		{
+			switch (lineEnding)
+			{
+				case TextLineEndings::Auto:
+					WriteRaw(Get_Text_Line_Ending<String, TextLineEndings::Auto>::Value, sizeof(Get_Text_Line_Ending<String, TextLineEndings::Auto>::Value) - 1);
+					break;
+
+				case TextLineEndings::LF:
+					WriteRaw(Get_Text_Line_Ending<String, TextLineEndings::LF>::Value, sizeof(Get_Text_Line_Ending<String, TextLineEndings::LF>::Value) - 1);
+					break;
+
+				case TextLineEndings::CRLF:
+					WriteRaw(Get_Text_Line_Ending<String, TextLineEndings::CRLF>::Value, sizeof(Get_Text_Line_Ending<String, TextLineEndings::CRLF>::Value) - 1);
+					break;
+			}
+		}
+
+		// @throw AL::Exception
+		Void WriteRaw(char c)
+		{
+			if (bufferSize == BUFFER_SIZE)
+			{
+
+				Flush();
+			}
+
+			buffer[bufferSize++] = c;
+		}
+		// @throw AL::Exception
+		Void WriteRaw(const char* lpBuffer, size_t size)
+		{
+			if ((BUFFER_SIZE - bufferSize) < size)
+			{
+				Flush();
+
+				// too large to be worth buffering
+				if (size >= BUFFER_SIZE)
+				{
+					WriteOutput(
+						*lpOutput,
+						lpBuffer,
+						size
+					);
+
+					return;
+				}
+			}
+
+			if (size != 0)
+			{
+				memcpy(
+					&buffer[bufferSize],
+					lpBuffer,
+					size
+				);
+
+				bufferSize += size;
+			}
+		}
+
+		static Void WriteOutput(StringBuilder& sb, const char* lpBuffer, size_t size)
+		{
+			sb.Append(
+				lpBuffer,
+				size
+			);
+		}
+		// FileSystem::File
+		// @throw AL::Exception if nothing could be written
+		template<typename T_FILE>
+		static auto WriteOutput(T_FILE& file, const char* lpBuffer, size_t size) -> decltype(file.Write(lpBuffer, size), Void())
+		{
+			for (size_t numberOfBytesWritten = 0; numberOfBytesWritten < size; )
+			{
+				auto _numberOfBytesWritten = file.Write(
+					&lpBuffer[numberOfBytesWritten],
+					size - numberOfBytesWritten
+				);
+
+				if (_numberOfBytesWritten == 0)
+				{
+
+					throw Exception(
+						"Error writing %llu byte(s) of CSV",
+						static_cast<unsigned long long>(size - numberOfBytesWritten)
+					);
+				}
+
+				numberOfBytesWritten += _numberOfBytesWritten;
+			}
+		}
+	};
+
 	template<typename ... T_VALUES>
 	class CSV
 	{
+#if !defined(AL_PLATFORM_PICO)
+		// Smallest part of the input parsed by a single task
+		static constexpr size_t CHUNK_SIZE_MINIMUM = 0x10000;
+		// Chunks per thread so stolen work evens out chunks of uneven cost
+		static constexpr size_t CHUNKS_PER_THREAD  = 4;
+#endif
+
 		template<size_t _I>
 		using Get_Value_Type = Get_Type_Sequence<_I, T_VALUES ...>;
 
@@ -23,11 +939,10 @@ namespace AL::Serialization
 		// @throw AL::Exception
 		static Void FromString(CSV& csv, const String& string, size_t lineSkip = 0, TextLineEndings lineEnding = TextLineEndings::Auto)
 		{
-			auto wstring = string.ToWString();
-
-			FromString(
+			FromBuffer(
 				csv,
-				wstring,
+				string.GetCString(),
+				string.GetLength(),
 				lineSkip,
 				lineEnding
 			);
@@ -35,113 +950,243 @@ namespace AL::Serialization
 		// @throw AL::Exception
 		static Void FromString(CSV& csv, const WString& wstring, size_t lineSkip = 0, TextLineEndings lineEnding = TextLineEndings::Auto)
 		{
-			Collections::LinkedList<WString> lines;
+			FromString(
+				csv,
+				wstring.ToString(),
+				lineSkip,
+				lineEnding
+			);
+		}
+#if !defined(AL_PLATFORM_PICO)
+		// @throw AL::Exception
+		static Void FromString(CSV& csv, OS::ThreadPool& pool, const String& string, size_t lineSkip = 0, TextLineEndings lineEnding = TextLineEndings::Auto)
+		{
+			FromBuffer(
+				csv,
+				pool,
+				string.GetCString(),
+				string.GetLength(),
+				lineSkip,
+				lineEnding
+			);
+		}
+#endif
+
+		// @throw AL::Exception
+		static Void FromBuffer(CSV& csv, const Void* lpBuffer, size_t size, size_t lineSkip = 0, TextLineEndings lineEnding = TextLineEndings::Auto)
+		{
+			CSVReader<T_VALUES ...> reader(
+				lpBuffer,
+				size,
+				lineEnding
+			);
 
-			{
-				WString line;
-				Text    text(wstring);
+			FromReader(
+				csv,
+				reader,
+				lineSkip
+			);
+		}
+#if !defined(AL_PLATFORM_PICO)
+		// Parses chunks of lpBuffer on pool and stitches the rows back together in order
+		// - Chunks are split after line endings outside of quotes
+		// - A literal " inside an unquoted field (a"b) breaks the quote parity used to split, parse such input without a pool
+		// - Falls back to FromBuffer if pool is not running, lpBuffer is too small to split or a chunk fails to parse
+		// @throw AL::Exception
+		static Void FromBuffer(CSV& csv, OS::ThreadPool& pool, const Void* lpBuffer, size_t size, size_t lineSkip = 0, TextLineEndings lineEnding = TextLineEndings::Auto)
+		{
+			auto lpBegin = static_cast<const char*>(lpBuffer);
+			auto lpEnd   = lpBegin + size;
 
-				text.SetLineEnding(
+			if (lineSkip != 0)
+			{
+				CSVReader<T_VALUES ...> reader(
+					lpBegin,
+					size,
 					lineEnding
 				);
 
 				for (size_t i = 0; i < lineSkip; ++i)
 				{
-					if (!text.ReadLine(line))
+					if (!reader.SkipLine())
 					{
 
 						break;
 					}
 				}
 
-				while (text.ReadLine(line))
-				{
-					lines.PushBack(
-						Move(line)
-					);
-				}
+				lpBegin += reader.GetPosition();
 			}
 
-			Collections::Array<T_CONTAINER> container(
-				lines.GetSize()
-			);
+			size       = static_cast<size_t>(lpEnd - lpBegin);
+			auto count = size / CHUNK_SIZE_MINIMUM;
 
+			if (count > ((pool.GetCount() + 1) * CHUNKS_PER_THREAD))
 			{
-				auto it = lines.cbegin();
 
-				for (size_t i = 0; i < lines.GetSize(); ++i, ++it)
-				{
-					auto& line       = *it;
-					auto  lineLength = line.GetLength();
+				count = (pool.GetCount() + 1) * CHUNKS_PER_THREAD;
+			}
 
-					Collections::Array<WString> lineChunks(
-						sizeof ...(T_VALUES)
-					);
+			if (!pool.IsRunning() || (count <= 1))
+			{
+				FromBuffer(
+					csv,
+					lpBegin,
+					size,
+					0,
+					lineEnding
+				);
 
-					size_t lineChunksCount = 0;
+				return;
+			}
 
-					for (size_t lineOffset = 0; lineOffset < lineLength; )
-					{
-						if (line[lineOffset] == L'"')
-						{
-							size_t lineOffsetEndOfChunk;
+			// chunks[i] is the first record of chunk i
+			Collections::Array<const char*> chunks(
+				count + 1
+			);
 
-							if ((lineOffsetEndOfChunk = line.IndexOfAt(L'"', lineOffset + 1)) == WString::NPOS)
-							{
+			{
+				Collections::Array<size_t> quoteCounts(
+					count
+				);
 
-								throw Exception(
-									"No terminating quote on line %s [Chunk: %s, Offset: %s]",
-									AL::ToString(lineSkip + i).GetCString(),
-									AL::ToString(lineChunksCount).GetCString(),
-									AL::ToString(lineOffset).GetCString()
-								);
-							}
+				OS::Parallel::For(
+					pool,
+					0,
+					count,
+					[lpBegin, size, count, &quoteCounts](size_t _index)
+					{
+						quoteCounts[_index] = __CSV_Utility::CountQuotes(
+							lpBegin + ((size * _index) / count),
+							lpBegin + ((size * (_index + 1)) / count)
+						);
+					},
+					1
+				);
 
-							lineChunks[lineChunksCount++] = line.SubString(
-								lineOffset + 1,
-								lineOffsetEndOfChunk - (lineOffset + 1)
-							);
+				Collections::Array<Bool> isQuoted(
+					count
+				);
 
-							lineOffset = lineOffsetEndOfChunk + 2;
+				isQuoted[0] = False;
 
-							continue;
-						}
+				for (size_t i = 1; i < count; ++i)
+				{
+					isQuoted[i] = isQuoted[i - 1] != ((quoteCounts[i - 1] % 2) != 0);
+				}
 
-						size_t lineOffsetEndOfChunk;
+				OS::Parallel::For(
+					pool,
+					1,
+					count,
+					[lpBegin, lpEnd, size, count, lineEnding, &chunks, &isQuoted](size_t _index)
+					{
+						chunks[_index] = __CSV_Utility::FindRecordBegin(
+							lpBegin + ((size * _index) / count),
+							lpEnd,
+							isQuoted[_index],
+							lineEnding
+						);
+					},
+					1
+				);
 
-						if ((lineOffsetEndOfChunk = line.IndexOfAt(L',', lineOffset)) == WString::NPOS)
-						{
+				chunks[0]     = lpBegin;
+				chunks[count] = lpEnd;
+			}
 
-							lineOffsetEndOfChunk = lineLength;
-						}
+			Collections::Array<Collections::Array<T_CONTAINER>> containers(
+				count
+			);
 
-						lineChunks[lineChunksCount++] = line.SubString(
-							lineOffset,
-							lineOffsetEndOfChunk - lineOffset
+			try
+			{
+				OS::Parallel::For(
+					pool,
+					0,
+					count,
+					[lineEnding, &chunks, &containers](size_t _index)
+					{
+						CSVReader<T_VALUES ...> reader(
+							chunks[_index],
+							static_cast<size_t>(chunks[_index + 1] - chunks[_index]),
+							lineEnding
 						);
 
-						lineOffset = lineOffsetEndOfChunk + 1;
-					}
+						ReadAll(
+							reader,
+							containers[_index]
+						);
+					},
+					1
+				);
+			}
+			catch (Exception&)
+			{
+				// chunks only know their own line numbers, re-read lpBuffer to report the line in it
+				FromBuffer(
+					csv,
+					lpBuffer,
+					static_cast<size_t>(lpEnd - static_cast<const char*>(lpBuffer)),
+					lineSkip,
+					lineEnding
+				);
 
-					if (lineChunksCount != lineChunks.GetCapacity())
-					{
+				return;
+			}
 
-						throw Exception(
-							"Invalid chunk count at line %s",
-							AL::ToString(lineSkip + i).GetCString()
-						);
-					}
+			Collections::Array<size_t> offsets(
+				count + 1
+			);
 
-					container[i] = FromString_LineChunksToContainer(
-						lineChunks
-					);
-				}
+			offsets[0] = 0;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				offsets[i + 1] = offsets[i] + containers[i].GetSize();
 			}
 
+			Collections::Array<T_CONTAINER> container(
+				offsets[count]
+			);
+
+			OS::Parallel::For(
+				pool,
+				0,
+				count,
+				[&offsets, &container, &containers](size_t _index)
+				{
+					for (size_t i = 0; i < containers[_index].GetSize(); ++i)
+					{
+						container[offsets[_index] + i] = Move(
+							containers[_index][i]
+						);
+					}
+				},
+				1
+			);
+
 			csv.container = Move(
 				container
 			);
 		}
+#endif
+
+		// @throw AL::Exception
+		template<typename T_FILE>
+		static Void FromFile(CSV& csv, T_FILE& file, size_t lineSkip = 0, TextLineEndings lineEnding = TextLineEndings::Auto)
+		{
+			CSVReader<T_VALUES ...> reader(
+				file,
+				lineEnding
+			);
+
+			FromReader(
+				csv,
+				reader,
+				lineSkip
+			);
+		}
 
 		CSV()
 		{
@@ -206,28 +1251,45 @@ namespace AL::Serialization
 			return size;
 		}
 
-		String  ToString() const
+		// @throw AL::Exception
+		template<typename T_FILE>
+		Void ToFile(T_FILE& file) const
 		{
-			auto wstring = ToWString();
+			CSVWriter<T_FILE> writer(
+				file
+			);
+
+			for (auto& subContainer : container)
+			{
+				writer.Write(
+					subContainer
+				);
+			}
 
-			return wstring.ToString();
+			writer.Flush();
 		}
-		WString ToWString() const
+
+		String  ToString() const
 		{
-			Text text;
+			StringBuilder            sb;
+			CSVWriter<StringBuilder> writer(sb);
 
 			for (auto& subContainer : container)
 			{
-				auto line = ToWString_ContainerToLine(
+				writer.Write(
 					subContainer
 				);
-
-				text.WriteLine(
-					line
-				);
 			}
 
-			return text.ToWString();
+			writer.Flush();
+
+			return sb.ToString();
+		}
+		WString ToWString() const
+		{
+			auto string = ToString();
+
+			return string.ToWString();
 		}
 
 		CSV& operator = (CSV&& csv)
@@ -267,106 +1329,54 @@ namespace AL::Serialization
 		}
 
 	private:
-		template<size_t I>
-		static constexpr Void    ToWString_ContainerToLine(WString& value, const T_CONTAINER& container)
+		// @throw AL::Exception
+		static Void FromReader(CSV& csv, CSVReader<T_VALUES ...>& reader, size_t lineSkip)
 		{
-			if constexpr (I > 0)
-			{
-
-				value.Append(
-					L','
-				);
-			}
-
-			if constexpr (Is_Type<String, typename Get_Value_Type<I>::Type>::Value)
+			for (size_t i = 0; i < lineSkip; ++i)
 			{
-				auto _value = String::Format(
-					"\"%s\"",
-					container.template Get<I>().GetCString()
-				);
+				if (!reader.SkipLine())
+				{
 
-				value.Append(
-					_value.ToWString()
-				);
+					break;
+				}
 			}
-			else if constexpr (Is_Type<WString, typename Get_Value_Type<I>::Type>::Value)
-			{
-				auto _value = WString::Format(
-					L"\"%s\"",
-					container.template Get<I>().GetCString()
-				);
 
-				value.Append(
-					_value
-				);
-			}
-			else
-			{
-				value.Append(
-					AL::ToWString(
-						container.template Get<I>()
-					)
-				);
-			}
-		}
-		template<size_t ... INDEXES>
-		static constexpr Void    ToWString_ContainerToLine(WString& value, const T_CONTAINER& container, Index_Sequence<INDEXES ...>)
-		{
-			(ToWString_ContainerToLine<INDEXES>(value, container), ...);
-		}
-		static           WString ToWString_ContainerToLine(const T_CONTAINER& container)
-		{
-			WString value;
+			Collections::Array<T_CONTAINER> container;
 
-			ToWString_ContainerToLine(
-				value,
-				container,
-				typename Make_Index_Sequence<sizeof ...(T_VALUES)>::Type {}
+			ReadAll(
+				reader,
+				container
 			);
 
-			return value;
+			csv.container = Move(
+				container
+			);
 		}
 
-		template<size_t I>
-		static constexpr Void        FromString_LineChunksToContainer(T_CONTAINER& value, const Collections::Array<WString>& chunks)
+		// @throw AL::Exception
+		static Void ReadAll(CSVReader<T_VALUES ...>& reader, Collections::Array<T_CONTAINER>& container)
 		{
-			if constexpr (Is_Type<String, typename Get_Value_Type<I>::Type>::Value)
-			{
-				value.template Set<I>(
-					chunks[I].ToString()
-				);
-			}
-			else if constexpr (Is_Type<WString, typename Get_Value_Type<I>::Type>::Value)
-			{
-				value.template Set<I>(
-					Move(chunks[I])
-				);
-			}
-			else
+			size_t size = 0;
+
+			for (;; ++size)
 			{
-				value.template Set<I>(
-					AL::FromWString<typename Get_Value_Type<I>::Type>(
-						chunks[I]
-					)
-				);
+				if (size == container.GetSize())
+				{
+					container.SetSize(
+						(size != 0) ? (size * 2) : 64
+					);
+				}
+
+				if (!reader.Read(container[size]))
+				{
+
+					break;
+				}
 			}
-		}
-		template<size_t ... INDEXES>
-		static constexpr Void        FromString_LineChunksToContainer(T_CONTAINER& value, const Collections::Array<WString>& chunks, Index_Sequence<INDEXES ...>)
-		{
-			(FromString_LineChunksToContainer<INDEXES>(value, chunks), ...);
-		}
-		static           T_CONTAINER FromString_LineChunksToContainer(const Collections::Array<WString>& chunks)
-		{
-			T_CONTAINER value;
 
-			FromString_LineChunksToContainer(
-				value,
-				chunks,
-				typename Make_Index_Sequence<sizeof ...(T_VALUES)>::Type {}
+			container.SetSize(
+				size
 			);
-
-			return value;
 		}
 	};
 }
@@ -1,11 +1,11 @@
 #pragma once
 #include "AL/Common.hpp"
 
-#include "AL/Collections/Dictionary.hpp"
+#include "AL/Collections/HashDictionary.hpp"
 
 namespace AL::Serialization::HTTP
 {
-	typedef Collections::Dictionary<String, String> Environment;
+	typedef Collections::HashDictionary<String, String> Environment;
 
 	constexpr const String::Char HTTP_HOST[]                      = "HTTP_HOST";
 	constexpr const String::Char HTTP_CONNECTION[]                = "HTTP_CONNECTION";
@@ -1,9 +1,9 @@
 #pragma once
 #include "AL/Common.hpp"
 
-#include "AL/Collections/Dictionary.hpp"
+#include "AL/Collections/HashDictionary.hpp"
 
 namespace AL::Serialization::HTTP
 {
-	typedef Collections::Dictionary<String, String> Query;
+	typedef Collections::HashDictionary<String, String> Query;
 }
@@ -1,7 +1,17 @@
 #pragma once
 #include "AL/Common.hpp"
 
-#include "AL/Collections/LinkedList.hpp"
+#include "AL/Algorithms/FNV.hpp"
+
+#include "AL/Collections/Arena.hpp"
+#include "AL/Collections/Array.hpp"
+#include "AL/Collections/ArrayList.hpp"
+
+#include <bit> // std::countr_zero
+
+#if defined(AL_FEATURE_SSE2)
+	#include <emmintrin.h>
+#endif
 
 #if defined(AL_PLATFORM_WINDOWS)
 	#undef GetObject
@@ -26,62 +36,27 @@ namespace AL::Serialization
 
 		virtual Bool IsObject() const = 0;
 
-		virtual String  ToString() const
+		// @throw AL::Exception
+		virtual String  ToString() const;
+		// @throw AL::Exception
+		virtual WString ToWString() const
 		{
-			auto wstring = ToWString();
+			auto string = ToString();
 
-			return wstring.ToString();
+			return string.ToWString();
 		}
-		virtual WString ToWString() const = 0;
 
 	protected:
-		static WString Encode(const String& value)
-		{
-			return Encode(value.ToWString());
-		}
+		// @throw AL::Exception
+		static String  Encode(const String& value);
+		// @throw AL::Exception
 		static WString Encode(const WString& value)
 		{
-			WStringBuilder sb;
-
-			for (auto c : value)
-			{
-				switch (c)
-				{
-					case L'\b':
-						sb << L"\\b";
-						break;
-
-					case L'\f':
-						sb << L"\\f";
-						break;
-
-					case L'\n':
-						sb << L"\\n";
-						break;
-
-					case L'\r':
-						sb << L"\\r";
-						break;
-
-					case L'\t':
-						sb << L"\\t";
-						break;
-
-					case L'"':
-						sb << L"\\\"";
-						break;
-
-					case L'\\':
-						sb << L"\\\\";
-						break;
-
-					default:
-						sb << c;
-						break;
-				}
-			}
+			auto string = Encode(
+				value.ToString()
+			);
 
-			return sb.ToString();
+			return string.ToWString();
 		}
 
 		static String Decode(const String& value)
@@ -133,439 +108,2524 @@ namespace AL::Serialization
 		}
 	};
 
-	class JSONArray;
-	class JSONValue;
-	class JSONObject;
-
-	class JSONValue
-		: public IJSON
+	// SAX interface of JSONParser
+	// - Returning False from a callback stops parsing
+	// - Views are only valid until the callback returns
+	class IJSONHandler
 	{
-		static constexpr const WString::Char REGEX_PATTERN_NULL[]    = L"";
-		static constexpr const WString::Char REGEX_PATTERN_NUMBER[]  = L"";
-		static constexpr const WString::Char REGEX_PATTERN_STRING[]  = L"";
-		static constexpr const WString::Char REGEX_PATTERN_BOOLEAN[] = L"";
-		static constexpr const WString::Char REGEX_PATTERN_DECIMAL[] = L"";
-		static constexpr const WString::Char REGEX_PATTERN_INTEGER[] = L"";
-
-		Bool isNull    = False;
-		Bool isNumber  = False;
-		Bool isString  = False;
-		Bool isBoolean = False;
-		Bool isDecimal = False;
-		Bool isInteger = False;
+	public:
+		IJSONHandler()
+		{
+		}
 
-		struct
+		virtual ~IJSONHandler()
 		{
-			AL::String String;
+		}
 
-			union
-			{
-				Bool   Boolean;
-				Double Decimal;
-				int64  Integer;
-			};
-		} value;
+		// @throw AL::Exception
+		virtual Bool OnNull() = 0;
+		// @throw AL::Exception
+		virtual Bool OnBoolean(Bool value) = 0;
+		// @throw AL::Exception
+		virtual Bool OnInteger(int64 value) = 0;
+		// @throw AL::Exception
+		virtual Bool OnDecimal(Double value) = 0;
+		// @throw AL::Exception
+		virtual Bool OnString(const StringView& value) = 0;
 
-	public:
 		// @throw AL::Exception
-		static Void FromString(JSONValue& value, const String& string)
+		virtual Bool OnArrayBegin() = 0;
+		// @throw AL::Exception
+		virtual Bool OnArrayEnd() = 0;
+
+		// @throw AL::Exception
+		virtual Bool OnObjectBegin() = 0;
+		// @throw AL::Exception
+		virtual Bool OnObjectKey(const StringView& name) = 0;
+		// @throw AL::Exception
+		virtual Bool OnObjectEnd() = 0;
+	};
+
+	struct __JSON_Utility
+	{
+		static constexpr size_t BLOCK_SIZE = 64;
+
+		// Bit i is set if character i of the block is of the class
+		struct Block
 		{
-			auto wstring = string.ToWString();
+			uint64 Quote;
+			uint64 Backslash;
+			uint64 Operator;
+			uint64 Whitespace;
+		};
 
-			FromString(
-				value,
-				wstring
-			);
-		}
+		// Finds the offset of every structural character outside of strings, every opening quote and the first character of every scalar
+		// - simdjson stage 1, 64 characters at a time
 		// @throw AL::Exception
-		static Void FromString(JSONValue& value, const WString& wstring)
+		static Void FindStructurals(Collections::ArrayList<uint32>& structurals, const char* lpBuffer, size_t size)
 		{
-			// TODO: implement
-			throw NotImplementedException();
+			if (size > Integer<uint32>::Maximum)
+			{
+
+				throw Exception(
+					"JSON larger than 4 GiB is not supported"
+				);
+			}
+
+			uint64 isInString = 0;
+			uint64 isEscaped  = 0;
+			uint64 isScalar   = 0;
+
+			Block  block;
+			char   lastBlock[BLOCK_SIZE];
+
+			for (size_t offset = 0; offset < size; offset += BLOCK_SIZE)
+			{
+				auto lpBlock = &lpBuffer[offset];
+
+				// the last block is padded with whitespace
+				if ((size - offset) < BLOCK_SIZE)
+				{
+					memset(&lastBlock[0], ' ', BLOCK_SIZE);
+					memcpy(&lastBlock[0], lpBlock, size - offset);
+
+					lpBlock = &lastBlock[0];
+				}
+
+				ClassifyBlock(
+					block,
+					lpBlock
+				);
+
+				auto escaped = FindEscaped(
+					block.Backslash,
+					isEscaped
+				);
+
+				auto quotes  = block.Quote & ~escaped;
+				auto strings = PrefixXor(quotes) ^ isInString;
+				isInString   = static_cast<uint64>(static_cast<int64>(strings) >> 63);
+
+				auto scalars = ~(block.Operator | block.Whitespace | quotes | strings);
+				auto mask    = (block.Operator & ~strings) | (quotes & strings) | (scalars & ~((scalars << 1) | isScalar));
+				isScalar     = scalars >> 63;
+
+				for (; mask != 0; mask &= mask - 1)
+				{
+					structurals.PushBack(
+						static_cast<uint32>(offset + ::std::countr_zero(mask))
+					);
+				}
+			}
+
+			if (isInString != 0)
+			{
+
+				throw Exception(
+					"Unterminated JSON string"
+				);
+			}
 		}
 
-		JSONValue()
-			: isNull(
-				True
-			)
+		// Finds the first '"', '\\' or control character
+		static const char* FindStringSpecial(const char* lpChar, const char* lpEnd)
 		{
-		}
+#if defined(AL_FEATURE_SSE2)
+			auto quote     = ::_mm_set1_epi8('"');
+			auto backslash = ::_mm_set1_epi8('\\');
+			auto control   = ::_mm_set1_epi8(0x1F);
 
-		JSONValue(Bool value)
-			: isBoolean(
-				true
-			),
-			value{
-				.Boolean = value
+			for (; (lpEnd - lpChar) >= 16; lpChar += 16)
+			{
+				auto chunk = ::_mm_loadu_si128(
+					reinterpret_cast<const __m128i*>(lpChar)
+				);
+
+				auto mask = ::_mm_movemask_epi8(
+					::_mm_or_si128(
+						::_mm_or_si128(::_mm_cmpeq_epi8(chunk, quote), ::_mm_cmpeq_epi8(chunk, backslash)),
+						::_mm_cmpeq_epi8(::_mm_min_epu8(chunk, control), chunk)
+					)
+				);
+
+				if (mask != 0)
+				{
+
+					return lpChar + ::std::countr_zero(static_cast<uint32>(mask));
+				}
 			}
-		{
-		}
-		JSONValue(int8 value)
-			: isNumber(
-				True
-			),
-			isInteger(
-				True
-			),
-			value{
-				.Integer = value
+#endif
+
+			for (; lpChar != lpEnd; ++lpChar)
+			{
+				if ((*lpChar == '"') || (*lpChar == '\\') || (static_cast<uint8>(*lpChar) < 0x20))
+				{
+
+					break;
+				}
 			}
-		{
+
+			return lpChar;
 		}
-		JSONValue(int16 value)
-			: isNumber(
-				True
-			),
-			isInteger(
-				True
-			),
-			value{
-				.Integer = value
-			}
+
+		// Rejects overlong sequences, surrogates and code points above U+10FFFF
+		// @return offset of the first byte not part of a valid sequence, size if every sequence is valid
+		static size_t FindInvalidUTF8(const char* lpBuffer, size_t size)
 		{
-		}
-		JSONValue(int32 value)
-			: isNumber(
-				True
-			),
-			isInteger(
-				True
-			),
-			value{
-				.Integer = value
+			auto lpBytes = reinterpret_cast<const uint8*>(lpBuffer);
+
+			for (size_t offset = 0; offset < size; )
+			{
+				// ASCII is skipped 8 bytes at a time
+				if ((size - offset) >= sizeof(uint64))
+				{
+					uint64 chunk;
+
+					memcpy(&chunk, &lpBytes[offset], sizeof(uint64));
+
+					if ((chunk & 0x8080808080808080) == 0)
+					{
+						offset += sizeof(uint64);
+
+						continue;
+					}
+				}
+
+				auto   c = lpBytes[offset];
+				size_t length;
+				uint32 codePoint;
+				uint32 codePointMinimum;
+
+				if (c < 0x80)
+				{
+					++offset;
+
+					continue;
+				}
+				else if ((c & 0xE0) == 0xC0)
+				{
+					length           = 2;
+					codePoint        = c & 0x1F;
+					codePointMinimum = 0x80;
+				}
+				else if ((c & 0xF0) == 0xE0)
+				{
+					length           = 3;
+					codePoint        = c & 0x0F;
+					codePointMinimum = 0x800;
+				}
+				else if ((c & 0xF8) == 0xF0)
+				{
+					length           = 4;
+					codePoint        = c & 0x07;
+					codePointMinimum = 0x10000;
+				}
+				else
+				{
+
+					return offset;
+				}
+
+				if ((size - offset) < length)
+				{
+
+					return offset;
+				}
+
+				for (size_t i = 1; i < length; ++i)
+				{
+					if ((lpBytes[offset + i] & 0xC0) != 0x80)
+					{
+
+						return offset;
+					}
+
+					codePoint = (codePoint << 6) | (lpBytes[offset + i] & 0x3F);
+				}
+
+				if ((codePoint < codePointMinimum) || ((codePoint >= 0xD800) && (codePoint <= 0xDFFF)) || (codePoint > 0x10FFFF))
+				{
+
+					return offset;
+				}
+
+				offset += length;
 			}
-		{
+
+			return size;
 		}
-		JSONValue(int64 value)
-			: isNumber(
-				True
-			),
-			isInteger(
-				True
-			),
-			value{
-				.Integer = value
-			}
+
+		static constexpr Bool IsDelimiter(char c)
 		{
+			switch (c)
+			{
+				case ' ':
+				case '\t':
+				case '\n':
+				case '\r':
+				case ',':
+				case ':':
+				case '[':
+				case ']':
+				case '{':
+				case '}':
+					return True;
+			}
+
+			return False;
 		}
-		JSONValue(uint8 value)
-			: isNumber(
-				True
-			),
-			isInteger(
-				True
-			),
-			value{
-				.Integer = value
+
+	private:
+		// Finds the characters following an odd length run of backslashes
+		// - isEscaped carries a run that ends on the last character of the previous block
+		static constexpr uint64 FindEscaped(uint64 backslash, uint64& isEscaped)
+		{
+			constexpr uint64 ODD_BITS = 0xAAAAAAAAAAAAAAAA;
+
+			if (backslash == 0)
+			{
+				auto escaped = isEscaped;
+				isEscaped    = 0;
+
+				return escaped;
 			}
+
+			// adding the first backslash of every run to an alternating mask carries to the end of the run
+			auto start   = backslash & ~isEscaped;
+			auto code    = (((start << 1) | ODD_BITS) - start) ^ ODD_BITS;
+			auto escaped = code ^ (backslash | isEscaped);
+			isEscaped    = (code & backslash) >> 63;
+
+			return escaped;
+		}
+
+		static constexpr uint64 PrefixXor(uint64 value)
 		{
+			value ^= value << 1;
+			value ^= value << 2;
+			value ^= value << 4;
+			value ^= value << 8;
+			value ^= value << 16;
+			value ^= value << 32;
+
+			return value;
 		}
-		JSONValue(uint16 value)
-			: isNumber(
-				True
-			),
+
+		static Void ClassifyBlock(Block& block, const char* lpBlock)
+		{
+#if defined(AL_FEATURE_SSE2)
+			block = {};
+
+			for (size_t i = 0; i < BLOCK_SIZE; i += 16)
+			{
+				auto chunk = ::_mm_loadu_si128(
+					reinterpret_cast<const __m128i*>(&lpBlock[i])
+				);
+
+				// '[' and ']' differ from '{' and '}' by 0x20
+				auto chunk_Lowercase = ::_mm_or_si128(
+					chunk,
+					::_mm_set1_epi8(0x20)
+				);
+
+				auto quote      = ::_mm_cmpeq_epi8(chunk, ::_mm_set1_epi8('"'));
+				auto backslash  = ::_mm_cmpeq_epi8(chunk, ::_mm_set1_epi8('\\'));
+				auto operators  = ::_mm_or_si128(
+					::_mm_or_si128(::_mm_cmpeq_epi8(chunk_Lowercase, ::_mm_set1_epi8('{')), ::_mm_cmpeq_epi8(chunk_Lowercase, ::_mm_set1_epi8('}'))),
+					::_mm_or_si128(::_mm_cmpeq_epi8(chunk, ::_mm_set1_epi8(':')), ::_mm_cmpeq_epi8(chunk, ::_mm_set1_epi8(',')))
+				);
+				auto whitespace = ::_mm_or_si128(
+					::_mm_or_si128(::_mm_cmpeq_epi8(chunk, ::_mm_set1_epi8(' ')), ::_mm_cmpeq_epi8(chunk, ::_mm_set1_epi8('\t'))),
+					::_mm_or_si128(::_mm_cmpeq_epi8(chunk, ::_mm_set1_epi8('\n')), ::_mm_cmpeq_epi8(chunk, ::_mm_set1_epi8('\r')))
+				);
+
+				block.Quote      |= static_cast<uint64>(static_cast<uint16>(::_mm_movemask_epi8(quote))) << i;
+				block.Backslash  |= static_cast<uint64>(static_cast<uint16>(::_mm_movemask_epi8(backslash))) << i;
+				block.Operator   |= static_cast<uint64>(static_cast<uint16>(::_mm_movemask_epi8(operators))) << i;
+				block.Whitespace |= static_cast<uint64>(static_cast<uint16>(::_mm_movemask_epi8(whitespace))) << i;
+			}
+#else
+			block = {};
+
+			for (size_t i = 0; i < BLOCK_SIZE; ++i)
+			{
+				auto bit = uint64(1) << i;
+
+				switch (lpBlock[i])
+				{
+					case '"':
+						block.Quote |= bit;
+						break;
+
+					case '\\':
+						block.Backslash |= bit;
+						break;
+
+					case '{':
+					case '}':
+					case '[':
+					case ']':
+					case ':':
+					case ',':
+						block.Operator |= bit;
+						break;
+
+					case ' ':
+					case '\t':
+					case '\n':
+					case '\r':
+						block.Whitespace |= bit;
+						break;
+				}
+			}
+#endif
+		}
+	};
+
+	// Writes decoded characters back into the string being decoded
+	struct __JSON_InSitu_Writer
+	{
+		char* lpDestination;
+
+		Void Append(char c)
+		{
+			*lpDestination++ = c;
+		}
+
+		Void Append(const char* lpBuffer, size_t size)
+		{
+			memmove(
+				lpDestination,
+				lpBuffer,
+				size
+			);
+
+			lpDestination += size;
+		}
+	};
+
+	// Two stage parser for UTF-8 JSON
+	// - Stage 1 indexes every structural character, stage 2 walks the index and calls T_HANDLER
+	// - T_HANDLER must provide the functions of IJSONHandler, virtual or not
+	class JSONParser
+	{
+		static constexpr size_t MAXIMUM_DEPTH = 1024;
+
+		const char*                    lpBuffer;
+		char*                          lpInSituBuffer;
+		size_t                         size;
+
+		Collections::ArrayList<uint32> structurals;
+		size_t                         structuralIndex = 0;
+
+		// escaped strings are decoded here unless parsing in situ
+		String                         decodeBuffer;
+
+		JSONParser(const char* lpBuffer, char* lpInSituBuffer, size_t size)
+			: lpBuffer(
+				lpBuffer
+			),
+			lpInSituBuffer(
+				lpInSituBuffer
+			),
+			size(
+				size
+			)
+		{
+		}
+
+	public:
+		// @throw AL::Exception
+		// @return AL::False if handler stopped parsing
+		template<typename T_HANDLER>
+		static Bool Parse(T_HANDLER& handler, const String& string)
+		{
+			return Parse(
+				handler,
+				string.GetCString(),
+				string.GetLength()
+			);
+		}
+		// @throw AL::Exception
+		// @return AL::False if handler stopped parsing
+		template<typename T_HANDLER>
+		static Bool Parse(T_HANDLER& handler, const Void* lpBuffer, size_t size)
+		{
+			JSONParser parser(
+				static_cast<const char*>(lpBuffer),
+				nullptr,
+				size
+			);
+
+			return parser.Run(
+				handler
+			);
+		}
+
+		// Escaped strings are decoded in place so every view points into lpBuffer
+		// - The content of lpBuffer is undefined afterwards
+		// @throw AL::Exception
+		// @return AL::False if handler stopped parsing
+		template<typename T_HANDLER>
+		static Bool ParseInSitu(T_HANDLER& handler, Void* lpBuffer, size_t size)
+		{
+			JSONParser parser(
+				static_cast<const char*>(lpBuffer),
+				static_cast<char*>(lpBuffer),
+				size
+			);
+
+			return parser.Run(
+				handler
+			);
+		}
+
+	private:
+		// @throw AL::Exception
+		template<typename T_HANDLER>
+		Bool Run(T_HANDLER& handler)
+		{
+			structurals.SetCapacity(
+				size / 4
+			);
+
+			__JSON_Utility::FindStructurals(
+				structurals,
+				lpBuffer,
+				size
+			);
+
+			if (auto offset = __JSON_Utility::FindInvalidUTF8(lpBuffer, size); offset != size)
+			{
+
+				ThrowUnexpected(
+					offset,
+					"UTF-8"
+				);
+			}
+
+			if (structurals.GetSize() == 0)
+			{
+
+				throw Exception(
+					"JSON is empty"
+				);
+			}
+
+			if (!ParseValue(handler, 0))
+			{
+
+				return False;
+			}
+
+			if (structuralIndex != structurals.GetSize())
+			{
+
+				ThrowUnexpected(
+					structurals[structuralIndex],
+					"end of JSON"
+				);
+			}
+
+			return True;
+		}
+
+		// @throw AL::Exception
+		template<typename T_HANDLER>
+		Bool ParseValue(T_HANDLER& handler, size_t depth)
+		{
+			auto offset = Next();
+
+			switch (lpBuffer[offset])
+			{
+				case '{':
+					return ParseObject(handler, offset, depth + 1);
+
+				case '[':
+					return ParseArray(handler, offset, depth + 1);
+
+				case '"':
+				{
+					StringView value;
+
+					ParseString(
+						value,
+						offset
+					);
+
+					return handler.OnString(value);
+				}
+
+				case 't':
+					ParseLiteral(offset, "true");
+					return handler.OnBoolean(True);
+
+				case 'f':
+					ParseLiteral(offset, "false");
+					return handler.OnBoolean(False);
+
+				case 'n':
+					ParseLiteral(offset, "null");
+					return handler.OnNull();
+			}
+
+			return ParseNumber(
+				handler,
+				offset
+			);
+		}
+
+		// @throw AL::Exception
+		template<typename T_HANDLER>
+		Bool ParseArray(T_HANDLER& handler, size_t offset, size_t depth)
+		{
+			if (depth > MAXIMUM_DEPTH)
+			{
+
+				ThrowUnexpected(
+					offset,
+					"less nesting"
+				);
+			}
+
+			if (!handler.OnArrayBegin())
+			{
+
+				return False;
+			}
+
+			if (Peek() == ']')
+			{
+				Next();
+
+				return handler.OnArrayEnd();
+			}
+
+			do
+			{
+				if (!ParseValue(handler, depth))
+				{
+
+					return False;
+				}
+			} while (Expect(',', ']') == ',');
+
+			return handler.OnArrayEnd();
+		}
+
+		// @throw AL::Exception
+		template<typename T_HANDLER>
+		Bool ParseObject(T_HANDLER& handler, size_t offset, size_t depth)
+		{
+			if (depth > MAXIMUM_DEPTH)
+			{
+
+				ThrowUnexpected(
+					offset,
+					"less nesting"
+				);
+			}
+
+			if (!handler.OnObjectBegin())
+			{
+
+				return False;
+			}
+
+			if (Peek() == '}')
+			{
+				Next();
+
+				return handler.OnObjectEnd();
+			}
+
+			do
+			{
+				if (lpBuffer[offset = Next()] != '"')
+				{
+
+					ThrowUnexpected(
+						offset,
+						"member name"
+					);
+				}
+
+				StringView name;
+
+				ParseString(
+					name,
+					offset
+				);
+
+				if (!handler.OnObjectKey(name))
+				{
+
+					return False;
+				}
+
+				Expect(
+					':',
+					':'
+				);
+
+				if (!ParseValue(handler, depth))
+				{
+
+					return False;
+				}
+			} while (Expect(',', '}') == ',');
+
+			return handler.OnObjectEnd();
+		}
+
+		// @throw AL::Exception
+		template<typename T_HANDLER>
+		Bool ParseNumber(T_HANDLER& handler, size_t offset)
+		{
+			auto lpStart = &lpBuffer[offset];
+			auto lpEnd   = &lpBuffer[size];
+			auto lpChar  = lpStart;
+
+			Bool isNegative = (*lpChar == '-');
+
+			if (isNegative)
+			{
+
+				++lpChar;
+			}
+
+			auto lpDigits = lpChar;
+
+			if ((lpChar == lpEnd) || !IsDigit(*lpChar))
+			{
+
+				ThrowUnexpected(
+					offset,
+					"value"
+				);
+			}
+
+			uint64 integer = 0;
+
+			for (; (lpChar != lpEnd) && IsDigit(*lpChar); ++lpChar)
+			{
+				integer = (integer * 10) + static_cast<uint64>(*lpChar - '0');
+			}
+
+			auto digitCount = static_cast<size_t>(lpChar - lpDigits);
+
+			if ((*lpDigits == '0') && (digitCount > 1))
+			{
+
+				ThrowUnexpected(
+					offset,
+					"number without leading zeros"
+				);
+			}
+
+			Bool isDecimal = False;
+
+			if ((lpChar != lpEnd) && (*lpChar == '.'))
+			{
+				isDecimal = True;
+
+				if ((++lpChar == lpEnd) || !IsDigit(*lpChar))
+				{
+
+					ThrowUnexpected(
+						offset,
+						"fraction"
+					);
+				}
+
+				while ((lpChar != lpEnd) && IsDigit(*lpChar))
+				{
+					++lpChar;
+				}
+			}
+
+			if ((lpChar != lpEnd) && ((*lpChar == 'e') || (*lpChar == 'E')))
+			{
+				isDecimal = True;
+
+				if ((++lpChar != lpEnd) && ((*lpChar == '+') || (*lpChar == '-')))
+				{
+
+					++lpChar;
+				}
+
+				if ((lpChar == lpEnd) || !IsDigit(*lpChar))
+				{
+
+					ThrowUnexpected(
+						offset,
+						"exponent"
+					);
+				}
+
+				while ((lpChar != lpEnd) && IsDigit(*lpChar))
+				{
+					++lpChar;
+				}
+			}
+
+			if ((lpChar != lpEnd) && !__JSON_Utility::IsDelimiter(*lpChar))
+			{
+
+				ThrowUnexpected(
+					offset,
+					"number"
+				);
+			}
+
+			// 19 digits always fit in uint64
+			if (!isDecimal && (digitCount <= 19))
+			{
+				if (!isNegative && (integer <= static_cast<uint64>(Integer<int64>::Maximum)))
+				{
+
+					return handler.OnInteger(
+						static_cast<int64>(integer)
+					);
+				}
+
+				if (isNegative && (integer <= (static_cast<uint64>(Integer<int64>::Maximum) + 1)))
+				{
+
+					return handler.OnInteger(
+						static_cast<int64>(0 - integer)
+					);
+				}
+			}
+
+			// integers too large for int64 are passed as decimals
+			Double decimal;
+
+#if defined(__cpp_lib_to_chars)
+			if (::std::from_chars(lpStart, lpChar, decimal).ec != ::std::errc())
+			{
+
+				ThrowUnexpected(
+					offset,
+					"number in range of Double"
+				);
+			}
+#else
+			decimal = ::strtod(
+				String(lpStart, static_cast<size_t>(lpChar - lpStart)).GetCString(),
+				nullptr
+			);
+#endif
+
+			return handler.OnDecimal(
+				decimal
+			);
+		}
+
+		// @throw AL::Exception
+		template<size_t S>
+		Void ParseLiteral(size_t offset, const char(&literal)[S])
+		{
+			static constexpr size_t length = S - 1;
+
+			if (((size - offset) < length) || !memcmp(&lpBuffer[offset], &literal[0], length) || (((offset + length) < size) && !__JSON_Utility::IsDelimiter(lpBuffer[offset + length])))
+			{
+
+				ThrowUnexpected(
+					offset,
+					&literal[0]
+				);
+			}
+		}
+
+		// @throw AL::Exception
+		Void ParseString(StringView& value, size_t offset)
+		{
+			auto lpStart = &lpBuffer[offset + 1];
+			auto lpEnd   = &lpBuffer[size];
+			auto lpChar  = __JSON_Utility::FindStringSpecial(
+				lpStart,
+				lpEnd
+			);
+
+			if ((lpChar != lpEnd) && (*lpChar == '"'))
+			{
+				value = StringView(
+					lpStart,
+					static_cast<size_t>(lpChar - lpStart)
+				);
+
+				return;
+			}
+
+			if (lpInSituBuffer != nullptr)
+			{
+				__JSON_InSitu_Writer writer =
+				{
+					.lpDestination = &lpInSituBuffer[lpChar - lpBuffer]
+				};
+
+				DecodeString(
+					writer,
+					lpChar,
+					lpEnd
+				);
+
+				value = StringView(
+					lpStart,
+					static_cast<size_t>(writer.lpDestination - lpStart)
+				);
+			}
+			else
+			{
+				decodeBuffer.Assign(
+					lpStart,
+					static_cast<size_t>(lpChar - lpStart)
+				);
+
+				DecodeString(
+					decodeBuffer,
+					lpChar,
+					lpEnd
+				);
+
+				value = decodeBuffer;
+			}
+		}
+
+		// Decodes from lpChar to the closing quote
+		// @throw AL::Exception
+		template<typename T_WRITER>
+		Void DecodeString(T_WRITER& writer, const char* lpChar, const char* lpEnd)
+		{
+			for (;;)
+			{
+				if (lpChar == lpEnd)
+				{
+
+					ThrowUnexpected(
+						size,
+						"'\"'"
+					);
+				}
+
+				if (*lpChar == '"')
+				{
+
+					break;
+				}
+
+				if (*lpChar != '\\')
+				{
+
+					ThrowUnexpected(
+						static_cast<size_t>(lpChar - lpBuffer),
+						"escaped control character"
+					);
+				}
+
+				if (++lpChar == lpEnd)
+				{
+
+					continue;
+				}
+
+				switch (*lpChar++)
+				{
+					case '"':  writer.Append('"');  break;
+					case '\\': writer.Append('\\'); break;
+					case '/':  writer.Append('/');  break;
+					case 'b':  writer.Append('\b'); break;
+					case 'f':  writer.Append('\f'); break;
+					case 'n':  writer.Append('\n'); break;
+					case 'r':  writer.Append('\r'); break;
+					case 't':  writer.Append('\t'); break;
+
+					case 'u':
+					{
+						auto codePoint = DecodeUTF16(
+							lpChar,
+							lpEnd
+						);
+
+						char buffer[4];
+
+						writer.Append(
+							&buffer[0],
+							EncodeUTF8(buffer, codePoint)
+						);
+					}
+					break;
+
+					default:
+						ThrowUnexpected(
+							static_cast<size_t>(lpChar - lpBuffer - 1),
+							"escape sequence"
+						);
+				}
+
+				auto lpSpecial = __JSON_Utility::FindStringSpecial(
+					lpChar,
+					lpEnd
+				);
+
+				writer.Append(
+					lpChar,
+					static_cast<size_t>(lpSpecial - lpChar)
+				);
+
+				lpChar = lpSpecial;
+			}
+		}
+
+		// Decodes the XXXX of \uXXXX and the low surrogate that may follow it
+		// @throw AL::Exception
+		uint32 DecodeUTF16(const char*& lpChar, const char* lpEnd)
+		{
+			auto codeUnit = DecodeHex(
+				lpChar,
+				lpEnd
+			);
+
+			// a low surrogate must follow a high surrogate
+			if ((codeUnit >= 0xDC00) && (codeUnit <= 0xDFFF))
+			{
+
+				ThrowUnexpected(
+					static_cast<size_t>(lpChar - lpBuffer - 4),
+					"high surrogate"
+				);
+			}
+
+			if ((codeUnit >= 0xD800) && (codeUnit <= 0xDBFF))
+			{
+				if (((lpEnd - lpChar) < 2) || (lpChar[0] != '\\') || (lpChar[1] != 'u'))
+				{
+
+					ThrowUnexpected(
+						static_cast<size_t>(lpChar - lpBuffer),
+						"low surrogate"
+					);
+				}
+
+				lpChar += 2;
+
+				auto lowSurrogate = DecodeHex(
+					lpChar,
+					lpEnd
+				);
+
+				if ((lowSurrogate < 0xDC00) || (lowSurrogate > 0xDFFF))
+				{
+
+					ThrowUnexpected(
+						static_cast<size_t>(lpChar - lpBuffer - 4),
+						"low surrogate"
+					);
+				}
+
+				return 0x10000 + ((codeUnit - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+			}
+
+			return codeUnit;
+		}
+
+		// @throw AL::Exception
+		uint32 DecodeHex(const char*& lpChar, const char* lpEnd)
+		{
+			uint32 value = 0;
+
+			for (size_t i = 0; i < 4; ++i, ++lpChar)
+			{
+				if (lpChar == lpEnd)
+				{
+
+					ThrowUnexpected(
+						size,
+						"hex digit"
+					);
+				}
+
+				auto c = *lpChar;
+
+				if ((c >= '0') && (c <= '9'))
+					value = (value << 4) | static_cast<uint32>(c - '0');
+				else if ((c >= 'a') && (c <= 'f'))
+					value = (value << 4) | static_cast<uint32>(c - 'a' + 10);
+				else if ((c >= 'A') && (c <= 'F'))
+					value = (value << 4) | static_cast<uint32>(c - 'A' + 10);
+				else
+				{
+
+					ThrowUnexpected(
+						static_cast<size_t>(lpChar - lpBuffer),
+						"hex digit"
+					);
+				}
+			}
+
+			return value;
+		}
+
+		// @return number of bytes written
+		static size_t EncodeUTF8(char(&buffer)[4], uint32 codePoint)
+		{
+			if (codePoint < 0x80)
+			{
+				buffer[0] = static_cast<char>(codePoint);
+
+				return 1;
+			}
+
+			if (codePoint < 0x800)
+			{
+				buffer[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+				buffer[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+
+				return 2;
+			}
+
+			if (codePoint < 0x10000)
+			{
+				buffer[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+				buffer[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+				buffer[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+
+				return 3;
+			}
+
+			buffer[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+			buffer[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+			buffer[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			buffer[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+
+			return 4;
+		}
+
+		static constexpr Bool IsDigit(char c)
+		{
+			return (c >= '0') && (c <= '9');
+		}
+
+		char Peek() const
+		{
+			if (structuralIndex == structurals.GetSize())
+			{
+
+				return '\0';
+			}
+
+			return lpBuffer[structurals[structuralIndex]];
+		}
+
+		// @throw AL::Exception
+		size_t Next()
+		{
+			if (structuralIndex == structurals.GetSize())
+			{
+
+				ThrowUnexpected(
+					size,
+					"value"
+				);
+			}
+
+			return structurals[structuralIndex++];
+		}
+
+		// @throw AL::Exception
+		// @return c or c2
+		char Expect(char c, char c2)
+		{
+			auto offset = Next();
+
+			if ((lpBuffer[offset] != c) && (lpBuffer[offset] != c2))
+			{
+
+				ThrowUnexpected(
+					offset,
+					(c == c2) ? String::Format("'%c'", c).GetCString() : String::Format("'%c' or '%c'", c, c2).GetCString()
+				);
+			}
+
+			return lpBuffer[offset];
+		}
+
+		// @throw AL::Exception
+		[[noreturn]]
+		Void ThrowUnexpected(size_t offset, const char* lpExpected) const
+		{
+			throw Exception(
+				"Invalid JSON at offset %llu: Expected %s",
+				static_cast<unsigned long long>(offset),
+				lpExpected
+			);
+		}
+	};
+
+	class JSONArray;
+	class JSONValue;
+	class JSONObject;
+
+	class __JSON_DOM_Handler;
+
+	template<typename T_OUTPUT>
+	class JSONWriter;
+
+	// Allocates DOM nodes and their storage in an arena, or on the heap if the arena is nullptr
+	// - Nothing allocated in an arena is destroyed or freed, the arena releases it all at once
+	struct __JSON_DOM_Utility
+	{
+		static Void* Allocate(Collections::Arena* lpArena, size_t size)
+		{
+			if (lpArena != nullptr)
+			{
+
+				return lpArena->Allocate(
+					size
+				);
+			}
+
+			return ::operator new(
+				size
+			);
+		}
+
+		static Void Free(Collections::Arena* lpArena, Void* lpBuffer)
+		{
+			if ((lpArena == nullptr) && (lpBuffer != nullptr))
+			{
+
+				::operator delete(
+					lpBuffer
+				);
+			}
+		}
+
+		// Null terminated copy of lpString
+		static char* CreateString(Collections::Arena* lpArena, const char* lpString, size_t length)
+		{
+			auto lpBuffer = static_cast<char*>(
+				Allocate(lpArena, length + 1)
+			);
+
+			if (length != 0)
+			{
+				memcpy(
+					lpBuffer,
+					lpString,
+					length
+				);
+			}
+
+			lpBuffer[length] = '\0';
+
+			return lpBuffer;
+		}
+
+		template<typename T, typename ... TArgs>
+		static T* Create(Collections::Arena* lpArena, TArgs&& ... args)
+		{
+			if (lpArena != nullptr)
+			{
+
+				return new (lpArena->Allocate(sizeof(T), alignof(T))) T(
+					lpArena,
+					Forward<TArgs>(args) ...
+				);
+			}
+
+			return new T(
+				lpArena,
+				Forward<TArgs>(args) ...
+			);
+		}
+
+		static Void Destroy(Collections::Arena* lpArena, IJSON* lpJSON)
+		{
+			if (lpArena == nullptr)
+			{
+
+				delete lpJSON;
+			}
+		}
+
+		// Deep copy of json allocated with lpArena
+		static IJSON* Copy(Collections::Arena* lpArena, const IJSON& json);
+	};
+
+	// Flat storage of trivially copyable values allocated with __JSON_DOM_Utility
+	// - The allocator is passed to every call that allocates or frees
+	template<typename T>
+	class __JSON_DOM_Vector
+	{
+		T*     lpValues = nullptr;
+		size_t size     = 0;
+		size_t capacity = 0;
+
+	public:
+		typedef T*       Iterator;
+		typedef const T* ConstIterator;
+
+		__JSON_DOM_Vector()
+		{
+		}
+
+		__JSON_DOM_Vector(const __JSON_DOM_Vector&) = delete;
+
+		size_t GetSize() const
+		{
+			return size;
+		}
+
+		size_t GetCapacity() const
+		{
+			return capacity;
+		}
+
+		Void SetCapacity(Collections::Arena* lpArena, size_t value)
+		{
+			auto lpNewValues = static_cast<T*>(
+				__JSON_DOM_Utility::Allocate(lpArena, value * sizeof(T))
+			);
+
+			if (size != 0)
+			{
+				memcpy(
+					lpNewValues,
+					lpValues,
+					size * sizeof(T)
+				);
+			}
+
+			__JSON_DOM_Utility::Free(
+				lpArena,
+				lpValues
+			);
+
+			lpValues = lpNewValues;
+			capacity = value;
+		}
+
+		Void PushBack(Collections::Arena* lpArena, const T& value)
+		{
+			if (size == capacity)
+			{
+
+				SetCapacity(
+					lpArena,
+					(capacity != 0) ? (capacity * 2) : 4
+				);
+			}
+
+			lpValues[size++] = value;
+		}
+
+		Void Erase(size_t index)
+		{
+			memmove(
+				&lpValues[index],
+				&lpValues[index + 1],
+				(--size - index) * sizeof(T)
+			);
+		}
+
+		// Takes the values of vector, which must be allocated the same way
+		Void Take(__JSON_DOM_Vector& vector)
+		{
+			lpValues        = vector.lpValues;
+			vector.lpValues = nullptr;
+
+			size            = vector.size;
+			vector.size     = 0;
+
+			capacity        = vector.capacity;
+			vector.capacity = 0;
+		}
+
+		Void Release(Collections::Arena* lpArena)
+		{
+			__JSON_DOM_Utility::Free(
+				lpArena,
+				lpValues
+			);
+
+			lpValues = nullptr;
+			size     = 0;
+			capacity = 0;
+		}
+
+		Iterator      begin()
+		{
+			return lpValues;
+		}
+		ConstIterator begin() const
+		{
+			return lpValues;
+		}
+
+		Iterator      end()
+		{
+			return &lpValues[size];
+		}
+		ConstIterator end() const
+		{
+			return &lpValues[size];
+		}
+
+		T&       operator [] (size_t index)
+		{
+			return lpValues[index];
+		}
+		const T& operator [] (size_t index) const
+		{
+			return lpValues[index];
+		}
+
+		__JSON_DOM_Vector& operator = (const __JSON_DOM_Vector&) = delete;
+	};
+
+	class JSONValue
+		: public IJSON
+	{
+		static constexpr const WString::Char REGEX_PATTERN_NULL[]    = L"";
+		static constexpr const WString::Char REGEX_PATTERN_NUMBER[]  = L"";
+		static constexpr const WString::Char REGEX_PATTERN_STRING[]  = L"";
+		static constexpr const WString::Char REGEX_PATTERN_BOOLEAN[] = L"";
+		static constexpr const WString::Char REGEX_PATTERN_DECIMAL[] = L"";
+		static constexpr const WString::Char REGEX_PATTERN_INTEGER[] = L"";
+
+		// strings are allocated here, or on the heap if nullptr
+		Collections::Arena* lpArena = nullptr;
+
+		Bool isNull    = False;
+		Bool isNumber  = False;
+		Bool isString  = False;
+		Bool isBoolean = False;
+		Bool isDecimal = False;
+		Bool isInteger = False;
+
+		struct
+		{
+			char*  lpString     = nullptr;
+			size_t StringLength = 0;
+
+			union
+			{
+				Bool   Boolean;
+				Double Decimal;
+				int64  Integer;
+			};
+		} value;
+
+		friend __JSON_DOM_Utility;
+
+		template<typename T_OUTPUT>
+		friend class JSONWriter;
+
+	public:
+		// @throw AL::Exception
+		static Void FromString(JSONValue& value, const String& string);
+		// @throw AL::Exception
+		static Void FromString(JSONValue& value, const WString& wstring)
+		{
+			FromString(
+				value,
+				wstring.ToString()
+			);
+		}
+
+		JSONValue()
+			: isNull(
+				True
+			)
+		{
+		}
+
+		JSONValue(Bool value)
+			: isBoolean(
+				true
+			),
+			value{
+				.Boolean = value
+			}
+		{
+		}
+		JSONValue(int8 value)
+			: isNumber(
+				True
+			),
+			isInteger(
+				True
+			),
+			value{
+				.Integer = value
+			}
+		{
+		}
+		JSONValue(int16 value)
+			: isNumber(
+				True
+			),
+			isInteger(
+				True
+			),
+			value{
+				.Integer = value
+			}
+		{
+		}
+		JSONValue(int32 value)
+			: isNumber(
+				True
+			),
+			isInteger(
+				True
+			),
+			value{
+				.Integer = value
+			}
+		{
+		}
+		JSONValue(int64 value)
+			: isNumber(
+				True
+			),
+			isInteger(
+				True
+			),
+			value{
+				.Integer = value
+			}
+		{
+		}
+		JSONValue(uint8 value)
+			: isNumber(
+				True
+			),
+			isInteger(
+				True
+			),
+			value{
+				.Integer = value
+			}
+		{
+		}
+		JSONValue(uint16 value)
+			: isNumber(
+				True
+			),
+			isInteger(
+				True
+			),
+			value{
+				.Integer = value
+			}
+		{
+		}
+		JSONValue(uint32 value)
+			: isNumber(
+				True
+			),
+			isInteger(
+				True
+			),
+			value{
+				.Integer = value
+			}
+		{
+		}
+		// @throw AL::Exception if value is larger than Integer<int64>::Maximum
+		JSONValue(uint64 value)
+			: isNumber(
+				True
+			),
 			isInteger(
 				True
 			),
-			value{
-				.Integer = value
+			value{
+				.Integer = static_cast<int64>(value)
+			}
+		{
+			if (value > static_cast<uint64>(Integer<int64>::Maximum))
+			{
+
+				throw Exception(
+					"%llu is out of range of a JSON integer",
+					static_cast<unsigned long long>(value)
+				);
+			}
+		}
+		JSONValue(Float value)
+			: isNumber(
+				True
+			),
+			isDecimal(
+				True
+			),
+			value{
+				.Decimal = value
+			}
+		{
+		}
+		JSONValue(Double value)
+			: isNumber(
+				True
+			),
+			isDecimal(
+				True
+			),
+			value{
+				.Decimal = value
+			}
+		{
+		}
+		JSONValue(String&& value)
+			: JSONValue(
+				static_cast<const String&>(value)
+			)
+		{
+		}
+		JSONValue(const String& value)
+			: isString(
+				true
+			)
+		{
+			this->value.lpString     = __JSON_DOM_Utility::CreateString(nullptr, value.GetCString(), value.GetLength());
+			this->value.StringLength = value.GetLength();
+		}
+
+		JSONValue(JSONValue&& value)
+			: JSONValue(
+				nullptr,
+				Move(value)
+			)
+		{
+		}
+		JSONValue(const JSONValue& value)
+			: JSONValue(
+				nullptr,
+				value
+			)
+		{
+		}
+
+		virtual ~JSONValue()
+		{
+			Clear();
+		}
+
+		virtual Bool IsNull() const
+		{
+			return isNull;
+		}
+
+		virtual Bool IsArray() const override
+		{
+			return False;
+		}
+
+		virtual Bool IsValue() const override
+		{
+			return True;
+		}
+
+		virtual Bool IsNumber() const
+		{
+			return isNumber;
+		}
+
+		virtual Bool IsObject() const override
+		{
+			return False;
+		}
+
+		virtual Bool IsString() const
+		{
+			return isString;
+		}
+
+		virtual Bool IsBoolean() const
+		{
+			return isBoolean;
+		}
+
+		virtual Bool IsDecimal() const
+		{
+			return isDecimal;
+		}
+
+		virtual Bool IsInteger() const
+		{
+			return isInteger;
+		}
+
+		virtual String GetString() const
+		{
+			AL_ASSERT(
+				IsString(),
+				"JSONValue is not a string"
+			);
+
+			return String(
+				value.lpString,
+				value.StringLength
+			);
+		}
+
+		virtual Bool GetBoolean() const
+		{
+			AL_ASSERT(
+				IsBoolean(),
+				"JSONValue is not a boolean"
+			);
+
+			return value.Boolean;
+		}
+
+		virtual Double GetDecimal() const
+		{
+			AL_ASSERT(
+				IsDecimal(),
+				"JSONValue is not a decimal"
+			);
+
+			return value.Decimal;
+		}
+
+		virtual int64 GetInteger() const
+		{
+			AL_ASSERT(
+				IsInteger(),
+				"JSONValue is not an integer"
+			);
+
+			return value.Integer;
+		}
+
+		JSONValue& operator = (JSONValue&& value)
+		{
+			if (this != &value)
+			{
+				Clear();
+
+				Assign(
+					Move(value)
+				);
+			}
+
+			return *this;
+		}
+		JSONValue& operator = (const JSONValue& value)
+		{
+			if (this != &value)
+			{
+				Clear();
+
+				Assign(
+					value
+				);
+			}
+
+			return *this;
+		}
+
+		Bool operator == (const JSONValue& value) const
+		{
+			if ((IsNull() != value.IsNull()) || (IsDecimal() != value.IsDecimal()) || (IsInteger() != value.IsInteger()) || (IsString() != value.IsString()) || (IsBoolean() != value.IsBoolean()))
+			{
+
+				return False;
+			}
+
+			if (IsNull())
+				return True;
+			else if (IsNumber())
+			{
+				if (IsDecimal())
+					return GetDecimal() == value.GetDecimal();
+				else if (IsInteger())
+					return GetInteger() == value.GetInteger();
+			}
+			else if (IsString())
+				return StringView(this->value.lpString, this->value.StringLength) == StringView(value.value.lpString, value.value.StringLength);
+			else if (IsBoolean())
+				return GetBoolean() == value.GetBoolean();
+
+			return False;
+		}
+		Bool operator != (const JSONValue& value) const
+		{
+			if (operator==(value))
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+
+	private:
+		explicit JSONValue(Collections::Arena* lpArena)
+			: lpArena(
+				lpArena
+			),
+			isNull(
+				True
+			)
+		{
+		}
+		JSONValue(Collections::Arena* lpArena, const StringView& value)
+			: lpArena(
+				lpArena
+			),
+			isString(
+				True
+			)
+		{
+			this->value.lpString     = __JSON_DOM_Utility::CreateString(lpArena, value.GetBuffer(), value.GetLength());
+			this->value.StringLength = value.GetLength();
+		}
+		JSONValue(Collections::Arena* lpArena, JSONValue&& value)
+			: lpArena(
+				lpArena
+			)
+		{
+			Assign(
+				Move(value)
+			);
+		}
+		JSONValue(Collections::Arena* lpArena, const JSONValue& value)
+			: lpArena(
+				lpArena
+			)
+		{
+			Assign(
+				value
+			);
+		}
+
+		// Releases the string and becomes null
+		Void Clear()
+		{
+			if (isString)
+			{
+				__JSON_DOM_Utility::Free(
+					lpArena,
+					value.lpString
+				);
+
+				value.lpString     = nullptr;
+				value.StringLength = 0;
+			}
+
+			isNull    = True;
+			isNumber  = False;
+			isString  = False;
+			isBoolean = False;
+			isDecimal = False;
+			isInteger = False;
+		}
+
+		// Must be null
+		Void Assign(JSONValue&& value)
+		{
+			// the string is copied unless both are allocated the same way
+			if (value.isString && (lpArena != value.lpArena))
+			{
+				Assign(
+					static_cast<const JSONValue&>(value)
+				);
+			}
+			else
+			{
+				AssignFlags(
+					value
+				);
+
+				this->value.lpString     = value.value.lpString;
+				this->value.StringLength = value.value.StringLength;
+
+				value.value.lpString     = nullptr;
+				value.value.StringLength = 0;
+				value.isString           = False;
+			}
+
+			value.Clear();
+		}
+		// Must be null
+		Void Assign(const JSONValue& value)
+		{
+			AssignFlags(
+				value
+			);
+
+			if (isString)
+			{
+				this->value.lpString     = __JSON_DOM_Utility::CreateString(lpArena, value.value.lpString, value.value.StringLength);
+				this->value.StringLength = value.value.StringLength;
+			}
+		}
+
+		Void AssignFlags(const JSONValue& value)
+		{
+			isNull    = value.isNull;
+			isNumber  = value.isNumber;
+			isString  = value.isString;
+			isBoolean = value.isBoolean;
+			isDecimal = value.isDecimal;
+			isInteger = value.isInteger;
+
+			if (isBoolean)
+				this->value.Boolean = value.value.Boolean;
+			else if (isDecimal)
+				this->value.Decimal = value.value.Decimal;
+			else if (isInteger)
+				this->value.Integer = value.value.Integer;
+		}
+	};
+
+	class JSONArray
+		: public IJSON
+	{
+		// values are allocated here, or on the heap if nullptr
+		Collections::Arena*       lpArena      = nullptr;
+		Bool                      isArenaOwner = False;
+
+		__JSON_DOM_Vector<IJSON*> values;
+
+		friend __JSON_DOM_Utility;
+		friend __JSON_DOM_Handler;
+
+		template<typename T_OUTPUT>
+		friend class JSONWriter;
+
+	public:
+		// @throw AL::Exception
+		static Void FromString(JSONArray& array, const String& string);
+		// @throw AL::Exception
+		static Void FromString(JSONArray& array, const WString& wstring)
+		{
+			FromString(
+				array,
+				wstring.ToString()
+			);
+		}
+
+		JSONArray()
+		{
+		}
+
+		JSONArray(JSONArray&& array)
+			: JSONArray(
+				nullptr,
+				Move(array)
+			)
+		{
+		}
+		JSONArray(const JSONArray& array)
+			: JSONArray(
+				nullptr,
+				array
+			)
+		{
+		}
+
+		virtual ~JSONArray()
+		{
+			Clear();
+		}
+
+		virtual Bool IsArray() const override
+		{
+			return True;
+		}
+
+		virtual Bool IsValue() const override
+		{
+			return False;
+		}
+
+		virtual Bool IsObject() const override
+		{
+			return False;
+		}
+
+		virtual size_t GetSize() const
+		{
+			return values.GetSize();
+		}
+
+		virtual size_t GetCapacity() const
+		{
+			return values.GetCapacity();
+		}
+
+		Void Clear()
+		{
+			for (auto lpValue : values)
+			{
+				__JSON_DOM_Utility::Destroy(
+					lpArena,
+					lpValue
+				);
+			}
+
+			values.Release(
+				lpArena
+			);
+
+			if (isArenaOwner)
+			{
+				delete lpArena;
+
+				lpArena      = nullptr;
+				isArenaOwner = False;
+			}
+		}
+
+		Void Add(JSONArray&& array)
+		{
+			values.PushBack(
+				lpArena,
+				__JSON_DOM_Utility::Create<JSONArray>(lpArena, Move(array))
+			);
+		}
+		Void Add(JSONValue&& value)
+		{
+			values.PushBack(
+				lpArena,
+				__JSON_DOM_Utility::Create<JSONValue>(lpArena, Move(value))
+			);
+		}
+		Void Add(JSONObject&& object);
+
+		Void Remove(size_t index)
+		{
+			if (index < values.GetSize())
+			{
+				__JSON_DOM_Utility::Destroy(
+					lpArena,
+					values[index]
+				);
+
+				values.Erase(
+					index
+				);
+			}
+		}
+		Void Remove(const IJSON& json)
+		{
+			for (size_t i = 0; i < values.GetSize(); ++i)
+			{
+				if (values[i] == &json)
+				{
+					Remove(
+						i
+					);
+
+					break;
+				}
+			}
+		}
+
+		Bool Get(IJSON*& lpJSON, size_t index)
+		{
+			if (index >= values.GetSize())
+			{
+
+				return False;
+			}
+
+			lpJSON = values[index];
+
+			return True;
+		}
+		Bool Get(JSONArray*& lpArray, size_t index)
+		{
+			if (!Get(reinterpret_cast<IJSON*&>(lpArray), index))
+			{
+
+				return False;
+			}
+
+			if (!lpArray->IsArray())
+			{
+
+				return False;
+			}
+
+			return True;
+		}
+		Bool Get(JSONValue*& lpValue, size_t index)
+		{
+			if (!Get(reinterpret_cast<IJSON*&>(lpValue), index))
+			{
+
+				return False;
+			}
+
+			if (!lpValue->IsValue())
+			{
+
+				return False;
 			}
-		{
+
+			return True;
 		}
-		JSONValue(uint32 value)
-			: isNumber(
-				True
-			),
-			isInteger(
-				True
-			),
-			value{
-				.Integer = value
+		Bool Get(JSONObject*& lpObject, size_t index);
+
+		JSONArray& operator = (JSONArray&& array)
+		{
+			if (this != &array)
+			{
+				Clear();
+
+				Assign(
+					Move(array)
+				);
 			}
+
+			return *this;
+		}
+		JSONArray& operator = (const JSONArray& array)
 		{
+			if (this != &array)
+			{
+				Clear();
+
+				Assign(
+					array
+				);
+			}
+
+			return *this;
 		}
-		JSONValue(uint64 value)
-			: isNumber(
-				True
-			),
-			isInteger(
-				True
-			),
-			value{
-				.Integer = static_cast<int64>(value)
+
+		Bool operator == (const JSONArray& array) const;
+		Bool operator != (const JSONArray& array) const
+		{
+			if (operator==(array))
+			{
+
+				return False;
 			}
+
+			return True;
+		}
+
+	private:
+		explicit JSONArray(Collections::Arena* lpArena)
+			: lpArena(
+				lpArena
+			)
 		{
 		}
-		JSONValue(Float value)
-			: isNumber(
-				True
-			),
-			isDecimal(
-				True
-			),
-			value{
-				.Decimal = value
-			}
+		JSONArray(Collections::Arena* lpArena, JSONArray&& array)
+			: lpArena(
+				lpArena
+			)
 		{
+			Assign(
+				Move(array)
+			);
 		}
-		JSONValue(Double value)
-			: isNumber(
-				True
-			),
-			isDecimal(
-				True
-			),
-			value{
-				.Decimal = value
-			}
+		JSONArray(Collections::Arena* lpArena, const JSONArray& array)
+			: lpArena(
+				lpArena
+			)
 		{
+			Assign(
+				array
+			);
 		}
-		JSONValue(String&& value)
-			: isString(
-				true
-			),
-			value{
-				.String = Move(value)
-			}
+
+		// Must be empty
+		Void Assign(JSONArray&& array)
 		{
+			// values are taken if they are allocated the same way or array owns their arena
+			if (lpArena == array.lpArena)
+			{
+				values.Take(
+					array.values
+				);
+			}
+			else if ((lpArena == nullptr) && array.isArenaOwner)
+			{
+				values.Take(
+					array.values
+				);
+
+				lpArena            = array.lpArena;
+				isArenaOwner       = True;
+
+				array.lpArena      = nullptr;
+				array.isArenaOwner = False;
+			}
+			else
+			{
+				Assign(
+					static_cast<const JSONArray&>(array)
+				);
+			}
+
+			array.Clear();
 		}
-		JSONValue(const String& value)
-			: isString(
-				true
-			),
-			value{
-				.String = value
+		// Must be empty
+		Void Assign(const JSONArray& array)
+		{
+			values.SetCapacity(
+				lpArena,
+				array.values.GetSize()
+			);
+
+			for (auto lpValue : array.values)
+			{
+				values.PushBack(
+					lpArena,
+					__JSON_DOM_Utility::Copy(lpArena, *lpValue)
+				);
 			}
+		}
+	};
+
+	class JSONObject
+		: public IJSON
+	{
+		// objects with at least this many members are indexed on the first lookup by name
+		static constexpr size_t INDEX_THRESHOLD = 8;
+
+		static constexpr const WString::Char REGEX_PATTERN_ARRAY[]  = L"";
+		static constexpr const WString::Char REGEX_PATTERN_VALUE[]  = L"";
+		static constexpr const WString::Char REGEX_PATTERN_OBJECT[] = L"";
+
+		struct Member
+		{
+			StringView Name;
+			IJSON*     lpValue;
+		};
+
+		// members are allocated here, or on the heap if nullptr
+		Collections::Arena*       lpArena      = nullptr;
+		Bool                      isArenaOwner = False;
+
+		__JSON_DOM_Vector<Member> members;
+
+		// open addressing table of member index + 1, 0 if empty
+		uint32*                   lpIndex       = nullptr;
+		size_t                    indexCapacity = 0;
+
+		friend __JSON_DOM_Utility;
+		friend __JSON_DOM_Handler;
+
+		template<typename T_OUTPUT>
+		friend class JSONWriter;
+
+	public:
+		// @throw AL::Exception
+		static Void FromString(JSONObject& object, const String& string);
+		// @throw AL::Exception
+		static Void FromString(JSONObject& object, const WString& wstring)
 		{
+			FromString(
+				object,
+				wstring.ToString()
+			);
 		}
 
-		JSONValue(JSONValue&& value)
-			: isNull(
-				value.isNull
-			),
-			isNumber(
-				value.isNumber
-			),
-			isString(
-				value.isString
-			),
-			isBoolean(
-				value.isBoolean
-			),
-			isDecimal(
-				value.isDecimal
-			),
-			isInteger(
-				value.isInteger
-			),
-			value(
-				Move(value.value)
+		JSONObject()
+		{
+		}
+
+		JSONObject(JSONObject&& object)
+			: JSONObject(
+				nullptr,
+				Move(object)
 			)
 		{
-			value.isNull    = True;
-			value.isNumber  = False;
-			value.isString  = False;
-			value.isBoolean = False;
-			value.isDecimal = False;
-			value.isInteger = False;
 		}
-		JSONValue(const JSONValue& value)
-			: isNull(
-				value.isNull
-			),
-			isNumber(
-				value.isNumber
-			),
-			isString(
-				value.isString
-			),
-			isBoolean(
-				value.isBoolean
-			),
-			isDecimal(
-				value.isDecimal
-			),
-			isInteger(
-				value.isInteger
-			),
-			value(
-				value.value
+		JSONObject(const JSONObject& object)
+			: JSONObject(
+				nullptr,
+				object
 			)
 		{
 		}
 
-		virtual ~JSONValue()
+		virtual ~JSONObject()
 		{
+			Clear();
 		}
 
-		virtual Bool IsNull() const
+		virtual Bool IsArray() const override
 		{
-			return isNull;
+			return False;
+		}
+
+		virtual Bool IsValue() const override
+		{
+			return False;
+		}
+
+		virtual Bool IsObject() const override
+		{
+			return True;
+		}
+
+		virtual size_t GetSize() const
+		{
+			return members.GetSize();
+		}
+
+		virtual size_t GetCapacity() const
+		{
+			return members.GetCapacity();
+		}
+
+		Void Clear()
+		{
+			ReleaseIndex();
+
+			for (auto& member : members)
+			{
+				ReleaseMember(
+					member
+				);
+			}
+
+			members.Release(
+				lpArena
+			);
+
+			if (isArenaOwner)
+			{
+				delete lpArena;
+
+				lpArena      = nullptr;
+				isArenaOwner = False;
+			}
+		}
+
+		Void Add(String&& name, JSONArray&& array)
+		{
+			Add(
+				name,
+				__JSON_DOM_Utility::Create<JSONArray>(lpArena, Move(array))
+			);
+		}
+		Void Add(WString&& name, JSONArray&& array)
+		{
+			Add(
+				name.ToString(),
+				Move(array)
+			);
+		}
+		Void Add(String&& name, JSONValue&& value)
+		{
+			Add(
+				name,
+				__JSON_DOM_Utility::Create<JSONValue>(lpArena, Move(value))
+			);
+		}
+		Void Add(WString&& name, JSONValue&& value)
+		{
+			Add(
+				name.ToString(),
+				Move(value)
+			);
+		}
+		Void Add(String&& name, JSONObject&& object)
+		{
+			Add(
+				name,
+				__JSON_DOM_Utility::Create<JSONObject>(lpArena, Move(object))
+			);
+		}
+		Void Add(WString&& name, JSONObject&& object)
+		{
+			Add(
+				name.ToString(),
+				Move(object)
+			);
+		}
+
+		Void Remove(const IJSON& json)
+		{
+			for (size_t i = 0; i < members.GetSize(); ++i)
+			{
+				if (members[i].lpValue == &json)
+				{
+					Remove(
+						i
+					);
+
+					break;
+				}
+			}
+		}
+		Void Remove(const String& name)
+		{
+			auto index = FindMember(
+				name
+			);
+
+			if (index != StringView::NPOS)
+			{
+				Remove(
+					index
+				);
+			}
 		}
-
-		virtual Bool IsArray() const override
+		Void Remove(const WString& name)
 		{
-			return False;
+			Remove(
+				name.ToString()
+			);
 		}
 
-		virtual Bool IsValue() const override
+		Bool Get(String& name, IJSON*& lpJSON, size_t index)
 		{
+			if (index >= members.GetSize())
+			{
+
+				return False;
+			}
+
+			name   = members[index].Name.ToString();
+			lpJSON = members[index].lpValue;
+
 			return True;
 		}
-
-		virtual Bool IsNumber() const
+		Bool Get(WString& name, IJSON*& lpJSON, size_t index)
 		{
-			return isNumber;
-		}
+			String string;
 
-		virtual Bool IsObject() const override
-		{
-			return False;
-		}
+			if (!Get(string, lpJSON, index))
+			{
 
-		virtual Bool IsString() const
-		{
-			return isString;
-		}
+				return False;
+			}
 
-		virtual Bool IsBoolean() const
-		{
-			return isBoolean;
-		}
+			name = string.ToWString();
 
-		virtual Bool IsDecimal() const
-		{
-			return isDecimal;
+			return True;
 		}
-
-		virtual Bool IsInteger() const
+		Bool Get(String& name, JSONArray*& lpArray, size_t index)
 		{
-			return isInteger;
-		}
+			if (!Get(name, reinterpret_cast<IJSON*&>(lpArray), index))
+			{
 
-		virtual String GetString() const
-		{
-			AL_ASSERT(
-				IsString(),
-				"JSONValue is not a string"
-			);
+				return False;
+			}
 
-			return value.String;
-		}
+			if (!lpArray->IsArray())
+			{
 
-		virtual Bool GetBoolean() const
-		{
-			AL_ASSERT(
-				IsBoolean(),
-				"JSONValue is not a boolean"
-			);
+				return False;
+			}
 
-			return value.Boolean;
+			return True;
 		}
-
-		virtual Double GetDecimal() const
+		Bool Get(WString& name, JSONArray*& lpArray, size_t index)
 		{
-			AL_ASSERT(
-				IsBoolean(),
-				"JSONValue is not a decimal"
-			);
+			if (!Get(name, reinterpret_cast<IJSON*&>(lpArray), index))
+			{
 
-			return value.Decimal;
-		}
+				return False;
+			}
 
-		virtual int64 GetInteger() const
-		{
-			AL_ASSERT(
-				IsBoolean(),
-				"JSONValue is not an integer"
-			);
+			if (!lpArray->IsArray())
+			{
 
-			return value.Integer;
-		}
+				return False;
+			}
 
-		virtual WString ToWString() const override
+			return True;
+		}
+		Bool Get(String& name, JSONValue*& lpValue, size_t index)
 		{
-			WStringBuilder sb;
-
-			if (IsNull())
-				sb.Append(L"null");
-			else if (IsNumber())
+			if (!Get(name, reinterpret_cast<IJSON*&>(lpValue), index))
 			{
-				if (IsDecimal())
-					sb.Append(GetDecimal());
-				else if (IsInteger())
-					sb.Append(GetInteger());
+
+				return False;
 			}
-			else if (IsString())
+
+			if (!lpValue->IsValue())
 			{
-				sb.Append(L'"');
-				sb.Append(Encode(GetString()));
-				sb.Append(L'"');
+
+				return False;
 			}
-			else if (IsBoolean())
-				sb.Append(GetBoolean());
 
-			return sb.ToString();
+			return True;
 		}
-
-		JSONValue& operator = (JSONValue&& value)
+		Bool Get(WString& name, JSONValue*& lpValue, size_t index)
 		{
-			isNull = value.isNull;
-			value.isNull = True;
+			if (!Get(name, reinterpret_cast<IJSON*&>(lpValue), index))
+			{
 
-			isNumber = value.isNumber;
-			value.isNumber = False;
+				return False;
+			}
 
-			isString = value.isString;
-			value.isString = False;
+			if (!lpValue->IsValue())
+			{
 
-			isBoolean = value.isBoolean;
-			value.isBoolean = False;
+				return False;
+			}
 
-			isDecimal = value.isDecimal;
-			value.isDecimal = False;
+			return True;
+		}
+		Bool Get(String& name, JSONObject*& lpObject, size_t index)
+		{
+			if (!Get(name, reinterpret_cast<IJSON*&>(lpObject), index))
+			{
 
-			isInteger = value.isInteger;
-			value.isInteger = False;
+				return False;
+			}
 
-			this->value = Move(
-				value.value
-			);
+			if (!lpObject->IsObject())
+			{
 
-			return *this;
+				return False;
+			}
+
+			return True;
 		}
-		JSONValue& operator = (const JSONValue& value)
+		Bool Get(WString& name, JSONObject*& lpObject, size_t index)
 		{
-			isNull      = value.isNull;
-			isNumber    = value.isNumber;
-			isString    = value.isString;
-			isBoolean   = value.isBoolean;
-			isDecimal   = value.isDecimal;
-			isInteger   = value.isInteger;
-			this->value = value.value;
+			if (!Get(name, reinterpret_cast<IJSON*&>(lpObject), index))
+			{
 
-			return *this;
+				return False;
+			}
+
+			if (!lpObject->IsObject())
+			{
+
+				return False;
+			}
+
+			return True;
 		}
 
-		Bool operator == (const JSONValue& value) const
+		Bool GetMemberByName(IJSON*& lpJSON, const String& name)
 		{
-			if (IsNumber())
+			auto index = FindMember(
+				name
+			);
+
+			if (index == StringView::NPOS)
 			{
-				if (IsDecimal())
-					return GetDecimal() == value.GetDecimal();
-				else if (IsInteger())
-					return GetInteger() == value.GetInteger();
+
+				return False;
 			}
-			else if (IsString())
-				return GetString() == value.GetString();
-			else if (IsBoolean())
-				return GetBoolean() == value.GetBoolean();
 
-			return False;
+			lpJSON = members[index].lpValue;
+
+			return True;
 		}
-		Bool operator != (const JSONValue& value) const
+		Bool GetMemberByName(IJSON*& lpJSON, const WString& name)
 		{
-			if (operator==(value))
+			if (!GetMemberByName(lpJSON, name.ToString()))
 			{
 
 				return False;
@@ -573,185 +2633,122 @@ namespace AL::Serialization
 
 			return True;
 		}
-	};
+		Bool GetMemberByName(JSONArray*& lpArray, const String& name)
+		{
+			if (!GetMemberByName(reinterpret_cast<IJSON*&>(lpArray), name))
+			{
 
-	class JSONArray
-		: public IJSON
-	{
-		static constexpr const WString::Char REGEX_PATTERN_ARRAY[]  = L"";
-		static constexpr const WString::Char REGEX_PATTERN_VALUE[]  = L"";
-		static constexpr const WString::Char REGEX_PATTERN_OBJECT[] = L"";
+				return False;
+			}
 
-		Collections::LinkedList<IJSON*> values;
+			if (!lpArray->IsArray())
+			{
 
-	public:
-		// @throw AL::Exception
-		static Void FromString(JSONArray& array, const String& string)
-		{
-			auto wstring = string.ToWString();
+				return False;
+			}
 
-			FromString(
-				array,
-				wstring
-			);
+			return True;
 		}
-		// @throw AL::Exception
-		static Void FromString(JSONArray& array, const WString& wstring)
+		Bool GetMemberByName(JSONArray*& lpArray, const WString& name)
 		{
-			// TODO: implement
-			throw NotImplementedException();
-		}
+			if (!GetMemberByName(lpArray, name.ToString()))
+			{
 
-		JSONArray()
-		{
-		}
+				return False;
+			}
 
-		JSONArray(JSONArray&& array)
-			: values(
-				Move(array.values)
-			)
-		{
+			return True;
 		}
-		JSONArray(const JSONArray& array);
-
-		virtual ~JSONArray()
+		Bool GetMemberByName(JSONValue*& lpValue, const String& name)
 		{
-			Clear();
-		}
+			if (!GetMemberByName(reinterpret_cast<IJSON*&>(lpValue), name))
+			{
 
-		virtual Bool IsArray() const override
-		{
-			return True;
-		}
+				return False;
+			}
 
-		virtual Bool IsValue() const override
-		{
-			return False;
-		}
+			if (!lpValue->IsValue())
+			{
 
-		virtual Bool IsObject() const override
-		{
-			return False;
-		}
+				return False;
+			}
 
-		virtual size_t GetSize() const
-		{
-			return values.GetSize();
+			return True;
 		}
-
-		virtual size_t GetCapacity() const
+		Bool GetMemberByName(JSONValue*& lpValue, const WString& name)
 		{
-			return values.GetCapacity();
-		}
+			if (!GetMemberByName(lpValue, name.ToString()))
+			{
+
+				return False;
+			}
 
-		virtual WString ToWString() const override
+			return True;
+		}
+		Bool GetMemberByName(JSONObject*& lpObject, const String& name)
 		{
-			size_t         i = 0;
-			WStringBuilder sb;
+			if (!GetMemberByName(reinterpret_cast<IJSON*&>(lpObject), name))
+			{
 
-			sb.Append(L'[');
+				return False;
+			}
 
-			for (auto lpValue : values)
+			if (!lpObject->IsObject())
 			{
-				if (i++ != 0)
-					sb.Append(L',');
 
-				sb.Append(
-					lpValue->ToWString()
-				);
+				return False;
 			}
 
-			sb.Append(L']');
-
-			return sb.ToString();
+			return True;
 		}
-
-		Void Clear()
+		Bool GetMemberByName(JSONObject*& lpObject, const WString& name)
 		{
-			for (auto it = values.begin(); it != values.end(); )
+			if (!GetMemberByName(lpObject, name.ToString()))
 			{
-				delete *it;
 
-				values.Erase(
-					it++
-				);
+				return False;
 			}
-		}
 
-		Void Add(JSONArray&& array)
-		{
-			values.PushBack(new JSONArray(Move(array)));
-		}
-		Void Add(JSONValue&& value)
-		{
-			values.PushBack(new JSONValue(Move(value)));
+			return True;
 		}
-		Void Add(JSONObject&& object);
 
-		Void Remove(size_t index)
+		Bool GetMemberByIndex(IJSON*& lpJSON, size_t index)
 		{
-			size_t i = 0;
-
-			for (auto it = values.begin(); it != values.end(); )
+			if (index >= members.GetSize())
 			{
-				if (i++ == index)
-				{
-					delete *it;
 
-					values.Erase(
-						it
-					);
+				return False;
+			}
 
-					break;
-				}
+			lpJSON = members[index].lpValue;
 
-				++it;
-			}
+			return True;
 		}
-		Void Remove(const IJSON& json)
+		Bool GetMemberByIndex(JSONArray*& lpArray, size_t index)
 		{
-			for (auto it = values.begin(); it != values.end(); )
+			if (!GetMemberByIndex(reinterpret_cast<IJSON*&>(lpArray), index))
 			{
-				if (*it == &json)
-				{
-					delete *it;
-
-					values.Erase(
-						it
-					);
-
-					break;
-				}
 
-				++it;
+				return False;
 			}
-		}
 
-		Bool Get(IJSON*& lpJSON, size_t index)
-		{
-			size_t i = 0;
-
-			for (auto lpValue : values)
+			if (!lpArray->IsArray())
 			{
-				if (i++ == index)
-				{
-					lpJSON = lpValue;
 
-					return True;
-				}
+				return False;
 			}
 
-			return False;
+			return True;
 		}
-		Bool Get(JSONArray*& lpArray, size_t index)
+		Bool GetMemberByIndex(JSONValue*& lpValue, size_t index)
 		{
-			if (!Get(reinterpret_cast<IJSON*&>(lpArray), index))
+			if (!GetMemberByIndex(reinterpret_cast<IJSON*&>(lpValue), index))
 			{
 
 				return False;
 			}
 
-			if (!lpArray->IsArray())
+			if (!lpValue->IsValue())
 			{
 
 				return False;
@@ -759,15 +2756,15 @@ namespace AL::Serialization
 
 			return True;
 		}
-		Bool Get(JSONValue*& lpValue, size_t index)
+		Bool GetMemberByIndex(JSONObject*& lpObject, size_t index)
 		{
-			if (!Get(reinterpret_cast<IJSON*&>(lpValue), index))
+			if (!GetMemberByIndex(reinterpret_cast<IJSON*&>(lpObject), index))
 			{
 
 				return False;
 			}
 
-			if (!lpValue->IsValue())
+			if (!lpObject->IsObject())
 			{
 
 				return False;
@@ -775,697 +2772,1208 @@ namespace AL::Serialization
 
 			return True;
 		}
-		Bool Get(JSONObject*& lpObject, size_t index);
 
-		JSONArray& operator = (JSONArray&& array)
+		JSONObject& operator = (JSONObject&& object)
 		{
-			values = Move(
-				array.values
-			);
+			if (this != &object)
+			{
+				Clear();
+
+				Assign(
+					Move(object)
+				);
+			}
 
 			return *this;
 		}
-		JSONArray& operator = (const JSONArray& array);
+		JSONObject& operator = (const JSONObject& object)
+		{
+			if (this != &object)
+			{
+				Clear();
 
-		Bool operator == (const JSONArray& array) const;
-		Bool operator != (const JSONArray& array) const
+				Assign(
+					object
+				);
+			}
+
+			return *this;
+		}
+
+		Bool operator == (const JSONObject& object) const
 		{
-			if (operator==(array))
+			if (GetSize() != object.GetSize())
 			{
 
 				return False;
 			}
 
-			return True;
-		}
-	};
+			for (size_t i = 0; i < members.GetSize(); ++i)
+			{
+				auto& member1 = members[i];
+				auto& member2 = object.members[i];
 
-	class JSONObject
-		: public IJSON
-	{
-		static constexpr const WString::Char REGEX_PATTERN_ARRAY[]  = L"";
-		static constexpr const WString::Char REGEX_PATTERN_VALUE[]  = L"";
-		static constexpr const WString::Char REGEX_PATTERN_OBJECT[] = L"";
+				if (member1.Name != member2.Name)
+				{
 
-		struct Member
-		{
-			WString Name;
-			IJSON*  lpValue;
-		};
+					return False;
+				}
 
-		Collections::LinkedList<Member> members;
+				auto lpJSON1 = member1.lpValue;
+				auto lpJSON2 = member2.lpValue;
 
-	public:
-		// @throw AL::Exception
-		static Void FromString(JSONObject& object, const String& string)
-		{
-			auto wstring = string.ToWString();
+				if (lpJSON1->IsArray() && lpJSON2->IsArray())
+				{
+					if (*reinterpret_cast<const JSONArray*>(lpJSON1) != *reinterpret_cast<const JSONArray*>(lpJSON2))
+					{
 
-			FromString(
-				object,
-				wstring
-			);
+						return False;
+					}
+
+					continue;
+				}
+				else if (lpJSON1->IsValue() && lpJSON2->IsValue())
+				{
+					if (*reinterpret_cast<const JSONValue*>(lpJSON1) != *reinterpret_cast<const JSONValue*>(lpJSON2))
+					{
+
+						return False;
+					}
+
+					continue;
+				}
+				else if (lpJSON1->IsObject() && lpJSON2->IsObject())
+				{
+					if (*reinterpret_cast<const JSONObject*>(lpJSON1) != *reinterpret_cast<const JSONObject*>(lpJSON2))
+					{
+
+						return False;
+					}
+
+					continue;
+				}
+
+				return False;
+			}
+
+			return True;
 		}
-		// @throw AL::Exception
-		static Void FromString(JSONObject& object, const WString& wstring)
+		Bool operator != (const JSONObject& object) const
 		{
-			// TODO: implement
-			throw NotImplementedException();
+			if (operator==(object))
+			{
+
+				return False;
+			}
+
+			return True;
 		}
 
-		JSONObject()
+	private:
+		explicit JSONObject(Collections::Arena* lpArena)
+			: lpArena(
+				lpArena
+			)
 		{
 		}
-
-		JSONObject(JSONObject&& object)
-			: members(
-				Move(object.members)
+		JSONObject(Collections::Arena* lpArena, JSONObject&& object)
+			: lpArena(
+				lpArena
 			)
 		{
+			Assign(
+				Move(object)
+			);
 		}
-		JSONObject(const JSONObject& object)
+		JSONObject(Collections::Arena* lpArena, const JSONObject& object)
+			: lpArena(
+				lpArena
+			)
 		{
-			for (auto& member : object.members)
+			Assign(
+				object
+			);
+		}
+
+		// Must be empty
+		Void Assign(JSONObject&& object)
+		{
+			// members are taken if they are allocated the same way or object owns their arena
+			if ((lpArena == object.lpArena) || ((lpArena == nullptr) && object.isArenaOwner))
 			{
-				Member _member =
+				members.Take(
+					object.members
+				);
+
+				lpIndex              = object.lpIndex;
+				object.lpIndex       = nullptr;
+
+				indexCapacity        = object.indexCapacity;
+				object.indexCapacity = 0;
+
+				if (lpArena != object.lpArena)
 				{
-					.Name = member.Name
-				};
+					lpArena             = object.lpArena;
+					isArenaOwner        = True;
+
+					object.lpArena      = nullptr;
+					object.isArenaOwner = False;
+				}
+			}
+			else
+			{
+				Assign(
+					static_cast<const JSONObject&>(object)
+				);
+			}
 
-				if (member.lpValue->IsArray())
-					_member.lpValue = new JSONArray(*reinterpret_cast<const JSONArray*>(member.lpValue));
-				else if (member.lpValue->IsValue())
-					_member.lpValue = new JSONValue(*reinterpret_cast<const JSONValue*>(member.lpValue));
-				else if (member.lpValue->IsObject())
-					_member.lpValue = new JSONObject(*reinterpret_cast<const JSONObject*>(member.lpValue));
+			object.Clear();
+		}
+		// Must be empty
+		Void Assign(const JSONObject& object)
+		{
+			members.SetCapacity(
+				lpArena,
+				object.members.GetSize()
+			);
 
-				members.PushBack(
-					Move(_member)
+			for (auto& member : object.members)
+			{
+				Append(
+					StringView(__JSON_DOM_Utility::CreateString(lpArena, member.Name.GetBuffer(), member.Name.GetLength()), member.Name.GetLength()),
+					__JSON_DOM_Utility::Copy(lpArena, *member.lpValue)
 				);
 			}
 		}
 
-		virtual ~JSONObject()
+		// Replaces the value of the member with the same name
+		Void Add(const String& name, IJSON* lpJSON)
 		{
-			Clear();
+			auto index = FindMember(
+				name
+			);
+
+			if (index != StringView::NPOS)
+			{
+				__JSON_DOM_Utility::Destroy(
+					lpArena,
+					members[index].lpValue
+				);
+
+				members[index].lpValue = lpJSON;
+
+				return;
+			}
+
+			Append(
+				StringView(__JSON_DOM_Utility::CreateString(lpArena, name.GetCString(), name.GetLength()), name.GetLength()),
+				lpJSON
+			);
 		}
 
-		virtual Bool IsArray() const override
+		// Takes ownership of name and lpJSON without checking for a member with the same name
+		Void Append(const StringView& name, IJSON* lpJSON)
 		{
-			return False;
+			members.PushBack(
+				lpArena,
+				{
+					.Name    = name,
+					.lpValue = lpJSON
+				}
+			);
+
+			if (lpIndex != nullptr)
+			{
+				if ((members.GetSize() * 2) > indexCapacity)
+				{
+					ReleaseIndex();
+					CreateIndex();
+				}
+				else
+				{
+					InsertIndex(
+						members.GetSize() - 1
+					);
+				}
+			}
 		}
 
-		virtual Bool IsValue() const override
+		Void Remove(size_t index)
 		{
-			return False;
+			ReleaseIndex();
+
+			ReleaseMember(
+				members[index]
+			);
+
+			members.Erase(
+				index
+			);
 		}
 
-		virtual Bool IsObject() const override
+		Void ReleaseMember(Member& member)
 		{
-			return True;
+			__JSON_DOM_Utility::Free(
+				lpArena,
+				const_cast<char*>(member.Name.GetBuffer())
+			);
+
+			__JSON_DOM_Utility::Destroy(
+				lpArena,
+				member.lpValue
+			);
 		}
 
-		virtual size_t GetSize() const
+		// @return StringView::NPOS if not found
+		size_t FindMember(const StringView& name)
 		{
-			return members.GetSize();
+			if ((lpIndex == nullptr) && (members.GetSize() >= INDEX_THRESHOLD))
+			{
+				CreateIndex();
+			}
+
+			if (lpIndex != nullptr)
+			{
+				for (auto i = HashName(name); ; ++i)
+				{
+					auto index = lpIndex[i & (indexCapacity - 1)];
+
+					if (index == 0)
+					{
+
+						break;
+					}
+
+					if (members[index - 1].Name == name)
+					{
+
+						return index - 1;
+					}
+				}
+
+				return StringView::NPOS;
+			}
+
+			for (size_t i = 0; i < members.GetSize(); ++i)
+			{
+				if (members[i].Name == name)
+				{
+
+					return i;
+				}
+			}
+
+			return StringView::NPOS;
 		}
 
-		virtual size_t GetCapacity() const
-		{
-			return members.GetCapacity();
+		Void CreateIndex()
+		{
+			for (indexCapacity = 16; indexCapacity < (members.GetSize() * 4); )
+			{
+				indexCapacity *= 2;
+			}
+
+			lpIndex = static_cast<uint32*>(
+				__JSON_DOM_Utility::Allocate(lpArena, indexCapacity * sizeof(uint32))
+			);
+
+			memset(
+				lpIndex,
+				0,
+				indexCapacity * sizeof(uint32)
+			);
+
+			for (size_t i = 0; i < members.GetSize(); ++i)
+			{
+				InsertIndex(
+					i
+				);
+			}
 		}
 
-		virtual WString ToWString() const override
+		// The first member with a name is the one found
+		Void InsertIndex(size_t index)
 		{
-			size_t         i = 0;
-			WStringBuilder sb;
-
-			sb.Append(L'{');
+			auto& name = members[index].Name;
 
-			for (auto& member : members)
+			for (auto i = HashName(name); ; ++i)
 			{
-				if (i++ != 0)
-					sb.Append(L',');
+				auto& slot = lpIndex[i & (indexCapacity - 1)];
 
-				if (member.Name.GetLength() == 0)
-					sb.Append(member.lpValue->ToWString());
-				else
+				if (slot == 0)
 				{
-					sb.Append(L'"');
-					sb.Append(Encode(member.Name));
-					sb.Append(L"\":");
-					sb.Append(member.lpValue->ToWString());
+					slot = static_cast<uint32>(index + 1);
+
+					break;
 				}
-			}
 
-			sb.Append(L'}');
+				if (members[slot - 1].Name == name)
+				{
 
-			return sb.ToString();
+					break;
+				}
+			}
 		}
 
-		Void Clear()
+		Void ReleaseIndex()
 		{
-			for (auto it = members.begin(); it != members.end(); )
-			{
-				delete it->lpValue;
+			__JSON_DOM_Utility::Free(
+				lpArena,
+				lpIndex
+			);
 
-				members.Erase(
-					it++
-				);
-			}
+			lpIndex       = nullptr;
+			indexCapacity = 0;
 		}
 
-		Void Add(String&& name, JSONArray&& array)
+		static size_t HashName(const StringView& name)
 		{
-			Add(
-				name.ToWString(),
-				Move(array)
+			return Algorithms::FNV<uint32>::Calculate(
+				name.GetBuffer(),
+				name.GetLength()
 			);
 		}
-		Void Add(WString&& name, JSONArray&& array)
+	};
+
+
+	class JSON
+		: public JSONObject
+	{
+	public:
+		typedef JSONArray  Array;
+		typedef JSONValue  Value;
+		typedef JSONObject Object;
+
+		using JSONObject::JSONObject;
+	};
+
+	// Builds a DOM from JSONParser
+	// - Every node is allocated in the arena of the root, which is created if the root does not have one
+	// - Values are collected on a stack until their container ends so every container is allocated once at its final size
+	class __JSON_DOM_Handler
+	{
+		struct Frame
+		{
+			IJSON* lpContainer;
+			size_t Start;
+		};
+
+		struct Value
+		{
+			StringView Name;
+			IJSON*     lpValue;
+		};
+
+		IJSON*                        lpRoot;
+		Collections::Arena*           lpArena = nullptr;
+
+		Collections::ArrayList<Frame> frames;
+		Collections::ArrayList<Value> values;
+		StringView                    name;
+
+	public:
+		explicit __JSON_DOM_Handler(IJSON& root)
+			: lpRoot(
+				&root
+			)
 		{
-			Add(
-				{
-					.Name    = Move(name),
-					.lpValue = new JSONArray(Move(array))
-				}
-			);
 		}
-		Void Add(String&& name, JSONValue&& value)
+
+		// @throw AL::Exception
+		Bool OnNull()
 		{
-			Add(
-				name.ToWString(),
-				Move(value)
+			return Add(
+				JSONValue()
 			);
 		}
-		Void Add(WString&& name, JSONValue&& value)
+		// @throw AL::Exception
+		Bool OnBoolean(Bool value)
 		{
-			Add(
-				{
-					.Name    = Move(name),
-					.lpValue = new JSONValue(Move(value))
-				}
+			return Add(
+				JSONValue(value)
 			);
 		}
-		Void Add(String&& name, JSONObject&& object)
+		// @throw AL::Exception
+		Bool OnInteger(int64 value)
 		{
-			Add(
-				name.ToWString(),
-				Move(object)
+			return Add(
+				JSONValue(value)
 			);
 		}
-		Void Add(WString&& name, JSONObject&& object)
+		// @throw AL::Exception
+		Bool OnDecimal(Double value)
 		{
-			Add(
-				{
-					.Name    = Move(name),
-					.lpValue = new JSONObject(Move(object))
-				}
+			return Add(
+				JSONValue(value)
 			);
 		}
-
-		Void Remove(const IJSON& json)
+		// @throw AL::Exception
+		Bool OnString(const StringView& value)
 		{
-			for (auto it = members.begin(); it != members.end(); )
+			if (frames.GetSize() == 0)
 			{
-				if (it->lpValue == &json)
-				{
-					delete it->lpValue;
-
-					members.Erase(
-						it
-					);
-
-					break;
-				}
 
-				++it;
+				return Add(
+					JSONValue(value.ToString())
+				);
 			}
-		}
-		Void Remove(const String& name)
-		{
-			Remove(
-				name.ToWString()
+
+			Append(
+				__JSON_DOM_Utility::Create<JSONValue>(lpArena, value)
 			);
+
+			return True;
 		}
-		Void Remove(const WString& name)
+
+		// @throw AL::Exception
+		Bool OnArrayBegin()
 		{
-			for (auto it = members.begin(); it != members.end(); )
+			if (frames.GetSize() == 0)
 			{
-				if (it->Name == name)
+				if (!lpRoot->IsArray())
 				{
-					delete it->lpValue;
 
-					members.Erase(
-						it
+					throw Exception(
+						"JSON is an array but the root is not a JSONArray"
 					);
+				}
 
-					break;
+				auto lpArray = static_cast<JSONArray*>(
+					lpRoot
+				);
+
+				if (lpArray->lpArena == nullptr)
+				{
+					lpArray->lpArena      = new Collections::Arena();
+					lpArray->isArenaOwner = True;
 				}
 
-				++it;
+				lpArena = lpArray->lpArena;
+
+				Begin(
+					lpArray
+				);
 			}
-		}
+			else
+			{
+				auto lpArray = __JSON_DOM_Utility::Create<JSONArray>(
+					lpArena
+				);
 
-		Bool Get(String& name, IJSON*& lpJSON, size_t index)
+				Append(
+					lpArray
+				);
+
+				Begin(
+					lpArray
+				);
+			}
+
+			return True;
+		}
+		// @throw AL::Exception
+		Bool OnArrayEnd()
 		{
-			WString wstring;
+			auto& frame   = frames[frames.GetSize() - 1];
+			auto  lpArray = static_cast<JSONArray*>(frame.lpContainer);
 
-			if (!Get(wstring, lpJSON, index))
-			{
+			lpArray->values.SetCapacity(
+				lpArena,
+				lpArray->values.GetSize() + (values.GetSize() - frame.Start)
+			);
 
-				return False;
+			for (size_t i = frame.Start; i < values.GetSize(); ++i)
+			{
+				lpArray->values.PushBack(
+					lpArena,
+					values[i].lpValue
+				);
 			}
 
-			name = wstring.ToString();
+			End();
 
 			return True;
 		}
-		Bool Get(WString& name, IJSON*& lpJSON, size_t index)
-		{
-			size_t i = 0;
 
-			for (auto& member : members)
+		// @throw AL::Exception
+		Bool OnObjectBegin()
+		{
+			if (frames.GetSize() == 0)
 			{
-				if (i++ == index)
+				if (!lpRoot->IsObject())
 				{
-					name   = member.Name;
-					lpJSON = member.lpValue;
 
-					return True;
+					throw Exception(
+						"JSON is an object but the root is not a JSONObject"
+					);
 				}
-			}
 
-			return False;
-		}
-		Bool Get(String& name, JSONArray*& lpArray, size_t index)
-		{
-			WString wstring;
+				auto lpObject = static_cast<JSONObject*>(
+					lpRoot
+				);
+
+				if (lpObject->lpArena == nullptr)
+				{
+					lpObject->lpArena      = new Collections::Arena();
+					lpObject->isArenaOwner = True;
+				}
+
+				lpArena = lpObject->lpArena;
 
-			if (!Get(wstring, lpArray, index))
+				Begin(
+					lpObject
+				);
+			}
+			else
 			{
+				auto lpObject = __JSON_DOM_Utility::Create<JSONObject>(
+					lpArena
+				);
 
-				return False;
+				Append(
+					lpObject
+				);
+
+				Begin(
+					lpObject
+				);
 			}
 
-			name = wstring.ToString();
+			return True;
+		}
+		// @throw AL::Exception
+		Bool OnObjectKey(const StringView& name)
+		{
+			this->name = StringView(
+				__JSON_DOM_Utility::CreateString(lpArena, name.GetBuffer(), name.GetLength()),
+				name.GetLength()
+			);
 
 			return True;
 		}
-		Bool Get(WString& name, JSONArray*& lpArray, size_t index)
+		// @throw AL::Exception
+		Bool OnObjectEnd()
 		{
-			if (!Get(name, reinterpret_cast<IJSON*&>(lpArray), index))
-			{
+			auto& frame    = frames[frames.GetSize() - 1];
+			auto  lpObject = static_cast<JSONObject*>(frame.lpContainer);
 
-				return False;
-			}
+			lpObject->members.SetCapacity(
+				lpArena,
+				lpObject->members.GetSize() + (values.GetSize() - frame.Start)
+			);
 
-			if (!lpArray->IsArray())
+			for (size_t i = frame.Start; i < values.GetSize(); ++i)
 			{
-
-				return False;
+				lpObject->Append(
+					values[i].Name,
+					values[i].lpValue
+				);
 			}
 
+			End();
+
 			return True;
 		}
-		Bool Get(String& name, JSONValue*& lpValue, size_t index)
-		{
-			WString wstring;
-
-			if (!Get(wstring, lpValue, index))
-			{
 
-				return False;
-			}
+	private:
+		Void Begin(IJSON* lpContainer)
+		{
+			frames.PushBack(
+				{
+					.lpContainer = lpContainer,
+					.Start       = values.GetSize()
+				}
+			);
+		}
 
-			name = wstring.ToString();
+		Void End()
+		{
+			values.Erase(
+				values.begin() + frames[frames.GetSize() - 1].Start,
+				values.end()
+			);
 
-			return True;
+			frames.PopBack();
 		}
-		Bool Get(WString& name, JSONValue*& lpValue, size_t index)
+
+		// @throw AL::Exception
+		Bool Add(JSONValue&& value)
 		{
-			if (!Get(name, reinterpret_cast<IJSON*&>(lpValue), index))
+			if (frames.GetSize() == 0)
 			{
+				if (!lpRoot->IsValue())
+				{
 
-				return False;
-			}
+					throw Exception(
+						"JSON is a value but the root is not a JSONValue"
+					);
+				}
 
-			if (!lpValue->IsValue())
+				*static_cast<JSONValue*>(lpRoot) = Move(
+					value
+				);
+			}
+			else
 			{
-
-				return False;
+				Append(
+					__JSON_DOM_Utility::Create<JSONValue>(lpArena, Move(value))
+				);
 			}
 
 			return True;
 		}
-		Bool Get(String& name, JSONObject*& lpObject, size_t index)
-		{
-			WString wstring;
 
-			if (!Get(wstring, lpObject, index))
-			{
+		// Values are attached to their container when it ends
+		Void Append(IJSON* lpJSON)
+		{
+			values.PushBack(
+				{
+					.Name    = name,
+					.lpValue = lpJSON
+				}
+			);
+		}
+	};
 
-				return False;
-			}
+	// Streams UTF-8 JSON into a StringBuilder, FileSystem::File or Network::TcpSocket
+	// - Output is buffered, call Flush when done
+	// - Separators are written automatically, nesting is not validated
+	template<typename T_OUTPUT>
+	class JSONWriter
+	{
+		// StringBuilder is already buffered, its staging buffer only batches appends
+		static constexpr size_t BUFFER_SIZE = Is_Type<T_OUTPUT, StringBuilder>::Value ? 0x400 : 0x4000;
 
-			name = wstring.ToString();
+		// 19 digits, sign and null
+		static constexpr size_t INTEGER_BUFFER_SIZE = 21;
+		// 17 significant digits, sign, point, exponent and null
+		static constexpr size_t DECIMAL_BUFFER_SIZE = 32;
 
-			return True;
-		}
-		Bool Get(WString& name, JSONObject*& lpObject, size_t index)
+		// Escape sequence of every control character
+		static constexpr const char* CONTROL_ESCAPES[0x20] =
 		{
-			if (!Get(name, reinterpret_cast<IJSON*&>(lpObject), index))
-			{
-
-				return False;
-			}
+			"\\u0000", "\\u0001", "\\u0002", "\\u0003", "\\u0004", "\\u0005", "\\u0006", "\\u0007",
+			"\\b",     "\\t",     "\\n",     "\\u000b", "\\f",     "\\r",     "\\u000e", "\\u000f",
+			"\\u0010", "\\u0011", "\\u0012", "\\u0013", "\\u0014", "\\u0015", "\\u0016", "\\u0017",
+			"\\u0018", "\\u0019", "\\u001a", "\\u001b", "\\u001c", "\\u001d", "\\u001e", "\\u001f"
+		};
 
-			if (!lpObject->IsObject())
-			{
+		T_OUTPUT*                lpOutput;
+		Bool                     isSeparatorRequired = False;
 
-				return False;
-			}
+		size_t                   bufferSize = 0;
+		// on the heap so writers can live on small stacks
+		Collections::Array<char> buffer;
 
-			return True;
+	public:
+		explicit JSONWriter(T_OUTPUT& output)
+			: lpOutput(
+				&output
+			),
+			buffer(
+				BUFFER_SIZE
+			)
+		{
 		}
 
-		Bool GetMemberByName(IJSON*& lpJSON, const String& name)
+		// @throw AL::Exception
+		Void Flush()
 		{
-			if (!GetMemberByName(lpJSON, name.ToWString()))
+			if (bufferSize != 0)
 			{
+				WriteOutput(
+					*lpOutput,
+					&buffer[0],
+					bufferSize
+				);
 
-				return False;
+				bufferSize = 0;
 			}
-
-			return True;
 		}
-		Bool GetMemberByName(IJSON*& lpJSON, const WString& name)
+
+		// @throw AL::Exception
+		Void Write(const IJSON& json);
+
+		// @throw AL::Exception
+		Void WriteNull()
 		{
-			for (auto& member : members)
-			{
-				if (member.Name == name)
-				{
-					lpJSON = member.lpValue;
+			WriteSeparator();
 
-					return True;
-				}
-			}
+			WriteRaw(
+				"null",
+				4
+			);
+		}
 
-			return False;
+		// @throw AL::Exception
+		Void WriteBoolean(Bool value)
+		{
+			WriteSeparator();
+
+			if (value)
+				WriteRaw("true", 4);
+			else
+				WriteRaw("false", 5);
 		}
-		Bool GetMemberByName(JSONArray*& lpArray, const String& name)
+
+		// @throw AL::Exception
+		Void WriteInteger(int64 value)
 		{
-			if (!GetMemberByName(lpArray, name.ToWString()))
-			{
+			WriteSeparator();
 
-				return False;
-			}
+			char buffer[INTEGER_BUFFER_SIZE];
 
-			return True;
+			auto result = ::std::to_chars(
+				&buffer[0],
+				&buffer[INTEGER_BUFFER_SIZE],
+				value
+			);
+
+			WriteRaw(
+				&buffer[0],
+				static_cast<size_t>(result.ptr - &buffer[0])
+			);
 		}
-		Bool GetMemberByName(JSONArray*& lpArray, const WString& name)
+
+		// Non-finite values are written as null
+		// @throw AL::Exception
+		Void WriteDecimal(Double value)
 		{
-			if (!GetMemberByName(reinterpret_cast<IJSON*&>(lpArray), name))
+			if (!::std::isfinite(value))
 			{
+				WriteNull();
 
-				return False;
+				return;
 			}
 
-			if (!lpArray->IsArray())
-			{
+			WriteSeparator();
 
-				return False;
+			char buffer[DECIMAL_BUFFER_SIZE];
+
+#if defined(__cpp_lib_to_chars)
+			auto length = static_cast<size_t>(
+				::std::to_chars(&buffer[0], &buffer[DECIMAL_BUFFER_SIZE - 2], value).ptr - &buffer[0]
+			);
+#else
+			auto length = static_cast<size_t>(
+				::std::snprintf(&buffer[0], DECIMAL_BUFFER_SIZE - 2, "%.17g", value)
+			);
+#endif
+
+			StringView decimal(
+				&buffer[0],
+				length
+			);
+
+			// keeps the value a decimal when read back
+			if ((decimal.IndexOf('.') == StringView::NPOS) && (decimal.IndexOf('e') == StringView::NPOS))
+			{
+				buffer[length++] = '.';
+				buffer[length++] = '0';
 			}
 
-			return True;
+			WriteRaw(
+				&buffer[0],
+				length
+			);
 		}
-		Bool GetMemberByName(JSONValue*& lpValue, const String& name)
+
+		// @throw AL::Exception
+		Void WriteString(const StringView& value)
 		{
-			if (!GetMemberByName(lpValue, name.ToWString()))
-			{
+			WriteSeparator();
 
-				return False;
-			}
+			WriteEscaped(
+				value
+			);
+		}
 
-			return True;
+		// @throw AL::Exception
+		Void BeginArray()
+		{
+			WriteSeparator();
+
+			WriteRaw(
+				'['
+			);
+
+			isSeparatorRequired = False;
 		}
-		Bool GetMemberByName(JSONValue*& lpValue, const WString& name)
+		// @throw AL::Exception
+		Void EndArray()
 		{
-			if (!GetMemberByName(reinterpret_cast<IJSON*&>(lpValue), name))
-			{
+			WriteRaw(
+				']'
+			);
 
-				return False;
-			}
+			isSeparatorRequired = True;
+		}
 
-			if (!lpValue->IsValue())
-			{
+		// @throw AL::Exception
+		Void BeginObject()
+		{
+			WriteSeparator();
 
-				return False;
-			}
+			WriteRaw(
+				'{'
+			);
 
-			return True;
+			isSeparatorRequired = False;
 		}
-		Bool GetMemberByName(JSONObject*& lpObject, const String& name)
+		// @throw AL::Exception
+		Void WriteKey(const StringView& name)
 		{
-			if (!GetMemberByName(lpObject, name.ToWString()))
-			{
+			WriteSeparator();
 
-				return False;
-			}
+			WriteEscaped(
+				name
+			);
 
-			return True;
+			WriteRaw(
+				':'
+			);
+
+			isSeparatorRequired = False;
 		}
-		Bool GetMemberByName(JSONObject*& lpObject, const WString& name)
+		// @throw AL::Exception
+		Void EndObject()
 		{
-			if (!GetMemberByName(reinterpret_cast<IJSON*&>(lpObject), name))
-			{
+			WriteRaw(
+				'}'
+			);
 
-				return False;
-			}
+			isSeparatorRequired = True;
+		}
 
-			if (!lpObject->IsObject())
+	private:
+		// @throw AL::Exception
+		Void WriteSeparator()
+		{
+			if (isSeparatorRequired)
 			{
 
-				return False;
+				WriteRaw(
+					','
+				);
 			}
 
-			return True;
+			isSeparatorRequired = True;
 		}
 
-		Bool GetMemberByIndex(IJSON*& lpJSON, size_t index)
+		// @throw AL::Exception
+		Void WriteEscaped(const StringView& value)
 		{
-			size_t i = 0;
+			WriteRaw(
+				'"'
+			);
 
-			for (auto& member : members)
+			auto lpChar = value.GetBuffer();
+			auto lpEnd  = lpChar + value.GetLength();
+
+			while (lpChar != lpEnd)
 			{
-				if (i++ == index)
+				auto lpSpecial = __JSON_Utility::FindStringSpecial(
+					lpChar,
+					lpEnd
+				);
+
+				WriteRaw(
+					lpChar,
+					static_cast<size_t>(lpSpecial - lpChar)
+				);
+
+				if ((lpChar = lpSpecial) == lpEnd)
 				{
-					lpJSON = member.lpValue;
 
-					return True;
+					break;
 				}
-			}
 
-			return False;
-		}
-		Bool GetMemberByIndex(JSONArray*& lpArray, size_t index)
-		{
-			if (!GetMemberByIndex(reinterpret_cast<IJSON*&>(lpArray), index))
-			{
+				switch (*lpChar)
+				{
+					case '"':
+						WriteRaw("\\\"", 2);
+						break;
 
-				return False;
-			}
+					case '\\':
+						WriteRaw("\\\\", 2);
+						break;
 
-			if (!lpArray->IsArray())
-			{
+					default:
+					{
+						auto lpEscape = CONTROL_ESCAPES[static_cast<uint8>(*lpChar)];
 
-				return False;
+						WriteRaw(
+							lpEscape,
+							(lpEscape[1] == 'u') ? 6 : 2
+						);
+					}
+					break;
+				}
+
+				++lpChar;
 			}
 
-			return True;
+			WriteRaw(
+				'"'
+			);
 		}
-		Bool GetMemberByIndex(JSONValue*& lpValue, size_t index)
-		{
-			if (!GetMemberByIndex(reinterpret_cast<IJSON*&>(lpValue), index))
-			{
-
-				return False;
-			}
 
-			if (!lpValue->IsValue())
+		// @throw AL::Exception
+		Void WriteRaw(char c)
+		{
+			if (bufferSize == BUFFER_SIZE)
 			{
 
-				return False;
+				Flush();
 			}
 
-			return True;
+			buffer[bufferSize++] = c;
 		}
-		Bool GetMemberByIndex(JSONObject*& lpObject, size_t index)
+		// @throw AL::Exception
+		Void WriteRaw(const char* lpBuffer, size_t size)
 		{
-			if (!GetMemberByIndex(reinterpret_cast<IJSON*&>(lpObject), index))
+			if ((BUFFER_SIZE - bufferSize) < size)
 			{
+				Flush();
 
-				return False;
-			}
-
-			if (!lpObject->IsObject())
-			{
+				// too large to be worth buffering
+				if (size >= BUFFER_SIZE)
+				{
+					WriteOutput(
+						*lpOutput,
+						lpBuffer,
+						size
+					);
 
-				return False;
+					return;
+				}
 			}
 
-			return True;
+			memcpy(
+				&buffer[0] + bufferSize,
+				lpBuffer,
+				size
+			);
+
+			bufferSize += size;
 		}
 
-		JSONObject& operator = (JSONObject&& object)
+		static Void WriteOutput(StringBuilder& sb, const char* lpBuffer, size_t size)
 		{
-			members = Move(
-				object.members
+			sb.Append(
+				lpBuffer,
+				size
 			);
-
-			return *this;
 		}
-		JSONObject& operator = (const JSONObject& object)
+		// FileSystem::File
+		// @throw AL::Exception if nothing could be written
+		template<typename T_FILE>
+		static auto WriteOutput(T_FILE& file, const char* lpBuffer, size_t size) -> decltype(file.Write(lpBuffer, size), Void())
 		{
-			Clear();
-
-			for (auto& member : object.members)
+			for (size_t numberOfBytesWritten = 0; numberOfBytesWritten < size; )
 			{
-				Member _member =
+				auto _numberOfBytesWritten = file.Write(
+					&lpBuffer[numberOfBytesWritten],
+					size - numberOfBytesWritten
+				);
+
+				if (_numberOfBytesWritten == 0)
 				{
-					.Name = member.Name
-				};
 
-				if (member.lpValue->IsArray())
-					_member.lpValue = new JSONArray(*reinterpret_cast<const JSONArray*>(member.lpValue));
-				else if (member.lpValue->IsValue())
-					_member.lpValue = new JSONValue(*reinterpret_cast<const JSONValue*>(member.lpValue));
-				else if (member.lpValue->IsObject())
-					_member.lpValue = new JSONObject(*reinterpret_cast<const JSONObject*>(member.lpValue));
+					throw Exception(
+						"Error writing %llu byte(s) of JSON",
+						static_cast<unsigned long long>(size - numberOfBytesWritten)
+					);
+				}
 
-				members.PushBack(
-					Move(_member)
-				);
+				numberOfBytesWritten += _numberOfBytesWritten;
 			}
-
-			return *this;
 		}
-
-		Bool operator == (const JSONObject& object) const
+		// Network::TcpSocket, the socket must be blocking
+		// @throw AL::Exception if the connection is closed or nothing could be sent
+		template<typename T_SOCKET>
+		static auto WriteOutput(T_SOCKET& socket, const char* lpBuffer, size_t size) -> decltype(socket.Send(lpBuffer, size, ::std::declval<size_t&>()), Void())
 		{
-			if (GetSize() != object.GetSize())
-			{
-
-				return False;
-			}
-
-			for (auto it1 = members.begin(), it2 = object.members.begin(); it1 != members.end(); ++it1, ++it2)
+			for (size_t numberOfBytesSent = 0, _numberOfBytesSent; numberOfBytesSent < size; numberOfBytesSent += _numberOfBytesSent)
 			{
-				if (it1->Name != it2->Name)
+				if (!socket.Send(&lpBuffer[numberOfBytesSent], size - numberOfBytesSent, _numberOfBytesSent))
 				{
 
-					return False;
+					throw Exception(
+						"Connection closed"
+					);
 				}
 
-				auto lpJSON1 = it1->lpValue;
-				auto lpJSON2 = it2->lpValue;
-
-				if (lpJSON1->IsArray() && lpJSON2->IsArray())
+				// a non-blocking socket that would block
+				if (_numberOfBytesSent == 0)
 				{
-					if (*reinterpret_cast<const JSONArray*>(lpJSON1) != *reinterpret_cast<const JSONArray*>(lpJSON2))
-					{
 
-						return False;
-					}
-
-					continue;
+					throw Exception(
+						"Error sending %llu byte(s) of JSON",
+						static_cast<unsigned long long>(size - numberOfBytesSent)
+					);
 				}
-				else if (lpJSON1->IsValue() && lpJSON2->IsValue())
-				{
-					if (*reinterpret_cast<const JSONValue*>(lpJSON1) != *reinterpret_cast<const JSONValue*>(lpJSON2))
-					{
+			}
+		}
+	};
+}
 
-						return False;
-					}
+inline AL::String AL::Serialization::IJSON::ToString() const
+{
+	StringBuilder             sb;
+	JSONWriter<StringBuilder> writer(sb);
 
-					continue;
-				}
-				else if (lpJSON1->IsObject() && lpJSON2->IsObject())
-				{
-					if (*reinterpret_cast<const JSONObject*>(lpJSON1) != *reinterpret_cast<const JSONObject*>(lpJSON2))
-					{
+	writer.Write(
+		*this
+	);
 
-						return False;
-					}
+	writer.Flush();
 
-					continue;
-				}
+	return sb.ToString();
+}
 
-				return False;
-			}
+inline AL::String AL::Serialization::IJSON::Encode(const String& value)
+{
+	StringBuilder             sb;
+	JSONWriter<StringBuilder> writer(sb);
 
-			return True;
-		}
-		Bool operator != (const JSONObject& object) const
-		{
-			if (operator==(object))
-			{
+	writer.WriteString(
+		value
+	);
 
-				return False;
-			}
+	writer.Flush();
 
-			return True;
-		}
+	auto string = sb.ToString();
 
-	private:
-		Void Add(Member&& member)
+	// without the quotes
+	return string.SubString(
+		1,
+		string.GetLength() - 2
+	);
+}
+
+template<typename T_OUTPUT>
+inline AL::Void AL::Serialization::JSONWriter<T_OUTPUT>::Write(const IJSON& json)
+{
+	if (json.IsArray())
+	{
+		BeginArray();
+
+		for (auto lpValue : static_cast<const JSONArray&>(json).values)
 		{
-			for (auto it = members.begin(); it != members.end(); ++it)
-			{
-				if (it->Name == member.Name)
-				{
-					delete it->lpValue;
+			Write(
+				*lpValue
+			);
+		}
 
-					it->lpValue = member.lpValue;
+		EndArray();
+	}
+	else if (json.IsObject())
+	{
+		BeginObject();
 
-					return;
-				}
-			}
+		for (auto& member : static_cast<const JSONObject&>(json).members)
+		{
+			WriteKey(
+				member.Name
+			);
 
-			members.PushBack(
-				Move(member)
+			Write(
+				*member.lpValue
 			);
 		}
-	};
 
-	class JSON
-		: public JSONObject
+		EndObject();
+	}
+	else if (json.IsValue())
 	{
-	public:
-		typedef JSONArray  Array;
-		typedef JSONValue  Value;
-		typedef JSONObject Object;
-
-		using JSONObject::JSONObject;
-	};
+		auto& value = static_cast<const JSONValue&>(json);
+
+		if (value.IsNull())
+			WriteNull();
+		else if (value.IsDecimal())
+			WriteDecimal(value.value.Decimal);
+		else if (value.IsInteger())
+			WriteInteger(value.value.Integer);
+		else if (value.IsString())
+			WriteString(StringView(value.value.lpString, value.value.StringLength));
+		else if (value.IsBoolean())
+			WriteBoolean(value.value.Boolean);
+	}
 }
 
-inline AL::Serialization::JSONArray::JSONArray(const JSONArray& array)
+inline AL::Serialization::IJSON* AL::Serialization::__JSON_DOM_Utility::Copy(Collections::Arena* lpArena, const IJSON& json)
 {
-	for (auto lpValue : array.values)
+	if (json.IsArray())
+	{
+
+		return Create<JSONArray>(
+			lpArena,
+			static_cast<const JSONArray&>(json)
+		);
+	}
+
+	if (json.IsObject())
 	{
-		if (lpValue->IsArray())
-			values.PushBack(new JSONArray(*reinterpret_cast<const JSONArray*>(lpValue)));
-		else if (lpValue->IsValue())
-			values.PushBack(new JSONValue(*reinterpret_cast<const JSONValue*>(lpValue)));
-		else if (lpValue->IsObject())
-			values.PushBack(new JSONObject(*reinterpret_cast<const JSONObject*>(lpValue)));
+
+		return Create<JSONObject>(
+			lpArena,
+			static_cast<const JSONObject&>(json)
+		);
 	}
+
+	return Create<JSONValue>(
+		lpArena,
+		static_cast<const JSONValue&>(json)
+	);
+}
+
+inline AL::Void AL::Serialization::JSONValue::FromString(JSONValue& value, const String& string)
+{
+	__JSON_DOM_Handler handler(
+		value
+	);
+
+	JSONParser::Parse(
+		handler,
+		string
+	);
+}
+
+inline AL::Void AL::Serialization::JSONArray::FromString(JSONArray& array, const String& string)
+{
+	array.Clear();
+
+	__JSON_DOM_Handler handler(
+		array
+	);
+
+	JSONParser::Parse(
+		handler,
+		string
+	);
+}
+
+inline AL::Void AL::Serialization::JSONObject::FromString(JSONObject& object, const String& string)
+{
+	object.Clear();
+
+	__JSON_DOM_Handler handler(
+		object
+	);
+
+	JSONParser::Parse(
+		handler,
+		string
+	);
 }
 
 inline AL::Void AL::Serialization::JSONArray::Add(JSONObject&& object)
 {
-	values.PushBack(new JSONObject(Move(object)));
+	values.PushBack(
+		lpArena,
+		__JSON_DOM_Utility::Create<JSONObject>(lpArena, Move(object))
+	);
 }
 
 inline AL::Bool AL::Serialization::JSONArray::Get(JSONObject*& lpObject, size_t index)
@@ -1485,23 +3993,6 @@ inline AL::Bool AL::Serialization::JSONArray::Get(JSONObject*& lpObject, size_t
 	return True;
 }
 
-inline AL::Serialization::JSONArray& AL::Serialization::JSONArray::operator = (const JSONArray& array)
-{
-	values.Clear();
-
-	for (auto lpValue : array.values)
-	{
-		if (lpValue->IsArray())
-			values.PushBack(new JSONArray(*reinterpret_cast<const JSONArray*>(lpValue)));
-		else if (lpValue->IsValue())
-			values.PushBack(new JSONValue(*reinterpret_cast<const JSONValue*>(lpValue)));
-		else if (lpValue->IsObject())
-			values.PushBack(new JSONObject(*reinterpret_cast<const JSONObject*>(lpValue)));
-	}
-
-	return *this;
-}
-
 inline AL::Bool AL::Serialization::JSONArray::operator == (const JSONArray& array) const
 {
 	if (GetSize() != array.GetSize())
@@ -1510,10 +4001,10 @@ inline AL::Bool AL::Serialization::JSONArray::operator == (const JSONArray& arra
 		return False;
 	}
 
-	for (auto it1 = values.begin(), it2 = array.values.begin(); it1 != values.end(); ++it1, ++it2)
+	for (size_t i = 0; i < values.GetSize(); ++i)
 	{
-		auto lpJSON1 = *it1;
-		auto lpJSON2 = *it2;
+		auto lpJSON1 = values[i];
+		auto lpJSON2 = array.values[i];
 
 		if (lpJSON1->IsArray() && lpJSON2->IsArray())
 		{
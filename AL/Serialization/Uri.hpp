@@ -5,7 +5,8 @@
 
 namespace AL::Serialization
 {
-	typedef Collections::Dictionary<String, String> UriQuery;
+	// Insertion ordered so ToString writes parameters in the order they were parsed or added
+	typedef Collections::Dictionary<String, String, True> UriQuery;
 
 	struct UriAuthority
 	{
@@ -0,0 +1,219 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Thread.hpp>
+#include <AL/OS/Console.hpp>
+
+#include <AL/APRS/Client.hpp>
+
+#include <atomic>
+
+// Accepts a single client on the non-blocking listener and replays feed count times as fast as the connection allows
+// - Returns without a client once isStopped is set
+// @throw AL::Exception
+static void AL_APRS_Client_ReplayServer(AL::Network::TcpSocket& listener, const ::std::atomic<AL::Bool>& isStopped, const char* const* lpFeed, AL::size_t feedSize, AL::uint32 count)
+{
+	using namespace AL;
+	using namespace AL::Network;
+
+	TcpSocket socket(
+		AddressFamilies::IPv4
+	);
+
+	while (!listener.Accept(socket))
+	{
+		if (isStopped)
+		{
+
+			return;
+		}
+
+		Sleep(
+			TimeSpan::FromMilliseconds(1)
+		);
+	}
+
+	socket.SetBlocking(
+		True
+	);
+
+	// discards the login line
+	for (char c = '\0'; c != '\n'; )
+	{
+		AL::size_t numberOfBytesReceived;
+
+		if (!SocketExtensions::ReceiveAll(socket, &c, 1, numberOfBytesReceived))
+		{
+
+			return;
+		}
+	}
+
+	static constexpr char LOGRESP[] = "# logresp N0CALL verified, server T2TEST\r\n";
+
+	AL::size_t numberOfBytesSent;
+
+	if (!SocketExtensions::SendAll(socket, LOGRESP, sizeof(LOGRESP) - 1, numberOfBytesSent))
+	{
+
+		return;
+	}
+
+	StringBuilder feed;
+
+	for (AL::size_t i = 0; i < feedSize; ++i)
+	{
+		feed << lpFeed[i] << "\r\n";
+	}
+
+	auto buffer = feed.ToString();
+
+	for (uint32 i = 0; i < count; ++i)
+	{
+		if (!SocketExtensions::SendAll(socket, buffer.GetCString(), buffer.GetLength(), numberOfBytesSent))
+		{
+
+			return;
+		}
+	}
+
+	// waits for the client to disconnect first so the listening port is not left in TIME_WAIT
+	for (char c; SocketExtensions::ReceiveAll(socket, &c, 1, numberOfBytesSent); )
+	{
+	}
+
+	socket.Close();
+}
+
+// @throw AL::Exception
+static void AL_APRS_Client()
+{
+	using namespace AL;
+	using namespace AL::APRS;
+	using namespace AL::Network;
+
+	// captured from an APRS-IS full feed
+	static constexpr const char* FEED[] =
+	{
+		"N0CALL-9>APRS,WIDE1-1,WIDE2-1,qAR,W1AW-10:!4903.50N/07201.75W-Test 001",
+		"KD6ABC>APDR16,TCPIP*,qAC,T2SOCAL:=3404.61N/11824.91W$ https://aprsdroid.org/",
+		"EW1234>APRS,TCPXX*,qAX,CWOP-5:@181200z4903.50N/07201.75W_220/004g005t077r000p000P000h50b09900wRSW",
+		"W1AW>APWW11,TCPIP*,qAC,T2BOSTON::BLN1     :Net tonight at 2000 local",
+		"JA1ZZZ>APRS,TCPIP*,qAS,JA1ZZZ:>Status text",
+		"# aprsc 2.1.14-g5e22b37 18 Oct 2026 12:00:00 GMT T2TEST 127.0.0.1:14580"
+	};
+
+	static constexpr uint32     COUNT        = 200;
+	static constexpr AL::size_t PACKET_COUNT = 5;
+
+	// any free port, the assigned one is read back once bound
+	IPEndPoint ep
+	{
+		.Host = IPAddress::Loopback(),
+		.Port = 0
+	};
+
+	TcpSocket listener(
+		AddressFamilies::IPv4
+	);
+
+	listener.Open();
+	listener.Bind(ep);
+	listener.Listen(1);
+	listener.SetBlocking(False);
+
+	ep = listener.GetLocalEndPoint();
+
+	::std::atomic<Bool> isStopped = False;
+
+	OS::Thread thread;
+
+	thread.Start(
+		[&listener, &isStopped]()
+		{
+			AL_APRS_Client_ReplayServer(
+				listener,
+				isStopped,
+				&FEED[0],
+				sizeof(FEED) / sizeof(FEED[0]),
+				COUNT
+			);
+		}
+	);
+
+	Client client(
+		"N0CALL",
+		DigiPath(),
+		'/',
+		'l'
+	);
+
+	client.SetBlocking(
+		True
+	);
+
+	AL::size_t packetCount = 0;
+
+	client.OnReceivePacket.Register(
+		[&packetCount](const Packet& _packet)
+		{
+			++packetCount;
+		}
+	);
+
+	try
+	{
+		if (!client.ConnectIS(ep, 0, "r/0/0/0"))
+		{
+
+			throw Exception(
+				"Error connecting to replay server"
+			);
+		}
+	}
+	catch (Exception&)
+	{
+		// the replay server never gets a client to serve
+		isStopped = True;
+
+		thread.Join();
+
+		listener.Close();
+
+		throw;
+	}
+
+	OS::Timer timer;
+
+	while ((packetCount < (COUNT * PACKET_COUNT)) && client.Update(TimeSpan::FromMilliseconds(0)))
+	{
+	}
+
+	auto elapsed = timer.GetElapsed();
+
+	client.Disconnect();
+
+	thread.Join();
+
+	listener.Close();
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"Received %llu packets in %lluus (%llu packets/s)",
+		packetCount,
+		elapsed.ToMicroseconds(),
+		(packetCount * 1000000) / ((elapsed.ToMicroseconds() != 0) ? elapsed.ToMicroseconds() : 1)
+	);
+#endif
+
+	if (packetCount != (COUNT * PACKET_COUNT))
+	{
+
+		throw Exception(
+			"Received %llu of %llu packets",
+			packetCount,
+			COUNT * PACKET_COUNT
+		);
+	}
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Console.hpp>
+
+#include <AL/Collections/Arena.hpp>
+
+// @throw AL::Exception
+static void AL_Collections_Arena()
+{
+	using namespace AL;
+	using namespace AL::Collections;
+
+	Arena arena;
+
+	for (uint32 i = 0; i < 10000; ++i)
+	{
+		auto alignment = AL::size_t(1) << (i % 7);
+
+		auto lpValue = static_cast<uint8*>(
+			arena.Allocate((i % 97) + 1, alignment)
+		);
+
+		if ((reinterpret_cast<AL::size_t>(lpValue) & (alignment - 1)) != 0)
+		{
+
+			throw Exception(
+				"Allocation %lu is not aligned to %llu",
+				static_cast<unsigned long>(i),
+				static_cast<unsigned long long>(alignment)
+			);
+		}
+
+		memset(
+			lpValue,
+			0xFF,
+			(i % 97) + 1
+		);
+	}
+
+	// larger than the largest block
+	auto lpLarge = arena.Create<uint64>(
+		0x4000000
+	);
+
+	auto lpBuffer = static_cast<uint8*>(
+		arena.Allocate(0x200000)
+	);
+
+	memset(
+		lpBuffer,
+		0,
+		0x200000
+	);
+
+	if (*lpLarge != 0x4000000)
+	{
+
+		throw Exception(
+			"Arena::Create did not construct the value"
+		);
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"Arena reserved %llu bytes",
+		static_cast<unsigned long long>(arena.GetSize())
+	);
+#endif
+
+	auto arena2 = Move(
+		arena
+	);
+
+	if ((arena.GetSize() != 0) || (arena2.GetSize() == 0))
+	{
+
+		throw Exception(
+			"Arena was not moved"
+		);
+	}
+
+	arena2.Clear();
+
+	if (arena2.GetSize() != 0)
+	{
+
+		throw Exception(
+			"Arena::Clear did not release every block"
+		);
+	}
+}
@@ -1,10 +1,62 @@
 #pragma once
 #include <AL/Common.hpp>
 
+#include <AL/OS/Timer.hpp>
 #include <AL/OS/Console.hpp>
 
+#include <AL/Collections/String.hpp>
 #include <AL/Collections/ArrayList.hpp>
 
+struct AL_Collections_ArrayList_Value
+{
+	static inline AL::int64 InstanceCount = 0;
+
+	AL::Collections::String String;
+
+	explicit AL_Collections_ArrayList_Value(AL::uint32 value)
+		: String(
+			AL::ToString(value)
+		)
+	{
+		++InstanceCount;
+	}
+
+	AL_Collections_ArrayList_Value(AL_Collections_ArrayList_Value&& value)
+		: String(
+			AL::Move(value.String)
+		)
+	{
+		++InstanceCount;
+	}
+	AL_Collections_ArrayList_Value(const AL_Collections_ArrayList_Value& value)
+		: String(
+			value.String
+		)
+	{
+		++InstanceCount;
+	}
+
+	~AL_Collections_ArrayList_Value()
+	{
+		--InstanceCount;
+	}
+
+	AL_Collections_ArrayList_Value& operator = (AL_Collections_ArrayList_Value&& value)
+	{
+		String = AL::Move(
+			value.String
+		);
+
+		return *this;
+	}
+	AL_Collections_ArrayList_Value& operator = (const AL_Collections_ArrayList_Value& value)
+	{
+		String = value.String;
+
+		return *this;
+	}
+};
+
 // @throw AL::Exception
 static void AL_Collections_ArrayList()
 {
@@ -40,4 +92,119 @@ static void AL_Collections_ArrayList()
 			it++
 		);
 	}
+
+	if (array.GetSize() != 0)
+	{
+
+		throw Exception(
+			"Erase with ReverseIterator left %llu values",
+			static_cast<unsigned long long>(array.GetSize())
+		);
+	}
+
+	{
+		uint32 values[]  = { 1, 2, 3 };
+		uint32 values2[] = { 1, 2, 4 };
+
+		if ((ArrayList<uint32>(values) != ArrayList<uint32>(values)) || (ArrayList<uint32>(values) == ArrayList<uint32>(values2)))
+		{
+
+			throw Exception(
+				"ArrayList<uint32> comparison failed"
+			);
+		}
+	}
+
+	// capacity is reserved without constructing values
+	{
+		typedef AL_Collections_ArrayList_Value Value;
+
+		{
+			ArrayList<Value> values(
+				1000
+			);
+
+			if (Value::InstanceCount != 0)
+			{
+
+				throw Exception(
+					"ArrayList constructed %lli unused values",
+					static_cast<long long>(Value::InstanceCount)
+				);
+			}
+
+			for (uint32 i = 0; i < 10000; ++i)
+			{
+				values.EmplaceBack(
+					i
+				);
+			}
+
+			// refers to a value that is relocated while growing
+			values.ShrinkToFit();
+			values.PushBack(
+				values[0]
+			);
+
+			values.Insert(
+				values.begin() + 1,
+				Value(10001)
+			);
+
+			values.Erase(
+				values.begin() + 2,
+				values.begin() + 4
+			);
+
+			if ((values.GetSize() != 10000) || (Value::InstanceCount != 10000) || (values[0].String != "0") || (values[1].String != "10001") || (values[2].String != "3") || (values[9999].String != "0"))
+			{
+
+				throw Exception(
+					"ArrayList<Value> has unexpected contents"
+				);
+			}
+		}
+
+		if (Value::InstanceCount != 0)
+		{
+
+			throw Exception(
+				"ArrayList leaked %lli values",
+				static_cast<long long>(Value::InstanceCount)
+			);
+		}
+	}
+
+	// appending is amortized O(1)
+	{
+		static constexpr uint32 COUNT = 1000000;
+
+		OS::Timer timer;
+
+		ArrayList<uint32> values;
+
+		for (uint32 i = 0; i < COUNT; ++i)
+		{
+			values.PushBack(
+				i
+			);
+		}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		OS::Console::WriteLine(
+			"PushBack x %lu in %llums (capacity %llu)",
+			static_cast<unsigned long>(COUNT),
+			static_cast<unsigned long long>(timer.GetElapsed().ToMilliseconds()),
+			static_cast<unsigned long long>(values.GetCapacity())
+		);
+#endif
+
+		if ((values.GetSize() != COUNT) || (values[COUNT - 1] != (COUNT - 1)))
+		{
+
+			throw Exception(
+				"ArrayList<uint32> has unexpected contents"
+			);
+		}
+	}
 }
@@ -0,0 +1,109 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Console.hpp>
+
+#include <AL/Collections/HashDictionary.hpp>
+
+// @throw AL::Exception
+static void AL_Collections_HashDictionary()
+{
+	using namespace AL;
+	using namespace AL::Collections;
+
+	HashDictionary<uint32, uint32> dictionary;
+
+	for (uint32 i = 0, x = 0, y = 1000; i < 1000; ++i, ++x, --y)
+	{
+		dictionary[x] = y;
+	}
+
+	for (uint32 i = 0; i < 1000; i += 2)
+	{
+		dictionary.Remove(
+			i
+		);
+	}
+
+	for (uint32 i = 0, x = 0, y = 1000; i < 1000; ++i, ++x, --y)
+	{
+		auto it = dictionary.Find(
+			x
+		);
+
+		if ((x % 2) == 0)
+		{
+			if (it != dictionary.end())
+			{
+
+				throw Exception(
+					"Key %lu was not removed",
+					static_cast<unsigned long>(x)
+				);
+			}
+		}
+		else if ((it == dictionary.end()) || (it->Value != y))
+		{
+
+			throw Exception(
+				"Key %lu not found",
+				static_cast<unsigned long>(x)
+			);
+		}
+	}
+
+	HashDictionary<String, String> strings;
+
+	strings.Add("Host", "localhost");
+	strings.Add("Accept", "*/*");
+	strings.Add("Host", "127.0.0.1");
+
+	if (strings.GetSize() != 2)
+	{
+
+		throw Exception(
+			"Expected 2 pairs, found %lu",
+			static_cast<unsigned long>(strings.GetSize())
+		);
+	}
+
+	// values referencing the dictionary survive a rehash
+	HashDictionary<String, String> copies;
+
+	copies.Add("0", "value");
+
+	for (uint32 i = 1; i < 64; ++i)
+	{
+		copies.Add(
+			ToString(i),
+			copies.Find(ToString(i - 1))->Value
+		);
+	}
+
+	for (auto& pair : copies)
+	{
+		if (pair.Value != "value")
+		{
+
+			throw Exception(
+				"Key %s has an unexpected value",
+				pair.Key.GetCString()
+			);
+		}
+	}
+
+	for (auto it = strings.begin(); it != strings.end(); )
+	{
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		OS::Console::WriteLine(
+			"-%s => %s",
+			it->Key.GetCString(),
+			it->Value.GetCString()
+		);
+#endif
+
+		strings.Erase(
+			it++
+		);
+	}
+}
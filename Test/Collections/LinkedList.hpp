@@ -1,10 +1,77 @@
 #pragma once
 #include <AL/Common.hpp>
 
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Thread.hpp>
 #include <AL/OS/Console.hpp>
 
 #include <AL/Collections/LinkedList.hpp>
 
+// @throw AL::Exception
+template<typename T_LIST>
+static void AL_Collections_LinkedList_Allocator(const char* name)
+{
+	using namespace AL;
+	using namespace AL::Collections;
+
+	static constexpr uint32 ITERATIONS = 100000;
+
+	OS::Timer timer;
+
+	for (uint32 i = 0; i < ITERATIONS; ++i)
+	{
+		T_LIST list;
+
+		for (uint32 j = 0; j < 8; ++j)
+		{
+			list.PushBack(
+				j
+			);
+		}
+
+		list.EmplaceFront(
+			8
+		);
+
+		T_LIST list2(
+			Move(list)
+		);
+
+		list2.PopBack();
+		list2.PopFront();
+
+		if ((list.GetSize() != 0) || (list.begin() != list.end()) || (list2.GetSize() != 7) || (*list2.begin() != 0) || (*list2.rbegin() != 6))
+		{
+
+			throw Exception(
+				"%s: unexpected contents",
+				name
+			);
+		}
+
+		list = list2;
+		list2.Clear();
+
+		if ((list.GetSize() != 7) || !list.Contains(6) || (list2.GetSize() != 0))
+		{
+
+			throw Exception(
+				"%s: unexpected contents after copy",
+				name
+			);
+		}
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"%s: %lu iterations in %llums",
+		name,
+		ITERATIONS,
+		timer.GetElapsed().ToMilliseconds()
+	);
+#endif
+}
+
 // @throw AL::Exception
 static void AL_Collections_LinkedList()
 {
@@ -40,4 +107,37 @@ static void AL_Collections_LinkedList()
 			it++
 		);
 	}
+
+	AL_Collections_LinkedList_Allocator<LinkedList<uint32, NodeHeapAllocator>>(
+		"NodeHeapAllocator"
+	);
+
+	AL_Collections_LinkedList_Allocator<LinkedList<uint32, NodePoolAllocator>>(
+		"NodePoolAllocator"
+	);
+
+	AL_Collections_LinkedList_Allocator<LinkedList<uint32, NodeSlabAllocator<>>>(
+		"NodeSlabAllocator"
+	);
+
+	// the list is constructed before the pool of the thread so it is destroyed after it
+	OS::Thread thread;
+
+	thread.Start(
+		[]()
+		{
+			static thread_local LinkedList<uint32, NodePoolAllocator> threadList;
+
+			for (uint32 i = 0; i < 10; ++i)
+			{
+				threadList.PushBack(
+					i
+				);
+			}
+
+			threadList.PopFront();
+		}
+	);
+
+	thread.Join();
 }
@@ -0,0 +1,163 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Thread.hpp>
+#include <AL/OS/Console.hpp>
+
+#include <AL/Collections/MPMCQueue.hpp>
+
+#include <atomic>
+
+// @throw AL::Exception
+static void AL_Collections_MPMCQueue()
+{
+	using namespace AL;
+	using namespace AL::Collections;
+
+	static constexpr uint32 THREAD_COUNT     = 4;
+	static constexpr uint32 COUNT_PER_THREAD = 100000;
+	static constexpr uint32 BATCH_SIZE       = 16;
+
+	MPMCQueue<uint32> queue(
+		1024
+	);
+
+	for (uint32 i = 0; i < queue.GetCapacity(); ++i)
+	{
+		if (!queue.TryEnqueue(i))
+		{
+
+			throw Exception(
+				"TryEnqueue failed at %lu",
+				i
+			);
+		}
+	}
+
+	if (queue.TryEnqueue(0))
+	{
+
+		throw Exception(
+			"TryEnqueue succeeded on a full queue"
+		);
+	}
+
+	uint32 values[BATCH_SIZE];
+
+	if ((queue.TryDequeueBatch(&values[0], BATCH_SIZE) != BATCH_SIZE) || (values[0] != 0) || (values[BATCH_SIZE - 1] != (BATCH_SIZE - 1)))
+	{
+
+		throw Exception(
+			"TryDequeueBatch returned wrong values"
+		);
+	}
+
+	queue.Clear();
+
+	::std::atomic<uint64> sum = 0;
+
+	OS::Thread producers[THREAD_COUNT];
+	OS::Thread consumers[THREAD_COUNT];
+
+	OS::Timer timer;
+
+	for (uint32 i = 0; i < THREAD_COUNT; ++i)
+	{
+		producers[i].Start(
+			[&queue, i]()
+			{
+				uint32 _values[BATCH_SIZE];
+
+				for (uint32 j = 0; j < COUNT_PER_THREAD; j += BATCH_SIZE)
+				{
+					for (uint32 k = 0; k < BATCH_SIZE; ++k)
+					{
+						_values[k] = (i * COUNT_PER_THREAD) + j + k;
+					}
+
+					if ((i % 2) == 0)
+					{
+						queue.EnqueueBatch(
+							&_values[0],
+							BATCH_SIZE
+						);
+					}
+					else
+					{
+						for (uint32 k = 0; k < BATCH_SIZE; ++k)
+						{
+							queue.Enqueue(
+								_values[k]
+							);
+						}
+					}
+				}
+			}
+		);
+
+		consumers[i].Start(
+			[&queue, &sum, i]()
+			{
+				uint32 _values[BATCH_SIZE];
+				uint64 _sum = 0;
+
+				for (uint32 j = 0; j < COUNT_PER_THREAD; )
+				{
+					if ((i % 2) == 0)
+					{
+						auto count = queue.DequeueBatch(
+							&_values[0],
+							((COUNT_PER_THREAD - j) < BATCH_SIZE) ? (COUNT_PER_THREAD - j) : BATCH_SIZE
+						);
+
+						for (AL::size_t k = 0; k < count; ++k)
+						{
+							_sum += _values[k];
+						}
+
+						j += static_cast<uint32>(count);
+					}
+					else
+					{
+						queue.Dequeue(
+							_values[0]
+						);
+
+						_sum += _values[0];
+
+						++j;
+					}
+				}
+
+				sum += _sum;
+			}
+		);
+	}
+
+	for (uint32 i = 0; i < THREAD_COUNT; ++i)
+	{
+		producers[i].Join();
+		consumers[i].Join();
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"%lu values passed between %lu producers and %lu consumers in %llums",
+		THREAD_COUNT * COUNT_PER_THREAD,
+		THREAD_COUNT,
+		THREAD_COUNT,
+		timer.GetElapsed().ToMilliseconds()
+	);
+#endif
+
+	auto count = static_cast<uint64>(THREAD_COUNT) * COUNT_PER_THREAD;
+
+	if ((sum != ((count * (count - 1)) / 2)) || !queue.IsEmpty())
+	{
+
+		throw Exception(
+			"Values were lost or duplicated"
+		);
+	}
+}
@@ -1,10 +1,100 @@
 #pragma once
 #include <AL/Common.hpp>
 
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Thread.hpp>
 #include <AL/OS/Console.hpp>
 
 #include <AL/Collections/MPSCQueue.hpp>
 
+template<typename T_QUEUE>
+static void AL_Collections_MPSCQueue_Producers(const char* name)
+{
+	using namespace AL;
+	using namespace AL::Collections;
+
+	static constexpr uint32 THREAD_COUNT     = 4;
+	static constexpr uint32 COUNT_PER_THREAD = 100000;
+	static constexpr uint32 BATCH_SIZE       = 32;
+
+	T_QUEUE queue;
+
+	OS::Thread threads[THREAD_COUNT];
+
+	OS::Timer timer;
+
+	for (uint32 i = 0; i < THREAD_COUNT; ++i)
+	{
+		threads[i].Start(
+			[&queue, i]()
+			{
+				for (uint32 j = 0; j < COUNT_PER_THREAD; ++j)
+				{
+					queue.Enqueue(
+						(i * COUNT_PER_THREAD) + j
+					);
+				}
+			}
+		);
+	}
+
+	uint32 values[BATCH_SIZE];
+	uint64 sum   = 0;
+	uint64 count = 0;
+
+	while (count < (THREAD_COUNT * COUNT_PER_THREAD))
+	{
+		auto dequeued = queue.DequeueBatch(
+			&values[0],
+			BATCH_SIZE
+		);
+
+		for (AL::size_t i = 0; i < dequeued; ++i)
+		{
+			sum += values[i];
+		}
+
+		if (dequeued == 0)
+		{
+			count += queue.DequeueAll(
+				[&sum](uint32&& _value)
+				{
+					sum += _value;
+				}
+			);
+
+			Sleep(
+				TimeSpan::FromMicroseconds(100)
+			);
+		}
+
+		count += dequeued;
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.Join();
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"%s: %llu values in %llums",
+		name,
+		count,
+		timer.GetElapsed().ToMilliseconds()
+	);
+#endif
+
+	if ((sum != ((count * (count - 1)) / 2)) || !queue.IsEmpty() || (queue.GetSize() != 0))
+	{
+
+		throw Exception(
+			"%s: values were lost or duplicated",
+			name
+		);
+	}
+}
+
 // @throw AL::Exception
 static void AL_Collections_MPSCQueue()
 {
@@ -31,4 +121,40 @@ static void AL_Collections_MPSCQueue()
 		);
 #endif
 	}
+
+	// moved from queues remain usable
+	{
+		queue.Enqueue(1);
+
+		MPSCQueue<uint32> queue2(
+			Move(queue)
+		);
+
+		queue.Enqueue(2);
+
+		MPSCQueue<uint32> queue3;
+
+		queue3 = Move(queue);
+		queue  = Move(queue2);
+
+		if (!queue.Dequeue(value) || (value != 1) || !queue3.Dequeue(value) || (value != 2) || !queue2.IsEmpty())
+		{
+
+			throw Exception(
+				"MPSCQueue move failed"
+			);
+		}
+	}
+
+	AL_Collections_MPSCQueue_Producers<MPSCQueue<uint32>>(
+		"MPSCQueue"
+	);
+
+	AL_Collections_MPSCQueue_Producers<MPSCQueue<uint32, True, True>>(
+		"MPSCQueue with node pool"
+	);
+
+	AL_Collections_MPSCQueue_Producers<MPSCQueue<uint32, True, False>>(
+		"MPSCQueue with node pool without size"
+	);
 }
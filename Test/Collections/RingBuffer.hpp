@@ -0,0 +1,143 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Console.hpp>
+
+#include <AL/Collections/RingBuffer.hpp>
+
+// @throw AL::Exception
+static void AL_Collections_RingBuffer()
+{
+	using namespace AL;
+	using namespace AL::Collections;
+
+	RingBuffer buffer(16);
+
+	uint8 values[16];
+	uint8 next = 0;
+	uint8 expected = 0;
+
+	// move the front so the data wraps the end of the buffer
+	for (AL::size_t i = 0; i < 40; ++i)
+	{
+		for (AL::size_t j = 0; j < 5; ++j)
+		{
+			values[j] = next++;
+		}
+
+		if (!buffer.Write(&values[0], 5))
+		{
+
+			throw Exception(
+				"RingBuffer::Write failed with %s bytes free",
+				ToString(buffer.GetFreeSize()).GetCString()
+			);
+		}
+
+		RingBufferSegment segments[2];
+		AL::size_t        segmentCount = buffer.GetReadSegments(segments);
+		AL::size_t        segmentSize  = 0;
+
+		for (AL::size_t j = 0; j < segmentCount; ++j)
+		{
+			for (AL::size_t k = 0; k < segments[j].Size; ++k, ++segmentSize)
+			{
+				if (segments[j].lpBuffer[k] != static_cast<uint8>(expected + segmentSize))
+				{
+
+					throw Exception(
+						"RingBuffer segment contains an unexpected value"
+					);
+				}
+			}
+		}
+
+		if (segmentSize != buffer.GetSize())
+		{
+
+			throw Exception(
+				"RingBuffer segments do not cover the data"
+			);
+		}
+
+		if (!buffer.Read(&values[0], 3))
+		{
+
+			throw Exception(
+				"RingBuffer::Read failed with %s bytes",
+				ToString(buffer.GetSize()).GetCString()
+			);
+		}
+
+		for (AL::size_t j = 0; j < 3; ++j, ++expected)
+		{
+			if (values[j] != expected)
+			{
+
+				throw Exception(
+					"RingBuffer::Read returned an unexpected value"
+				);
+			}
+		}
+
+		if (buffer.GetSize() > 10)
+		{
+
+			buffer.Skip(2);
+			expected += 2;
+		}
+	}
+
+	if (buffer.Write(&values[0], buffer.GetFreeSize() + 1))
+	{
+
+		throw Exception(
+			"RingBuffer::Write exceeded the capacity"
+		);
+	}
+
+	// growing keeps the data in order
+	auto size = buffer.GetSize();
+
+	buffer.SetCapacity(64);
+
+	if ((buffer.GetSize() != size) || !buffer.Peek(&values[0], 1) || (values[0] != expected))
+	{
+
+		throw Exception(
+			"RingBuffer::SetCapacity did not retain the data"
+		);
+	}
+
+	// data written through the write segments
+	RingBufferSegment segments[2];
+	auto              segmentCount = buffer.GetWriteSegments(segments);
+
+	if ((segmentCount == 0) || ((segments[0].Size + ((segmentCount == 2) ? segments[1].Size : 0)) != buffer.GetFreeSize()))
+	{
+
+		throw Exception(
+			"RingBuffer write segments do not cover the free space"
+		);
+	}
+
+	segments[0].lpBuffer[0] = next;
+
+	buffer.Commit(1);
+
+	if (!buffer.Peek(&values[0], 1, size) || (values[0] != next))
+	{
+
+		throw Exception(
+			"RingBuffer::Commit did not append the data"
+		);
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"size = %s, capacity = %s",
+		ToString(buffer.GetSize()).GetCString(),
+		ToString(buffer.GetCapacity()).GetCString()
+	);
+#endif
+}
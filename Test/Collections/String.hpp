@@ -50,4 +50,98 @@ static void AL_Collections_String()
 		string.GetCapacity()
 	);
 #endif
+
+	// strings move between inline and allocated storage
+	{
+		String shortString("N0CALL");
+		String longString("The quick brown fox jumps over the lazy dog");
+
+		shortString.Swap(
+			longString
+		);
+
+		String movedString(
+			Move(longString)
+		);
+
+		movedString.Append(
+			"-9"
+		);
+
+		shortString.Assign(
+			'x',
+			3
+		);
+
+		if ((movedString != "N0CALL-9") || (shortString != "xxx"))
+		{
+
+			throw Exception(
+				"String has unexpected contents"
+			);
+		}
+
+		shortString.Append(
+			movedString.GetCString()
+		);
+
+		for (int i = 0; i < 4; ++i)
+		{
+			shortString.Append(
+				shortString
+			);
+		}
+
+		shortString.SetCapacity(
+			5
+		);
+
+		shortString.ShrinkToFit();
+
+		if ((shortString != "xxxN0") || (shortString.GetSize() != 6))
+		{
+
+			throw Exception(
+				"String has unexpected contents"
+			);
+		}
+	}
+
+	// results too long for the stack buffer are formatted into the string
+	{
+		auto string = String::Format(
+			"%s-%u",
+			"N0CALL",
+			9
+		);
+
+		string.AppendFormat(
+			" %0*u",
+			1000,
+			1
+		);
+
+		auto wstring = WString::Format(
+			L"%ls %0*u",
+			L"N0CALL",
+			1000,
+			1
+		);
+
+		if ((string.GetLength() != 1009) || !string.StartsWith("N0CALL-9 000") || !string.EndsWith("001"))
+		{
+
+			throw Exception(
+				"String::Format has unexpected result"
+			);
+		}
+
+		if ((wstring.GetLength() != 1007) || !wstring.StartsWith(L"N0CALL 000") || !wstring.EndsWith(L"001"))
+		{
+
+			throw Exception(
+				"WString::Format has unexpected result"
+			);
+		}
+	}
 }
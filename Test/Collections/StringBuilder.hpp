@@ -17,6 +17,8 @@ static void AL_Collections_StringBuilder()
 	sb << "Hello" << " world!" << AL::FileSystem::TextFile::LF;
 	sb << 1 << ' ' << 2 << ',' << 3 << AL::FileSystem::TextFile::LF;
 
+	sb.AppendFormat("%s=%i", "value", -1) << AL::FileSystem::TextFile::LF;
+
 	auto string = sb.ToString();
 
 #if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
@@ -24,4 +26,12 @@ static void AL_Collections_StringBuilder()
 		string
 	);
 #endif
+
+	if (!string.EndsWith("value=-1\n"))
+	{
+
+		throw Exception(
+			"StringBuilder::AppendFormat has unexpected result"
+		);
+	}
 }
@@ -0,0 +1,99 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Console.hpp>
+
+#include <AL/Collections/UnorderedSet.hpp>
+
+// @throw AL::Exception
+static void AL_Collections_UnorderedSet()
+{
+	using namespace AL;
+	using namespace AL::Collections;
+
+	UnorderedSet<uint32> odd;
+	UnorderedSet<uint32> all;
+
+	for (uint32 i = 0; i < 100; ++i)
+	{
+		all.Add(
+			i
+		);
+
+		if ((i % 2) != 0)
+		{
+			odd.Add(
+				i
+			);
+		}
+	}
+
+	UnorderedSet<uint32> even(all);
+
+	even.ExceptWith(
+		odd
+	);
+
+	if ((even.GetSize() != 50) || even.Contains(1) || !even.Contains(2))
+	{
+
+		throw Exception(
+			"ExceptWith failed"
+		);
+	}
+
+	UnorderedSet<uint32> none(even);
+
+	none.IntersectWith(
+		odd
+	);
+
+	if (none.GetSize() != 0)
+	{
+
+		throw Exception(
+			"IntersectWith failed"
+		);
+	}
+
+	even.UnionWith(
+		odd
+	);
+
+	if (even != all)
+	{
+
+		throw Exception(
+			"UnionWith failed"
+		);
+	}
+
+	UnorderedSet<String> stations;
+
+	stations.AddRange(
+		{
+			"N0CALL",
+			"N0CALL-1",
+			"N0CALL"
+		}
+	);
+
+	for (auto& station : stations)
+	{
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		OS::Console::WriteLine(
+			"station = %s",
+			station.GetCString()
+		);
+#endif
+	}
+
+	if (stations.GetSize() != 2)
+	{
+
+		throw Exception(
+			"Expected 2 stations, found %lu",
+			stations.GetSize()
+		);
+	}
+}
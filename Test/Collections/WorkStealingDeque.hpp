@@ -0,0 +1,128 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Thread.hpp>
+#include <AL/OS/Console.hpp>
+
+#include <AL/Collections/WorkStealingDeque.hpp>
+
+#include <atomic>
+
+// @throw AL::Exception
+static void AL_Collections_WorkStealingDeque()
+{
+	using namespace AL;
+	using namespace AL::Collections;
+
+	static constexpr uint32 COUNT = 100000;
+
+	WorkStealingDeque<uint32> deque(
+		16
+	);
+
+	for (uint32 i = 0; i < 100; ++i)
+	{
+		deque.Push(
+			i
+		);
+	}
+
+	uint32 value;
+
+	if (!deque.Pop(value) || (value != 99))
+	{
+
+		throw Exception(
+			"Pop did not return the most recently pushed value"
+		);
+	}
+
+	if (!deque.Steal(value) || (value != 0))
+	{
+
+		throw Exception(
+			"Steal did not return the least recently pushed value"
+		);
+	}
+
+	while (deque.Pop(value))
+	{
+	}
+
+	::std::atomic<Bool>   isDone      = False;
+	::std::atomic<uint64> stolen      = 0;
+	::std::atomic<uint32> stolenCount = 0;
+
+	OS::Thread thief;
+
+	thief.Start(
+		[&deque, &isDone, &stolen, &stolenCount]()
+		{
+			uint32 _value;
+
+			while (!isDone || !deque.IsEmpty())
+			{
+				if (deque.Steal(_value))
+				{
+					stolen += _value;
+
+					++stolenCount;
+				}
+			}
+		}
+	);
+
+	uint64 popped      = 0;
+	uint32 poppedCount = 0;
+
+	for (uint32 i = 1; i <= COUNT; ++i)
+	{
+		deque.Push(
+			i
+		);
+
+		if (((i % 3) == 0) && deque.Pop(value))
+		{
+			popped += value;
+
+			++poppedCount;
+		}
+	}
+
+	while (deque.Pop(value))
+	{
+		popped += value;
+
+		++poppedCount;
+	}
+
+	isDone = True;
+
+	thief.Join();
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"Popped %lu, stolen %lu",
+		poppedCount,
+		stolenCount.load()
+	);
+#endif
+
+	if ((poppedCount + stolenCount) != COUNT)
+	{
+
+		throw Exception(
+			"Expected %lu values, got %lu",
+			COUNT,
+			poppedCount + stolenCount
+		);
+	}
+
+	if ((popped + stolen) != ((static_cast<uint64>(COUNT) * (COUNT + 1)) / 2))
+	{
+
+		throw Exception(
+			"Values were lost or duplicated"
+		);
+	}
+}
@@ -0,0 +1,99 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Console.hpp>
+
+enum class AL_Format_Enum : AL::uint8
+{
+	Value = 0x2A
+};
+
+// @throw AL::Exception
+static void AL_Format_Expect(const AL::String& string, const char* lpExpected)
+{
+	if (string != lpExpected)
+	{
+
+		throw AL::Exception(
+			"Expected '%s' but formatted '%s'",
+			lpExpected,
+			string.GetCString()
+		);
+	}
+}
+
+// @throw AL::Exception
+static void AL_Format()
+{
+	using namespace AL;
+
+	AL_Format_Expect(Format("{} {} {}", -42, 42u, "N0CALL"),          "-42 42 N0CALL");
+	AL_Format_Expect(Format("{:x} {:X} {:b} {:o}", 255, 255, 5, 8),    "ff FF 101 10");
+	AL_Format_Expect(Format("{:05} {:>5} {:<5}|", -42, 42, 42),        "-0042    42 42   |");
+	AL_Format_Expect(Format("{:.3f} {:.2e} {}", 1.5, 1500.0, 0.1),     "1.500 1.50e+03 0.1");
+	AL_Format_Expect(Format("{:>8.3}|{:<4}|", String("N0CALL-9"), 'c'), "     N0C|c   |");
+	AL_Format_Expect(Format("{} {:d} {:x}", True, 'A', AL_Format_Enum::Value), "true 65 2a");
+	AL_Format_Expect(Format("{{{}}} }}{{", 1),                          "{1} }{");
+	AL_Format_Expect(Format("no arguments"),                            "no arguments");
+
+	// ToString is converted with std::to_chars
+	AL_Format_Expect(ToString(-128),  "-128");
+	AL_Format_Expect(ToString(18446744073709551615ull), "18446744073709551615");
+	AL_Format_Expect(ToString(1.25),  "1.250000");
+	AL_Format_Expect(ToWString(42).ToString(), "42");
+
+	{
+		StringBuilder sb;
+		sb << "Session ";
+
+		FormatTo(
+			sb,
+			"{} accepted from {}:{}",
+			7,
+			"192.168.1.10",
+			uint16(4000)
+		);
+
+		AL_Format_Expect(sb.ToString(), "Session 7 accepted from 192.168.1.10:4000");
+	}
+
+	{
+		static constexpr uint32 COUNT = 100000;
+
+		OS::Timer   timer;
+		AL::size_t  length = 0;
+
+		for (uint32 i = 0; i < COUNT; ++i)
+		{
+			length += String::Format("[Time: %llu] [Thread: %lu] Session %u accepted from %s:%u", 1700000000ull, 1234ul, i, "192.168.1.10", 4000u).GetLength();
+		}
+
+		auto elapsed = timer.GetElapsed();
+
+		timer.Reset();
+
+		for (uint32 i = 0; i < COUNT; ++i)
+		{
+			length -= Format("[Time: {}] [Thread: {}] Session {} accepted from {}:{}", 1700000000ull, 1234ul, i, "192.168.1.10", 4000u).GetLength();
+		}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		OS::Console::WriteLine(
+			"String::Format x %lu in %lluus, Format x %lu in %lluus",
+			COUNT,
+			elapsed.ToMicroseconds(),
+			COUNT,
+			timer.GetElapsed().ToMicroseconds()
+		);
+#endif
+
+		if (length != 0)
+		{
+
+			throw Exception(
+				"Format and String::Format produced different lengths"
+			);
+		}
+	}
+}
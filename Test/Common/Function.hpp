@@ -1,8 +1,74 @@
 #pragma once
 #include <AL/Common.hpp>
 
+#include <AL/OS/Timer.hpp>
 #include <AL/OS/Console.hpp>
 
+// Constructs, moves and invokes a T_FUNCTION bound to function
+// @param lpState set by function to the address of its captured state
+// @throw AL::Exception
+template<typename T_FUNCTION, typename F>
+static void AL_Function_Benchmark(const char* name, const F& function, const AL::Void*& lpState, AL::Bool isInlineExpected)
+{
+	using namespace AL;
+	using namespace AL::OS;
+
+	static constexpr uint32 ITERATIONS = 100000;
+
+	uint32 result = 0;
+	Bool   isInline;
+	Bool   isStateInline;
+
+	Timer timer;
+
+	for (uint32 i = 0; i < ITERATIONS; ++i)
+	{
+		F _callable(
+			function
+		);
+
+		T_FUNCTION _function(
+			Move(_callable)
+		);
+
+		T_FUNCTION _function2(
+			Move(_function)
+		);
+
+		result  += _function2(i);
+		isInline = _function2.IsInline();
+
+		// callables stored inline are invoked from within the function object instead of the heap
+		auto lpFunctionBegin = reinterpret_cast<const uint8*>(&_function2);
+		auto lpFunctionEnd   = lpFunctionBegin + sizeof(T_FUNCTION);
+
+		isStateInline = (static_cast<const uint8*>(lpState) >= lpFunctionBegin) && (static_cast<const uint8*>(lpState) < lpFunctionEnd);
+	}
+
+	auto elapsed = timer.GetElapsed();
+
+	if ((isInline != isInlineExpected) || (isStateInline != isInlineExpected))
+	{
+
+		throw Exception(
+			"%s was %s, expected %s",
+			name,
+			isStateInline ? "stored inline" : "stored on the heap",
+			isInlineExpected ? "inline" : "heap"
+		);
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	Console::WriteLine(
+		"%s: %lluns/call, %s [result = %lu]",
+		name,
+		static_cast<unsigned long long>(elapsed.ToNanoseconds() / ITERATIONS),
+		isInline ? "inline" : "heap",
+		static_cast<unsigned long>(result)
+	);
+#endif
+}
+
 // @throw AL::Exception
 static void AL_Function()
 {
@@ -21,4 +87,90 @@ static void AL_Function()
 	);
 
 	func();
+
+	struct SmallState
+	{
+		uint32 Value;
+	};
+
+	struct LargeState
+	{
+		uint32 Values[32];
+	};
+
+	SmallState  smallState = { 1 };
+	LargeState  largeState = { { 1 } };
+	const Void* lpState    = nullptr;
+
+	// captured state is addressed through the closure that is being invoked
+	auto smallLambda = [smallState, &lpState](uint32 _i)
+	{
+		lpState = &smallState;
+
+		return _i + smallState.Value;
+	};
+
+	auto largeLambda = [largeState, &lpState](uint32 _i)
+	{
+		lpState = &largeState;
+
+		return _i + largeState.Values[0];
+	};
+
+	AL_Function_Benchmark<Function<uint32(uint32)>>("Function (small)", smallLambda, lpState, True);
+	AL_Function_Benchmark<Function<uint32(uint32)>>("Function (large)", largeLambda, lpState, False);
+
+	AL_Function_Benchmark<UniqueFunction<uint32(uint32)>>("UniqueFunction (small)", smallLambda, lpState, True);
+	AL_Function_Benchmark<UniqueFunction<uint32(uint32)>>("UniqueFunction (large)", largeLambda, lpState, False);
+
+	Function<uint32(uint32)> smallFunction(smallLambda);
+
+	if (!smallFunction.IsInline())
+	{
+
+		throw Exception(
+			"Small callable was not stored inline"
+		);
+	}
+
+	Function<uint32(uint32)> smallFunctionCopy(smallFunction);
+
+	if (smallFunctionCopy(1) != smallFunction(1))
+	{
+
+		throw Exception(
+			"Copy returned a different result"
+		);
+	}
+
+	struct MoveOnlyState
+	{
+		uint32 Value = 2;
+
+		MoveOnlyState()
+		{
+		}
+
+		MoveOnlyState(MoveOnlyState&&) = default;
+		MoveOnlyState(const MoveOnlyState&) = delete;
+	};
+
+	UniqueFunction<uint32(uint32)> uniqueFunction(
+		[state = MoveOnlyState()](uint32 _i)
+		{
+			return _i + state.Value;
+		}
+	);
+
+	UniqueFunction<uint32(uint32)> uniqueFunction2(
+		Move(uniqueFunction)
+	);
+
+	if (uniqueFunction.IsBound() || (uniqueFunction2(1) != 3))
+	{
+
+		throw Exception(
+			"UniqueFunction move failed"
+		);
+	}
 }
@@ -0,0 +1,111 @@
+#pragma once
+#include <AL/Common.hpp>
+#include <AL/Common/Future.hpp>
+
+#include <AL/OS/Thread.hpp>
+#include <AL/OS/Console.hpp>
+
+// @throw AL::Exception
+static void AL_Future()
+{
+	using namespace AL;
+	using namespace AL::OS;
+
+	Promise<uint32> promise;
+	auto            future = promise.GetFuture();
+
+	auto future2 = future.Then(
+		[](uint32 _value)
+		{
+			return _value * 2;
+		}
+	);
+
+	auto future3 = future2.Then(
+		[](uint32 _value)
+		{
+			if (_value != 84)
+			{
+
+				throw Exception(
+					"Expected 84, got %lu",
+					_value
+				);
+			}
+		}
+	);
+
+	Thread thread;
+
+	thread.Start(
+		[promise = Move(promise)]() mutable
+		{
+			Sleep(
+				TimeSpan::FromMilliseconds(10)
+			);
+
+			promise.SetValue(
+				42
+			);
+		}
+	);
+
+	future3.Get();
+
+	thread.Join();
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	Console::WriteLine(
+		"Then chain completed"
+	);
+#endif
+
+	Future<Void> brokenFuture;
+
+	{
+		Promise<Void> brokenPromise;
+
+		brokenFuture = brokenPromise.GetFuture();
+	}
+
+	String brokenPromiseMessages[2];
+
+	// every Get throws the same exception
+	for (auto& brokenPromiseMessage : brokenPromiseMessages)
+	{
+		try
+		{
+			brokenFuture.Get();
+		}
+		catch (Exception& exception)
+		{
+			brokenPromiseMessage = exception.GetMessage();
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+			Console::WriteLine(
+				"Broken Promise threw: %s",
+				exception.GetMessage().GetCString()
+			);
+#endif
+		}
+	}
+
+	if ((brokenPromiseMessages[0].GetLength() == 0) || (brokenPromiseMessages[1] != brokenPromiseMessages[0]))
+	{
+
+		throw Exception(
+			"Broken Promise did not throw on every Get"
+		);
+	}
+
+	Promise<uint32> timeoutPromise;
+	auto            timeoutFuture = timeoutPromise.GetFuture();
+
+	if (timeoutFuture.Wait(TimeSpan::FromMilliseconds(1)))
+	{
+
+		throw Exception(
+			"Wait did not time out"
+		);
+	}
+}
@@ -0,0 +1,187 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Thread.hpp>
+#include <AL/OS/Console.hpp>
+
+// @throw AL::Exception
+static void AL_Regex()
+{
+	using namespace AL;
+
+	{
+		Regex::MatchCollection matches;
+
+		if (!Regex::Match(matches, "^([^>]+)>([^,]+),([^:]+):(.+)$", "N0CALL>APRS,TCPIP*:>status") || (matches.GetSize() != 5) || (matches[1] != "N0CALL") || (matches[4] != ">status"))
+		{
+
+			throw Exception(
+				"Regex::Match failed"
+			);
+		}
+
+		if (!Regex::IsMatch(String("\\d+"), "12345") || Regex::IsMatch(String("\\d+"), "123a"))
+		{
+
+			throw Exception(
+				"Regex::IsMatch failed"
+			);
+		}
+
+		if (!RegexW::IsMatch(WString(L"^(true|false)$"), L"true"))
+		{
+
+			throw Exception(
+				"RegexW::IsMatch failed"
+			);
+		}
+	}
+
+	{
+		StaticRegex<"^HTTP\\/(\\d\\.\\d) (\\d+) ([a-zA-Z ]+)$">::MatchCollection matches;
+
+		if (!StaticRegex<"^HTTP\\/(\\d\\.\\d) (\\d+) ([a-zA-Z ]+)$">::Match(matches, "HTTP/1.1 200 OK") || (matches[2] != "200"))
+		{
+
+			throw Exception(
+				"StaticRegex::Match failed"
+			);
+		}
+
+		if (!StaticRegex<L"^0x[0-9A-Fa-f]+$">::IsMatch(L"0x2A"))
+		{
+
+			throw Exception(
+				"StaticRegex::IsMatch failed"
+			);
+		}
+
+		if (&StaticRegex<"\\d+">::GetRegex() != &StaticRegex<"\\d+">::GetRegex())
+		{
+
+			throw Exception(
+				"StaticRegex compiled more than once"
+			);
+		}
+	}
+
+	{
+		Bool isThrown = False;
+
+		try
+		{
+			Regex::IsMatch(
+				String("([unterminated"),
+				"value"
+			);
+		}
+		catch (const Exception&)
+		{
+			isThrown = True;
+		}
+
+		if (!isThrown)
+		{
+
+			throw Exception(
+				"Regex::IsMatch accepted an invalid pattern"
+			);
+		}
+	}
+
+	// evicts the least recently used patterns while another thread matches a cached one
+	{
+		static constexpr uint32 COUNT = 500;
+
+		Bool isMatched = True;
+
+		OS::Thread thread;
+
+		thread.Start(
+			[&isMatched]()
+			{
+				for (uint32 i = 0; i < COUNT; ++i)
+				{
+					if (!Regex::IsMatch(String("^[A-Z0-9]{1,6}$"), "N0CALL"))
+					{
+
+						isMatched = False;
+					}
+				}
+			}
+		);
+
+		for (uint32 i = 0; i < COUNT; ++i)
+		{
+			if (!Regex::IsMatch(String::Format("^%u$", i), ToString(i)))
+			{
+
+				throw Exception(
+					"Regex::IsMatch failed after eviction"
+				);
+			}
+		}
+
+		thread.Join();
+
+		if (!isMatched)
+		{
+
+			throw Exception(
+				"Regex::IsMatch failed on another thread"
+			);
+		}
+	}
+
+	{
+		static constexpr uint32 COUNT = 1000;
+
+		static constexpr const char PATTERN[] = "^([^:]+):(\\/\\/([^\\/]+))(\\/\\S*?)$";
+
+		OS::Timer timer;
+		uint32    count = 0;
+
+		for (uint32 i = 0; i < COUNT; ++i)
+		{
+			Regex::MatchCollection matches;
+
+			if (_Regex<String>(PATTERN).Match(matches, "https://example.com/path?query#fragment"))
+			{
+				++count;
+			}
+		}
+
+		auto elapsed = timer.GetElapsed();
+
+		timer.Reset();
+
+		for (uint32 i = 0; i < COUNT; ++i)
+		{
+			Regex::MatchCollection matches;
+
+			if (Regex::Match(matches, PATTERN, "https://example.com/path?query#fragment"))
+			{
+				--count;
+			}
+		}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		OS::Console::WriteLine(
+			"Regex x %lu in %lluus, cached Regex x %lu in %lluus",
+			COUNT,
+			elapsed.ToMicroseconds(),
+			COUNT,
+			timer.GetElapsed().ToMicroseconds()
+		);
+#endif
+
+		if (count != 0)
+		{
+
+			throw Exception(
+				"Cached and uncached patterns matched differently"
+			);
+		}
+	}
+}
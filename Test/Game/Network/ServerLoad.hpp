@@ -0,0 +1,266 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Console.hpp>
+
+#include <AL/Collections/Array.hpp>
+
+#include <AL/Game/Network/Server.hpp>
+
+#if defined(AL_PLATFORM_LINUX)
+	#include <sys/resource.h>
+#endif
+
+enum class AL_Game_Network_ServerLoad_OPCodes : AL::uint8
+{
+	Ping
+};
+
+typedef AL::Game::Network::Server<AL_Game_Network_ServerLoad_OPCodes> AL_Game_Network_ServerLoad_Server;
+typedef typename AL_Game_Network_ServerLoad_Server::Session           AL_Game_Network_ServerLoad_Session;
+typedef typename AL_Game_Network_ServerLoad_Session::Packet           AL_Game_Network_ServerLoad_Packet;
+
+// Opens up to 10k loopback clients and measures the cost of Server::Update
+// @throw AL::Exception
+static void AL_Game_Network_ServerLoad()
+{
+	using namespace AL;
+	using namespace AL::Game;
+	using namespace AL::Game::Network;
+
+	constexpr AL::size_t CLIENT_COUNT          = 10000;
+	constexpr AL::size_t CLIENT_BATCH_SIZE     = 128;
+	constexpr AL::size_t TICK_COUNT            = 100;
+	// clients sending a packet each active tick
+	constexpr AL::size_t CLIENT_ACTIVE_DIVISOR = 100;
+
+#if defined(AL_PLATFORM_LINUX)
+	// idle sessions are not touched by Update
+	constexpr ServerUpdateModes UPDATE_MODE = ServerUpdateModes::Readiness;
+#else
+	constexpr ServerUpdateModes UPDATE_MODE = ServerUpdateModes::Tick;
+#endif
+
+	IPEndPoint ep
+	{
+		.Host = IPAddress::Loopback(),
+		.Port = 10011
+	};
+
+	auto clientCount = CLIENT_COUNT;
+
+#if defined(AL_PLATFORM_LINUX)
+	// every client holds 2 handles, one per side of the connection
+	::rlimit limit;
+
+	if (::getrlimit(RLIMIT_NOFILE, &limit) == 0)
+	{
+		if (limit.rlim_cur < limit.rlim_max)
+		{
+			limit.rlim_cur = limit.rlim_max;
+
+			::setrlimit(
+				RLIMIT_NOFILE,
+				&limit
+			);
+		}
+
+		if ((limit.rlim_cur != RLIM_INFINITY) && (((limit.rlim_cur - 256) / 2) < clientCount))
+		{
+
+			clientCount = (limit.rlim_cur - 256) / 2;
+		}
+	}
+#endif
+
+	AL::size_t          packetCount   = 0;
+	ServerSessionHandle sessionHandle = 0;
+
+	AL_Game_Network_ServerLoad_Server server(
+		0xFF,
+		0xFF,
+		0,
+		UPDATE_MODE
+	);
+
+	server.OnAccept.Register(
+		[](Socket& _socket)
+		{
+			return True;
+		}
+	);
+
+	server.OnConnected.Register(
+		[&packetCount, &sessionHandle](AL_Game_Network_ServerLoad_Session& _session)
+		{
+			if (sessionHandle == 0)
+			{
+
+				sessionHandle = _session.GetHandle();
+			}
+
+			_session.SetPacketHandler(
+				AL_Game_Network_ServerLoad_OPCodes::Ping,
+				[&packetCount](AL_Game_Network_ServerLoad_Packet& __packet)
+				{
+					++packetCount;
+				}
+			);
+		}
+	);
+
+	server.Listen(
+		ep,
+		Socket::BACKLOG_MAX
+	);
+
+	Collections::Array<Socket*> clients(
+		clientCount
+	);
+
+	clients.Fill(
+		nullptr
+	);
+
+	OS::Timer timer;
+
+	for (AL::size_t i = 0; i < clientCount; )
+	{
+		for (AL::size_t j = 0; (j < CLIENT_BATCH_SIZE) && (i < clientCount); ++j, ++i)
+		{
+			auto lpClient = new Socket(
+				ep.Host.GetFamily()
+			);
+
+			clients[i] = lpClient;
+
+			lpClient->Open();
+
+			if (!lpClient->Connect(ep))
+			{
+
+				throw Exception(
+					"Error connecting client %s",
+					ToString(i).GetCString()
+				);
+			}
+		}
+
+		while (server.GetSessionCount() < i)
+		{
+			server.Update(
+				TimeSpan::Zero
+			);
+		}
+	}
+
+	auto connectTime = timer.GetElapsed();
+
+	if (auto lpSession = server.GetSession(sessionHandle); (lpSession == nullptr) || (lpSession->GetHandle() != sessionHandle))
+	{
+
+		throw Exception(
+			"Server::GetSession did not return the session"
+		);
+	}
+
+	// idle
+	timer.Reset();
+
+	for (AL::size_t i = 0; i < TICK_COUNT; ++i)
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	auto idleTime = timer.GetElapsed();
+
+	// active
+	AL_Game_Network_ServerLoad_Packet packet(
+		AL_Game_Network_ServerLoad_OPCodes::Ping,
+		0
+	);
+
+	packet.Finalize();
+
+	AL::size_t packetSentCount = 0;
+	TimeSpan   activeTime;
+
+	for (AL::size_t i = 0; i < TICK_COUNT; ++i)
+	{
+		for (AL::size_t j = i % CLIENT_ACTIVE_DIVISOR; j < clientCount; j += CLIENT_ACTIVE_DIVISOR, ++packetSentCount)
+		{
+			AL::size_t numberOfBytesSent;
+
+			SocketExtensions::SendAll(
+				*clients[j],
+				packet.GetBuffer(),
+				packet.GetBufferSize(),
+				numberOfBytesSent
+			);
+		}
+
+		timer.Reset();
+
+		server.Update(
+			TimeSpan::Zero
+		);
+
+		activeTime += timer.GetElapsed();
+	}
+
+	for (timer.Reset(); (packetCount < packetSentCount) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)); )
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	if (packetCount != packetSentCount)
+	{
+
+		throw Exception(
+			"Server routed %s of %s packets",
+			ToString(packetCount).GetCString(),
+			ToString(packetSentCount).GetCString()
+		);
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"%s clients connected in %sms, Update: %sus idle, %sus with %s packets per tick",
+		ToString(clientCount).GetCString(),
+		ToString(connectTime.ToMilliseconds()).GetCString(),
+		ToString(idleTime.ToMicroseconds() / TICK_COUNT).GetCString(),
+		ToString(activeTime.ToMicroseconds() / TICK_COUNT).GetCString(),
+		ToString(packetSentCount / TICK_COUNT).GetCString()
+	);
+#endif
+
+	for (auto lpClient : clients)
+	{
+		lpClient->Close();
+
+		delete lpClient;
+	}
+
+	for (timer.Reset(); (server.GetSessionCount() != 0) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)); )
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	if ((server.GetSessionCount() != 0) || (server.GetSession(sessionHandle) != nullptr))
+	{
+
+		throw Exception(
+			"Server did not release %s disconnected session(s)",
+			ToString(server.GetSessionCount()).GetCString()
+		);
+	}
+
+	server.Shutdown();
+}
@@ -0,0 +1,279 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Console.hpp>
+
+#include <AL/Collections/Array.hpp>
+#include <AL/Collections/ArrayList.hpp>
+
+#include <AL/Game/Network/Server.hpp>
+
+enum class AL_Game_Network_ServerSend_OPCodes : AL::uint8
+{
+	State
+};
+
+typedef AL::Game::Network::Server<AL_Game_Network_ServerSend_OPCodes> AL_Game_Network_ServerSend_Server;
+typedef typename AL_Game_Network_ServerSend_Server::Session           AL_Game_Network_ServerSend_Session;
+typedef typename AL_Game_Network_ServerSend_Session::Packet           AL_Game_Network_ServerSend_Packet;
+
+// Broadcasts small packets every tick and disconnects a client that stops receiving
+// @throw AL::Exception
+static void AL_Game_Network_ServerSend()
+{
+	using namespace AL;
+	using namespace AL::Game;
+	using namespace AL::Game::Network;
+
+	constexpr AL::size_t CLIENT_COUNT      = 256;
+	constexpr AL::size_t TICK_COUNT        = 20;
+	constexpr AL::size_t TICK_PACKET_COUNT = 20;
+	// send buffer size limit of the client that stops receiving
+	constexpr AL::size_t SLOW_CLIENT_LIMIT = 0x10000;
+
+	IPEndPoint ep
+	{
+		.Host = IPAddress::Loopback(),
+		.Port = 10013
+	};
+
+	AL::size_t                                  disconnectedCount = 0;
+	Collections::ArrayList<ServerSessionHandle> sessionHandles;
+
+	AL_Game_Network_ServerSend_Server server(
+		0xFF,
+		0xFF
+	);
+
+	server.OnAccept.Register(
+		[](Socket& _socket)
+		{
+			return True;
+		}
+	);
+
+	server.OnConnected.Register(
+		[&sessionHandles](AL_Game_Network_ServerSend_Session& _session)
+		{
+			sessionHandles.PushBack(
+				_session.GetHandle()
+			);
+		}
+	);
+
+	server.OnDisconnected.Register(
+		[&disconnectedCount](AL_Game_Network_ServerSend_Session& _session)
+		{
+			++disconnectedCount;
+		}
+	);
+
+	server.Listen(
+		ep,
+		Socket::BACKLOG_MAX
+	);
+
+	Collections::Array<Socket*> clients(
+		CLIENT_COUNT
+	);
+
+	for (auto& lpClient : clients)
+	{
+		lpClient = new Socket(
+			ep.Host.GetFamily()
+		);
+
+		lpClient->Open();
+
+		if (!lpClient->Connect(ep))
+		{
+
+			throw Exception(
+				"Error connecting to %s:%u",
+				ep.Host.ToString().GetCString(),
+				ep.Port
+			);
+		}
+	}
+
+	OS::Timer timer;
+
+	while ((server.GetSessionCount() < CLIENT_COUNT) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)))
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	if (server.GetSessionCount() != CLIENT_COUNT)
+	{
+
+		throw Exception(
+			"Server accepted %s of %s clients",
+			ToString(server.GetSessionCount()).GetCString(),
+			ToString(CLIENT_COUNT).GetCString()
+		);
+	}
+
+	// packets sent during a tick are flushed together by Update
+	AL_Game_Network_ServerSend_Packet packet(
+		AL_Game_Network_ServerSend_OPCodes::State,
+		sizeof(uint32)
+	);
+
+	packet.Write<uint32>(
+		0x12345678
+	);
+
+	packet.Finalize();
+
+	TimeSpan sendTime;
+
+	for (AL::size_t i = 0; i < TICK_COUNT; ++i)
+	{
+		timer.Reset();
+
+		for (AL::size_t j = 0; j < TICK_PACKET_COUNT; ++j)
+		{
+			for (auto handle : sessionHandles)
+			{
+				server.GetSession(handle)->Send(
+					packet
+				);
+			}
+		}
+
+		server.Update(
+			TimeSpan::Zero
+		);
+
+		sendTime += timer.GetElapsed();
+	}
+
+	for (auto handle : sessionHandles)
+	{
+		auto& statistics = server.GetSession(handle)->GetSendStatistics();
+
+		if ((statistics.QueuedBytes != 0) || (statistics.QueuedBytesMaximum != (TICK_PACKET_COUNT * packet.GetBufferSize())) || (statistics.FlushCount != TICK_COUNT))
+		{
+
+			throw Exception(
+				"Session queued %s bytes at most and flushed %s times",
+				ToString(statistics.QueuedBytesMaximum).GetCString(),
+				ToString(statistics.FlushCount).GetCString()
+			);
+		}
+	}
+
+	Collections::Array<uint8> buffer(
+		TICK_COUNT * TICK_PACKET_COUNT * packet.GetBufferSize()
+	);
+
+	for (auto lpClient : clients)
+	{
+		AL::size_t numberOfBytesReceived;
+
+		if (!SocketExtensions::ReceiveAll(*lpClient, &buffer[0], buffer.GetCapacity(), numberOfBytesReceived))
+		{
+
+			throw Exception(
+				"Client did not receive %s bytes",
+				ToString(buffer.GetCapacity()).GetCString()
+			);
+		}
+
+		for (AL::size_t i = 0; i < buffer.GetCapacity(); i += packet.GetBufferSize())
+		{
+			if (memcmp(&buffer[i], packet.GetBuffer(), packet.GetBufferSize()) != 0)
+			{
+
+				throw Exception(
+					"Client received an unexpected packet"
+				);
+			}
+		}
+	}
+
+	// slow client
+	AL_Game_Network_ServerSend_Packet largePacket(
+		AL_Game_Network_ServerSend_OPCodes::State,
+		0x1000
+	);
+
+	for (AL::size_t i = 0; i < (0x1000 / sizeof(uint64)); ++i)
+	{
+		largePacket.Write<uint64>(
+			i
+		);
+	}
+
+	largePacket.Finalize();
+
+	server.GetSession(sessionHandles[0])->SetSendBufferSizeLimit(
+		SLOW_CLIENT_LIMIT
+	);
+
+	AL::size_t largePacketCount = 0;
+
+	// the socket buffers fill up first
+	for (timer.Reset(); (server.GetSession(sessionHandles[0]) != nullptr) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)); ++largePacketCount)
+	{
+		server.GetSession(sessionHandles[0])->Send(
+			largePacket
+		);
+
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	// OnDisconnected is executed by the next update
+	server.Update(
+		TimeSpan::Zero
+	);
+
+	if ((server.GetSession(sessionHandles[0]) != nullptr) || (disconnectedCount != 1) || (server.GetSessionCount() != (CLIENT_COUNT - 1)))
+	{
+
+		throw Exception(
+			"Server did not disconnect the slow client"
+		);
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"%s clients, %s packets per tick, Update: %sus, slow client disconnected after %s packets",
+		ToString(CLIENT_COUNT).GetCString(),
+		ToString(TICK_PACKET_COUNT).GetCString(),
+		ToString(sendTime.ToMicroseconds() / TICK_COUNT).GetCString(),
+		ToString(largePacketCount).GetCString()
+	);
+#endif
+
+	for (auto lpClient : clients)
+	{
+		lpClient->Close();
+
+		delete lpClient;
+	}
+
+	for (timer.Reset(); (server.GetSessionCount() != 0) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)); )
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	if ((server.GetSessionCount() != 0) || (disconnectedCount != CLIENT_COUNT))
+	{
+
+		throw Exception(
+			"Server released %s of %s session(s)",
+			ToString(disconnectedCount).GetCString(),
+			ToString(CLIENT_COUNT).GetCString()
+		);
+	}
+
+	server.Shutdown();
+}
@@ -0,0 +1,260 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Console.hpp>
+
+#include <AL/Collections/Array.hpp>
+#include <AL/Collections/ArrayList.hpp>
+
+#include <AL/Game/Network/Server.hpp>
+
+enum class AL_Game_Network_ServerShard_OPCodes : AL::uint8
+{
+	Ping, Pong
+};
+
+typedef AL::Game::Network::Server<AL_Game_Network_ServerShard_OPCodes> AL_Game_Network_ServerShard_Server;
+typedef typename AL_Game_Network_ServerShard_Server::Session           AL_Game_Network_ServerShard_Session;
+typedef typename AL_Game_Network_ServerShard_Session::Packet           AL_Game_Network_ServerShard_Packet;
+
+// @throw AL::Exception
+static void AL_Game_Network_ServerShard()
+{
+#if defined(AL_PLATFORM_LINUX)
+	using namespace AL;
+	using namespace AL::Game;
+	using namespace AL::Game::Network;
+
+	constexpr AL::size_t SHARD_COUNT  = 4;
+	constexpr AL::size_t CLIENT_COUNT = 16;
+	constexpr AL::size_t PACKET_COUNT = 4;
+
+	IPEndPoint ep
+	{
+		.Host = IPAddress::Loopback(),
+		.Port = 10012
+	};
+
+	AL::size_t                                  packetCount       = 0;
+	AL::size_t                                  disconnectedCount = 0;
+	Collections::ArrayList<ServerSessionHandle> sessionHandles;
+
+	AL_Game_Network_ServerShard_Packet pong(
+		AL_Game_Network_ServerShard_OPCodes::Pong,
+		0
+	);
+
+	pong.Finalize();
+
+	AL_Game_Network_ServerShard_Server server(
+		0xFF,
+		0xFF,
+		SHARD_COUNT
+	);
+
+	server.OnAccept.Register(
+		[](Socket& _socket)
+		{
+			return True;
+		}
+	);
+
+	server.OnConnected.Register(
+		[&packetCount, &sessionHandles, &pong](AL_Game_Network_ServerShard_Session& _session)
+		{
+			sessionHandles.PushBack(
+				_session.GetHandle()
+			);
+
+			_session.SetPacketHandler(
+				AL_Game_Network_ServerShard_OPCodes::Ping,
+				[&_session, &packetCount, &pong](AL_Game_Network_ServerShard_Packet& __packet)
+				{
+					++packetCount;
+
+					_session.Send(
+						pong
+					);
+				}
+			);
+		}
+	);
+
+	server.OnDisconnected.Register(
+		[&disconnectedCount](AL_Game_Network_ServerShard_Session& _session)
+		{
+			++disconnectedCount;
+		}
+	);
+
+	server.Listen(
+		ep,
+		Socket::BACKLOG_MAX
+	);
+
+	Collections::Array<Socket*> clients(
+		CLIENT_COUNT
+	);
+
+	for (auto& lpClient : clients)
+	{
+		lpClient = new Socket(
+			ep.Host.GetFamily()
+		);
+
+		lpClient->Open();
+
+		if (!lpClient->Connect(ep))
+		{
+
+			throw Exception(
+				"Error connecting to %s:%u",
+				ep.Host.ToString().GetCString(),
+				ep.Port
+			);
+		}
+	}
+
+	OS::Timer timer;
+
+	while ((server.GetSessionCount() < CLIENT_COUNT) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)))
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	if (server.GetSessionCount() != CLIENT_COUNT)
+	{
+
+		throw Exception(
+			"Server accepted %s of %s clients",
+			ToString(server.GetSessionCount()).GetCString(),
+			ToString(CLIENT_COUNT).GetCString()
+		);
+	}
+
+	// packets are framed by the shards and routed by Update
+	AL_Game_Network_ServerShard_Packet ping(
+		AL_Game_Network_ServerShard_OPCodes::Ping,
+		0
+	);
+
+	ping.Finalize();
+
+	for (auto lpClient : clients)
+	{
+		for (AL::size_t i = 0; i < PACKET_COUNT; ++i)
+		{
+			AL::size_t numberOfBytesSent;
+
+			SocketExtensions::SendAll(
+				*lpClient,
+				ping.GetBuffer(),
+				ping.GetBufferSize(),
+				numberOfBytesSent
+			);
+		}
+	}
+
+	for (timer.Reset(); (packetCount < (CLIENT_COUNT * PACKET_COUNT)) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)); )
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	if (packetCount != (CLIENT_COUNT * PACKET_COUNT))
+	{
+
+		throw Exception(
+			"Server routed %s of %s packets",
+			ToString(packetCount).GetCString(),
+			ToString(CLIENT_COUNT * PACKET_COUNT).GetCString()
+		);
+	}
+
+	// replies are handed to the shards by the Update that routed the packet
+	Collections::Array<uint8> buffer(
+		pong.GetBufferSize() * PACKET_COUNT
+	);
+
+	for (auto lpClient : clients)
+	{
+		AL::size_t numberOfBytesReceived;
+
+		if (!SocketExtensions::ReceiveAll(*lpClient, &buffer[0], buffer.GetCapacity(), numberOfBytesReceived))
+		{
+
+			throw Exception(
+				"Client did not receive %s Pong packet(s)",
+				ToString(PACKET_COUNT).GetCString()
+			);
+		}
+
+		for (AL::size_t i = 0; i < PACKET_COUNT; ++i)
+		{
+			if (memcmp(&buffer[i * pong.GetBufferSize()], pong.GetBuffer(), pong.GetBufferSize()) != 0)
+			{
+
+				throw Exception(
+					"Client received an unexpected packet"
+				);
+			}
+		}
+	}
+
+	for (auto lpClient : clients)
+	{
+
+		lpClient->Close();
+	}
+
+	// disconnected by the clients
+	for (timer.Reset(); (server.GetSessionCount() != 0) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)); )
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	if ((server.GetSessionCount() != 0) || (disconnectedCount != CLIENT_COUNT))
+	{
+
+		throw Exception(
+			"Server released %s of %s session(s)",
+			ToString(disconnectedCount).GetCString(),
+			ToString(CLIENT_COUNT).GetCString()
+		);
+	}
+
+	for (auto handle : sessionHandles)
+	{
+		if (server.GetSession(handle) != nullptr)
+		{
+
+			throw Exception(
+				"Server::GetSession returned a released session"
+			);
+		}
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"%s clients, %s shards, %s packets routed",
+		ToString(CLIENT_COUNT).GetCString(),
+		ToString(SHARD_COUNT).GetCString(),
+		ToString(packetCount).GetCString()
+	);
+#endif
+
+	for (auto lpClient : clients)
+	{
+
+		delete lpClient;
+	}
+
+	server.Shutdown();
+#endif
+}
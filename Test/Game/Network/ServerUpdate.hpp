@@ -0,0 +1,120 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+
+#include <AL/Game/Network/Server.hpp>
+
+enum class AL_Game_Network_ServerUpdate_OPCodes : AL::uint8
+{
+	Ping
+};
+
+typedef AL::Game::Network::Server<AL_Game_Network_ServerUpdate_OPCodes> AL_Game_Network_ServerUpdate_Server;
+typedef typename AL_Game_Network_ServerUpdate_Server::Session           AL_Game_Network_ServerUpdate_Session;
+
+// Updates an idle session every tick and disconnects it once OnUpdate returns false
+// @throw AL::Exception
+static void AL_Game_Network_ServerUpdate()
+{
+	using namespace AL;
+	using namespace AL::Game;
+	using namespace AL::Game::Network;
+
+	constexpr AL::size_t TICK_COUNT = 10;
+
+	// the server closes the connection, which would leave a fixed port in TIME_WAIT
+	IPEndPoint ep
+	{
+		.Host = IPAddress::Loopback(),
+		.Port = 0
+	};
+
+	AL::size_t updateCount = 0;
+
+	AL_Game_Network_ServerUpdate_Server server(
+		0xFF,
+		0xFF
+	);
+
+	server.OnAccept.Register(
+		[](Socket& _socket)
+		{
+			return True;
+		}
+	);
+
+	server.OnConnected.Register(
+		[&updateCount](AL_Game_Network_ServerUpdate_Session& _session)
+		{
+			_session.OnUpdate.Register(
+				[&updateCount](TimeSpan _delta)
+				{
+					return ++updateCount < TICK_COUNT;
+				}
+			);
+		}
+	);
+
+	server.Listen(
+		ep,
+		Socket::BACKLOG_MAX
+	);
+
+	ep = server.GetLocalEndPoint();
+
+	Socket client(
+		ep.Host.GetFamily()
+	);
+
+	client.Open();
+
+	if (!client.Connect(ep))
+	{
+
+		throw Exception(
+			"Error connecting to %s:%u",
+			ep.Host.ToString().GetCString(),
+			ep.Port
+		);
+	}
+
+	OS::Timer timer;
+
+	while ((server.GetSessionCount() == 0) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)))
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	if (server.GetSessionCount() != 1)
+	{
+
+		throw Exception(
+			"Server did not accept the client"
+		);
+	}
+
+	// the client never sends anything
+	for (AL::size_t i = 0; (i < (TICK_COUNT + 1)) && (server.GetSessionCount() != 0); ++i)
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	if ((updateCount != TICK_COUNT) || (server.GetSessionCount() != 0))
+	{
+
+		throw Exception(
+			"Idle session updated %s of %s time(s)",
+			ToString(updateCount).GetCString(),
+			ToString(TICK_COUNT).GetCString()
+		);
+	}
+
+	client.Close();
+
+	server.Shutdown();
+}
@@ -0,0 +1,224 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Console.hpp>
+
+#include <AL/Collections/Array.hpp>
+#include <AL/Collections/ArrayList.hpp>
+
+#include <AL/Game/Network/Server.hpp>
+
+enum class AL_Game_Network_SessionReceive_OPCodes : AL::uint8
+{
+	State
+};
+
+typedef AL::Game::Network::Server<AL_Game_Network_SessionReceive_OPCodes> AL_Game_Network_SessionReceive_Server;
+typedef typename AL_Game_Network_SessionReceive_Server::Session           AL_Game_Network_SessionReceive_Session;
+typedef typename AL_Game_Network_SessionReceive_Session::Packet           AL_Game_Network_SessionReceive_Packet;
+
+// Streams packets of varying size through a receive buffer smaller than most of them
+// @throw AL::Exception
+static void AL_Game_Network_SessionReceive()
+{
+	using namespace AL;
+	using namespace AL::Game;
+	using namespace AL::Game::Network;
+
+	constexpr AL::size_t PACKET_COUNT     = 200;
+	constexpr AL::size_t PACKET_SIZE_MAX  = 0x3000;
+	constexpr AL::size_t CLIENT_SEND_SIZE = 1000;
+
+	IPEndPoint ep
+	{
+		.Host = IPAddress::Loopback(),
+		.Port = 10015
+	};
+
+	AL::size_t                            packetCount = 0;
+	AL_Game_Network_SessionReceive_Packet firstPacket;
+
+	AL_Game_Network_SessionReceive_Server server(
+		0x40,
+		0x40
+	);
+
+	server.OnAccept.Register(
+		[](Socket& _socket)
+		{
+			return True;
+		}
+	);
+
+	server.OnConnected.Register(
+		[&packetCount, &firstPacket](AL_Game_Network_SessionReceive_Session& _session)
+		{
+			_session.SetPacketHandler(
+				AL_Game_Network_SessionReceive_OPCodes::State,
+				[&packetCount, &firstPacket](AL_Game_Network_SessionReceive_Packet& __packet)
+				{
+					uint32 index;
+
+					if (!__packet.Read(index) || (index != packetCount) || (__packet.GetSize() != (sizeof(uint32) + ((index * 397) % PACKET_SIZE_MAX))))
+					{
+
+						throw Exception(
+							"Packet %s received out of order",
+							ToString(packetCount).GetCString()
+						);
+					}
+
+					for (AL::size_t i = sizeof(uint32); i < __packet.GetSize(); ++i)
+					{
+						uint8 value;
+
+						if (!__packet.Read(value) || (value != static_cast<uint8>(index + i)))
+						{
+
+							throw Exception(
+								"Packet %s contains unexpected data",
+								ToString(index).GetCString()
+							);
+						}
+					}
+
+					// packets are only valid during the handler unless copied
+					if (index == 1)
+					{
+
+						firstPacket = __packet;
+					}
+
+					++packetCount;
+				}
+			);
+		}
+	);
+
+	server.Listen(
+		ep,
+		Socket::BACKLOG_MAX
+	);
+
+	Collections::ArrayList<uint8> stream;
+
+	for (AL::size_t i = 0; i < PACKET_COUNT; ++i)
+	{
+		auto size = (i * 397) % PACKET_SIZE_MAX;
+
+		AL_Game_Network_SessionReceive_Packet packet(
+			AL_Game_Network_SessionReceive_OPCodes::State,
+			static_cast<uint16>(sizeof(uint32) + size)
+		);
+
+		packet.Write<uint32>(
+			static_cast<uint32>(i)
+		);
+
+		for (AL::size_t j = sizeof(uint32); j < (sizeof(uint32) + size); ++j)
+		{
+			packet.Write<uint8>(
+				static_cast<uint8>(i + j)
+			);
+		}
+
+		packet.Finalize();
+
+		for (AL::size_t j = 0; j < packet.GetBufferSize(); ++j)
+		{
+			stream.PushBack(
+				reinterpret_cast<const uint8*>(packet.GetBuffer())[j]
+			);
+		}
+	}
+
+	Socket client(
+		ep.Host.GetFamily()
+	);
+
+	client.Open();
+
+	if (!client.Connect(ep))
+	{
+
+		throw Exception(
+			"Error connecting to %s:%u",
+			ep.Host.ToString().GetCString(),
+			ep.Port
+		);
+	}
+
+	OS::Timer timer;
+
+	while ((server.GetSessionCount() == 0) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)))
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	// uneven chunks move the packets across the end of the receive buffer
+	for (AL::size_t i = 0; i < stream.GetSize(); i += CLIENT_SEND_SIZE)
+	{
+		AL::size_t numberOfBytesSent;
+
+		SocketExtensions::SendAll(
+			client,
+			&stream[i],
+			((stream.GetSize() - i) < CLIENT_SEND_SIZE) ? (stream.GetSize() - i) : CLIENT_SEND_SIZE,
+			numberOfBytesSent
+		);
+
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	for (timer.Reset(); (packetCount < PACKET_COUNT) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)); )
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	if ((packetCount != PACKET_COUNT) || (server.GetSessionCount() != 1))
+	{
+
+		throw Exception(
+			"Server routed %s of %s packets",
+			ToString(packetCount).GetCString(),
+			ToString(PACKET_COUNT).GetCString()
+		);
+	}
+
+	// the receive buffer has been reused many times since
+	auto lpFirstPacketData = &reinterpret_cast<const uint8*>(firstPacket.GetBuffer())[firstPacket.GetBufferSize() - firstPacket.GetSize()];
+
+	if (firstPacket.IsView() || (firstPacket.GetSize() != (sizeof(uint32) + 397)) || (lpFirstPacketData[firstPacket.GetSize() - 1] != static_cast<uint8>(1 + firstPacket.GetSize() - 1)))
+	{
+
+		throw Exception(
+			"Copied packet does not own its data"
+		);
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"%s packets, %s bytes",
+		ToString(packetCount).GetCString(),
+		ToString(stream.GetSize()).GetCString()
+	);
+#endif
+
+	client.Close();
+
+	for (timer.Reset(); (server.GetSessionCount() != 0) && (timer.GetElapsed() < TimeSpan::FromSeconds(10)); )
+	{
+		server.Update(
+			TimeSpan::Zero
+		);
+	}
+
+	server.Shutdown();
+}
@@ -0,0 +1,289 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Thread.hpp>
+#include <AL/OS/Console.hpp>
+
+#include <AL/Network/TcpSocket.hpp>
+#include <AL/Network/SocketPoller.hpp>
+
+// @throw AL::Exception
+static void AL_Network_SocketPoller()
+{
+	using namespace AL;
+	using namespace AL::Network;
+
+	IPEndPoint ep
+	{
+		.Host = IPAddress::Loopback(),
+		.Port = 10010
+	};
+
+	SocketPoller poller;
+	poller.Open();
+
+	TcpSocket listener(
+		ep.Host.GetFamily()
+	);
+
+	listener.Open();
+	listener.Bind(ep);
+	listener.Listen(TcpSocket::BACKLOG_MAX);
+	listener.SetBlocking(False);
+
+	TcpSocket client(
+		ep.Host.GetFamily()
+	);
+
+	TcpSocket session(
+		ep.Host.GetFamily()
+	);
+
+	client.Open();
+
+	uint8      buffer[0x1000];
+	AL::size_t numberOfBytes;
+	AL::size_t numberOfBytesReceived = 0;
+	Bool       isHangUp              = False;
+
+	poller.OnReady.Register(
+		[&poller, &listener, &session, &buffer, &numberOfBytes, &numberOfBytesReceived, &isHangUp](ISocket& socket, SocketPollerEvents events)
+		{
+			if (&socket != &listener)
+			{
+
+				throw Exception(
+					"OnReady executed for a socket added with a handler"
+				);
+			}
+
+			if (!listener.Accept(session))
+			{
+
+				return;
+			}
+
+			poller.Add(
+				session,
+				SocketPollerEvents::Read | SocketPollerEvents::HangUp,
+				SocketPollerModes::Edge,
+				[&poller, &session, &buffer, &numberOfBytes, &numberOfBytesReceived, &isHangUp](ISocket& _socket, SocketPollerEvents _events)
+				{
+					// edge triggered sockets must be drained
+					while (session.IsOpen() && session.Receive(&buffer[0], sizeof(buffer), numberOfBytes) && (numberOfBytes != 0))
+					{
+
+						numberOfBytesReceived += numberOfBytes;
+					}
+
+					if (BitMask<SocketPollerEvents>::IsSet(_events, SocketPollerEvents::HangUp))
+					{
+						isHangUp = True;
+
+						poller.Remove(
+							session
+						);
+
+						session.Close();
+					}
+				}
+			);
+		}
+	);
+
+	poller.Add(
+		listener,
+		SocketPollerEvents::Read
+	);
+
+	if (!client.Connect(ep))
+	{
+
+		throw Exception(
+			"Error connecting to %s:%u",
+			ep.Host.ToString().GetCString(),
+			ep.Port
+		);
+	}
+
+	poller.Poll(
+		TimeSpan::FromSeconds(5)
+	);
+
+	if (!session.IsOpen() || !poller.Contains(session))
+	{
+
+		throw Exception(
+			"SocketPoller did not report the pending connection"
+		);
+	}
+
+	memset(
+		&buffer[0],
+		0xAA,
+		sizeof(buffer)
+	);
+
+	for (AL::size_t i = 0; i < 4; ++i)
+	{
+		client.Send(
+			&buffer[0],
+			sizeof(buffer),
+			numberOfBytes
+		);
+	}
+
+	OS::Timer timer;
+
+	while ((numberOfBytesReceived < (4 * sizeof(buffer))) && (timer.GetElapsed() < TimeSpan::FromSeconds(5)))
+	{
+		poller.Poll(
+			TimeSpan::FromMilliseconds(100)
+		);
+	}
+
+	if (numberOfBytesReceived != (4 * sizeof(buffer)))
+	{
+
+		throw Exception(
+			"Received %s of %s bytes",
+			ToString(numberOfBytesReceived).GetCString(),
+			ToString(4 * sizeof(buffer)).GetCString()
+		);
+	}
+
+	// timers
+	AL::size_t timerCount = 0;
+	AL::size_t onceCount  = 0;
+
+	poller.StartTimer(
+		TimeSpan::FromMilliseconds(5),
+		True,
+		[&poller, &timerCount](SocketPollerTimer _timer)
+		{
+			if (++timerCount == 3)
+			{
+
+				poller.StopTimer(_timer);
+			}
+		}
+	);
+
+	auto onceTimer = poller.StartTimer(
+		TimeSpan::FromMilliseconds(1),
+		False,
+		[&onceCount](SocketPollerTimer _timer)
+		{
+			++onceCount;
+		}
+	);
+
+	auto stoppedTimer = poller.StartTimer(
+		TimeSpan::FromMilliseconds(1),
+		False,
+		[](SocketPollerTimer _timer)
+		{
+			throw Exception(
+				"Stopped timer executed"
+			);
+		}
+	);
+
+	poller.StopTimer(
+		stoppedTimer
+	);
+
+	timer.Reset();
+
+	while ((poller.GetTimerCount() != 0) && (timer.GetElapsed() < TimeSpan::FromSeconds(5)))
+	{
+		// timers bound the wait
+		poller.Poll();
+	}
+
+	if ((timerCount != 3) || (onceCount != 1) || poller.StopTimer(onceTimer))
+	{
+
+		throw Exception(
+			"Timers executed %s and %s times",
+			ToString(timerCount).GetCString(),
+			ToString(onceCount).GetCString()
+		);
+	}
+
+	// cross thread wakeup
+	AL::size_t wakeupCount = 0;
+
+	poller.OnWakeup.Register(
+		[&wakeupCount]()
+		{
+			++wakeupCount;
+		}
+	);
+
+	OS::Thread thread;
+
+	thread.Start(
+		[&poller]()
+		{
+			Sleep(
+				TimeSpan::FromMilliseconds(10)
+			);
+
+			poller.Wakeup();
+		}
+	);
+
+	timer.Reset();
+
+	poller.Poll(
+		TimeSpan::FromSeconds(5)
+	);
+
+	thread.Join();
+
+	if ((wakeupCount != 1) || (timer.GetElapsed() >= TimeSpan::FromSeconds(5)))
+	{
+
+		throw Exception(
+			"SocketPoller::Wakeup did not interrupt Poll"
+		);
+	}
+
+	// hang up
+	client.Close();
+
+	timer.Reset();
+
+	while (!isHangUp && (timer.GetElapsed() < TimeSpan::FromSeconds(5)))
+	{
+		poller.Poll(
+			TimeSpan::FromMilliseconds(100)
+		);
+	}
+
+	if (!isHangUp || (poller.GetSocketCount() != 1))
+	{
+
+		throw Exception(
+			"SocketPoller did not report the closed connection"
+		);
+	}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	OS::Console::WriteLine(
+		"Received %s bytes, %s timer executions",
+		ToString(numberOfBytesReceived).GetCString(),
+		ToString(timerCount + onceCount).GetCString()
+	);
+#endif
+
+	poller.Remove(
+		listener
+	);
+
+	listener.Close();
+
+	poller.Close();
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Console.hpp>
+#include <AL/OS/Parallel.hpp>
+
+#include <AL/Collections/Array.hpp>
+#include <AL/Collections/ArrayList.hpp>
+
+// @throw AL::Exception
+static void AL_OS_Parallel()
+{
+	using namespace AL;
+	using namespace AL::OS;
+
+	static constexpr uint32 COUNT = 1000000;
+
+	ThreadPool pool(
+		4
+	);
+
+	pool.Start();
+
+	Collections::Array<uint32> array(
+		COUNT
+	);
+
+	Timer timer;
+
+	Parallel::For(
+		pool,
+		array,
+		[](uint32& _value)
+		{
+			_value = 1;
+		}
+	);
+
+	Parallel::For(
+		pool,
+		0,
+		COUNT,
+		[&array](AL::size_t _index)
+		{
+			array[_index] += static_cast<uint32>(_index);
+		}
+	);
+
+	auto sum = Parallel::Reduce(
+		pool,
+		array,
+		uint64(0),
+		[](uint64 _sum, uint32 _value)
+		{
+			return _sum + _value;
+		},
+		[](uint64 _sum1, uint64 _sum2)
+		{
+			return _sum1 + _sum2;
+		}
+	);
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	Console::WriteLine(
+		"Parallel For/Reduce over %lu values in %lluus",
+		COUNT,
+		timer.GetElapsed().ToMicroseconds()
+	);
+#endif
+
+	if (sum != (COUNT + ((static_cast<uint64>(COUNT) * (COUNT - 1)) / 2)))
+	{
+
+		throw Exception(
+			"Parallel::Reduce returned %llu",
+			sum
+		);
+	}
+
+	Collections::ArrayList<uint32> arrayList;
+
+	for (uint32 i = 0; i < 1000; ++i)
+	{
+		arrayList.PushBack(
+			i
+		);
+	}
+
+	auto max = Parallel::Reduce(
+		pool,
+		arrayList,
+		uint32(0),
+		[](uint32 _max, uint32 _value)
+		{
+			return (_value > _max) ? _value : _max;
+		},
+		[](uint32 _max1, uint32 _max2)
+		{
+			return (_max1 > _max2) ? _max1 : _max2;
+		},
+		16
+	);
+
+	if (max != 999)
+	{
+
+		throw Exception(
+			"Parallel::Reduce returned %lu",
+			max
+		);
+	}
+
+	Bool isExceptionForwarded = False;
+
+	try
+	{
+		Parallel::For(
+			pool,
+			0,
+			100,
+			[](AL::size_t _index)
+			{
+				if (_index == 50)
+				{
+
+					throw Exception(
+						"Index 50"
+					);
+				}
+			},
+			1
+		);
+	}
+	catch (Exception&)
+	{
+
+		isExceptionForwarded = True;
+	}
+
+	if (!isExceptionForwarded)
+	{
+
+		throw Exception(
+			"Parallel::For did not forward exception"
+		);
+	}
+
+	pool.Stop();
+}
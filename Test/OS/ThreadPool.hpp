@@ -1,9 +1,12 @@
 #pragma once
 #include <AL/Common.hpp>
 
+#include <AL/OS/Timer.hpp>
 #include <AL/OS/Console.hpp>
 #include <AL/OS/ThreadPool.hpp>
 
+#include <atomic>
+
 // @throw AL::Exception
 static void AL_OS_ThreadPool()
 {
@@ -48,5 +51,144 @@ static void AL_OS_ThreadPool()
 		);
 	}
 
+	// dispatch latency from an idle pool
+	{
+		static constexpr uint32 ITERATIONS = 100;
+
+		Sleep(
+			TimeSpan::FromMilliseconds(20)
+		);
+
+		TimeSpan latencyTotal;
+		TimeSpan latencyMaximum;
+
+		for (uint32 i = 0; i < ITERATIONS; ++i)
+		{
+			::std::atomic<Bool> isExecuted = False;
+
+			Timer timer;
+
+			pool.Post(
+				[&isExecuted]()
+				{
+					isExecuted = True;
+				}
+			);
+
+			while (!isExecuted)
+			{
+			}
+
+			auto latency = timer.GetElapsed();
+
+			latencyTotal += latency;
+
+			if (latency > latencyMaximum)
+			{
+
+				latencyMaximum = latency;
+			}
+		}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		Console::WriteLine(
+			"Dispatch latency: %lluus average, %lluus maximum",
+			latencyTotal.ToMicroseconds() / ITERATIONS,
+			latencyMaximum.ToMicroseconds()
+		);
+#endif
+	}
+
+	// burst of tasks posting more tasks from the workers
+	{
+		static constexpr uint32 TASK_COUNT    = 10000;
+		static constexpr uint32 SUBTASK_COUNT = 4;
+
+		::std::atomic<uint32> count = 0;
+
+		Timer timer;
+
+		for (uint32 i = 0; i < TASK_COUNT; ++i)
+		{
+			pool.Post(
+				[&pool, &count]()
+				{
+					for (uint32 j = 0; j < SUBTASK_COUNT; ++j)
+					{
+						pool.Post(
+							[&count]()
+							{
+								++count;
+							}
+						);
+					}
+
+					++count;
+				}
+			);
+		}
+
+		while (count != (TASK_COUNT * (SUBTASK_COUNT + 1)))
+		{
+			Sleep(
+				TimeSpan::FromMilliseconds(1)
+			);
+		}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		Console::WriteLine(
+			"Executed %lu tasks in %llums",
+			count.load(),
+			timer.GetElapsed().ToMilliseconds()
+		);
+#endif
+	}
+
+	// results and completion
+	{
+		auto future = pool.Submit(
+			[](uint32 _a, uint32 _b)
+			{
+				return _a + _b;
+			},
+			1,
+			2
+		);
+
+		if (future.Get() != 3)
+		{
+
+			throw Exception(
+				"Submit returned wrong result"
+			);
+		}
+
+		::std::atomic<uint32> count = 0;
+
+		TaskGroup group(
+			pool
+		);
+
+		for (uint32 i = 0; i < 100; ++i)
+		{
+			group.Post(
+				[&count]()
+				{
+					++count;
+				}
+			);
+		}
+
+		group.Wait();
+
+		if (count != 100)
+		{
+
+			throw Exception(
+				"TaskGroup::Wait returned before every task completed"
+			);
+		}
+	}
+
 	pool.Stop();
 }
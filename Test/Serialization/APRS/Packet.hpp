@@ -0,0 +1,271 @@
+#pragma once
+#include <AL/Common.hpp>
+
+#include <AL/OS/Timer.hpp>
+#include <AL/OS/Console.hpp>
+
+#include <AL/Serialization/APRS/Packet.hpp>
+
+struct AL_Serialization_APRS_Packet_Fields
+{
+	AL::String                            Path;
+	AL::String                            IGate;
+	AL::String                            ToCall;
+	AL::String                            Sender;
+	AL::String                            Content;
+	AL::Serialization::APRS::QConstructs QConstruct = AL::Serialization::APRS::QConstructs::None;
+};
+
+// Splits and validates a path the way Packet did before it stopped using Regex
+static bool AL_Serialization_APRS_Packet_Regex_Path(AL::String& path, const AL::String& value)
+{
+	using namespace AL;
+
+	auto chunks = value.Split(
+		','
+	);
+
+	if (chunks.GetSize() > 8)
+	{
+
+		return false;
+	}
+
+	for (auto& chunk : chunks)
+	{
+		if (!Math::IsInRange<AL::size_t>(chunk.GetLength(), 2, 9))
+		{
+
+			return false;
+		}
+	}
+
+	path = value;
+
+	if (path.EndsWith(','))
+	{
+
+		path.Erase(path.GetLength() - 1);
+	}
+
+	return true;
+}
+
+// Parses value the way Packet did before it stopped using Regex
+static bool AL_Serialization_APRS_Packet_Regex(AL_Serialization_APRS_Packet_Fields& fields, const AL::String& value)
+{
+	using namespace AL;
+	using namespace AL::Serialization::APRS;
+
+	Regex::MatchCollection matches;
+
+	if (!Regex::Match(matches, "^([^>]{3,9})>([^,]+),([^:]+):(.+)$", value))
+	{
+
+		return false;
+	}
+
+	if (!Math::IsInRange<AL::size_t>(matches[2].GetLength(), 2, 9))
+	{
+
+		return false;
+	}
+
+	fields.IGate.Clear();
+	fields.Sender     = Move(matches[1]);
+	fields.ToCall     = Move(matches[2]);
+	fields.Content    = Move(matches[4]);
+	fields.QConstruct = QConstructs::None;
+
+	if (Regex::Match(matches, "^((\\S+?(?=,qA\\w)),(qA\\w),(.+))|(\\S+)$", String(matches[3])))
+	{
+		if (matches[5].GetLength() == 0)
+		{
+			if (!Math::IsInRange<AL::size_t>(matches[4].GetLength(), 2, 9))
+			{
+
+				return false;
+			}
+
+			fields.IGate = Move(matches[4]);
+
+			if (!AL_Serialization_APRS_Packet_Regex_Path(fields.Path, matches[2]))
+			{
+
+				return false;
+			}
+
+			if (!QConstruct_FromString(fields.QConstruct, matches[3]))
+			{
+
+				return false;
+			}
+		}
+		else if (!AL_Serialization_APRS_Packet_Regex_Path(fields.Path, matches[5]))
+		{
+
+			return false;
+		}
+	}
+	else if (!AL_Serialization_APRS_Packet_Regex_Path(fields.Path, matches[3]))
+	{
+
+		return false;
+	}
+
+	return true;
+}
+
+// @throw AL::Exception
+static void AL_Serialization_APRS_Packet()
+{
+	using namespace AL;
+	using namespace AL::Serialization::APRS;
+
+	// captured from an APRS-IS full feed
+	static constexpr const char* FEED[] =
+	{
+		"N0CALL-9>APRS,WIDE1-1,WIDE2-1,qAR,W1AW-10:!4903.50N/07201.75W-Test 001",
+		"KD6ABC>APDR16,TCPIP*,qAC,T2SOCAL:=3404.61N/11824.91W$ https://aprsdroid.org/",
+		"DL1ABC-7>T4SR3W,DB0ABC*,WIDE2-1,qAR,DO2XYZ-10:`|Q$l!`>/'\"4K}|!6'A'|!w4N!|3",
+		"EW1234>APRS,TCPXX*,qAX,CWOP-5:@181200z4903.50N/07201.75W_220/004g005t077r000p000P000h50b09900wRSW",
+		"W1AW>APWW11,TCPIP*,qAC,T2BOSTON::BLN1     :Net tonight at 2000 local",
+		"VK2XYZ-13>APMI06,WIDE2-2,qAo,VK2RHR:T#005,199,000,255,073,123,01101001",
+		"JA1ZZZ>APRS,TCPIP*,qAS,JA1ZZZ:>Status text",
+		"OH7AAA-1>APRX29,TCPIP*,qAC,T2FINLAND:!6250.00NR02718.00E&Rx-only iGate",
+		"G4ABC>APU25N,WIDE1-1,qAU,G4ABC-10:;LEADVILLE*092345z3903.50N/10615.75W-",
+		"N0CALL>APRS,TCPIP*:>no q construct",
+		"N0CALL>APRS,WIDE1-1 WIDE2-1:path with a space",
+		"N0CALL>APRS,WIDE1-1 :path ending with a space",
+		"N0CALL>APRS,A,B,C,D,E,F,G,H,I:too many hops",
+		"N0CALL>APRS,WIDE1-1,,WIDE2-1:empty hop",
+		"N0CALL>APRS,WIDE1-1,:trailing comma",
+		"N0CALL>APRS,WIDE1-1,qAQ,IGATE:unknown q construct",
+		"N0CALL>APRS,WIDE1-1,qAR,IGATE-TOO-LONG:long igate",
+		"N0CALL>APRS,qAR,IGATE:no path before q construct",
+		"N0CALL>APRS,WIDE1-1,qAR,I:short igate",
+		"N0CALL>APRS,WIDE1-1,qARX,IGATE:long q construct",
+		"N0CALL>APRS,WIDE1-1,qAR,IGATE:line\r",
+		"N0CALL>APRS,WIDE1-1:",
+		"NO>APRS,WIDE1-1:short sender",
+		"N0CALL-100>APRS,WIDE1-1:long sender",
+		"N0CALL>A,WIDE1-1:short tocall",
+		"N0CALL>,WIDE1-1:empty tocall",
+		"N0CALL>APRS,:empty path",
+		"N0CALL>APRS",
+		"",
+		"# aprsc 2.1.14-g5e22b37"
+	};
+
+	for (auto lpLine : FEED)
+	{
+		String                              line(lpLine);
+		PacketView                          view;
+		AL_Serialization_APRS_Packet_Fields fields;
+
+		auto isParsed = Packet::Parse(
+			view,
+			line
+		);
+
+		if (isParsed != AL_Serialization_APRS_Packet_Regex(fields, line))
+		{
+
+			throw Exception(
+				"Packet::Parse %s '%s'",
+				isParsed ? "accepted" : "rejected",
+				lpLine
+			);
+		}
+
+		if (isParsed)
+		{
+			auto packet = Packet::FromString(
+				line
+			);
+
+			if ((packet.GetSender() != fields.Sender) || (packet.GetToCall() != fields.ToCall) || (DigiPath_ToString(packet.GetPath()) != fields.Path) ||
+				(packet.GetIGate() != fields.IGate) || (packet.GetQConstruct() != fields.QConstruct) || (packet.GetContent() != fields.Content))
+			{
+
+				throw Exception(
+					"Packet::FromString parsed '%s' differently",
+					lpLine
+				);
+			}
+
+			if (view.Sender.GetBuffer() != line.GetCString())
+			{
+
+				throw Exception(
+					"PacketView does not point into the parsed line"
+				);
+			}
+		}
+	}
+
+	{
+		static constexpr uint32 COUNT = 20;
+
+		Collections::Array<String> lines(
+			sizeof(FEED) / sizeof(FEED[0])
+		);
+
+		for (AL::size_t i = 0; i < lines.GetSize(); ++i)
+		{
+			lines[i] = FEED[i];
+		}
+
+		AL::size_t count = 0;
+
+		OS::Timer timer;
+
+		for (uint32 i = 0; i < COUNT; ++i)
+		{
+			for (auto& line : lines)
+			{
+				AL_Serialization_APRS_Packet_Fields fields;
+
+				if (AL_Serialization_APRS_Packet_Regex(fields, line))
+				{
+					++count;
+				}
+			}
+		}
+
+		auto elapsed = timer.GetElapsed();
+
+		timer.Reset();
+
+		for (uint32 i = 0; i < COUNT; ++i)
+		{
+			for (auto& line : lines)
+			{
+				PacketView view;
+
+				if (Packet::Parse(view, line))
+				{
+					--count;
+				}
+			}
+		}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		OS::Console::WriteLine(
+			"Regex x %lu in %lluus, Packet::Parse x %lu in %lluus",
+			COUNT * lines.GetSize(),
+			elapsed.ToMicroseconds(),
+			COUNT * lines.GetSize(),
+			timer.GetElapsed().ToMicroseconds()
+		);
+#endif
+
+		if (count != 0)
+		{
+
+			throw Exception(
+				"Regex and Packet::Parse accepted a different number of packets"
+			);
+		}
+	}
+}
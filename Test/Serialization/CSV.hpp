@@ -1,8 +1,13 @@
 #pragma once
 #include <AL/Common.hpp>
 
+#include <AL/OS/Timer.hpp>
 #include <AL/OS/Console.hpp>
 
+#include <AL/OS/ThreadPool.hpp>
+
+#include <AL/FileSystem/File.hpp>
+
 #include <AL/Serialization/CSV.hpp>
 
 // @throw AL::Exception
@@ -32,4 +37,551 @@ static void AL_Serialization_CSV()
 		csv.ToString()
 	);
 #endif
+
+	// most fields are short enough to be stored inline
+	{
+		static constexpr AL::size_t LINE_COUNT = 2000;
+
+		OS::Timer timer;
+
+		CSV<String, String, String> csv;
+
+		for (AL::size_t i = 0; i < LINE_COUNT; ++i)
+		{
+			csv.Add(
+				"N0CALL-9",
+				ToString(i),
+				"1,2,3,4"
+			);
+		}
+
+		decltype(csv)::FromString(
+			csv,
+			csv.ToString()
+		);
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		OS::Console::WriteLine(
+			"CSV x %llu lines in %llums",
+			LINE_COUNT,
+			timer.GetElapsed().ToMilliseconds()
+		);
+#endif
+
+		if ((csv.GetLineCount() != LINE_COUNT) || (csv.Get<1>(LINE_COUNT - 1) != ToString(LINE_COUNT - 1)))
+		{
+
+			throw Exception(
+				"CSV has unexpected contents"
+			);
+		}
+	}
+
+	// quoted fields, line endings and blank lines
+	{
+		static constexpr const char DOCUMENT[] =
+			"name,id,value\r\n"
+			"\"a,b\",1,2.5\r\n"
+			"\r\n"
+			"\"say \"\"hi\"\"\",2,-1\n"
+			"\"two\nlines\",3,0\n"
+			"plain,4,1e3";
+
+		CSV<String, uint32, Double> csv;
+
+		decltype(csv)::FromString(
+			csv,
+			DOCUMENT,
+			1
+		);
+
+		if ((csv.GetLineCount() != 4) ||
+			(csv.Get<0>(0) != "a,b") || (csv.Get<1>(0) != 1) || (csv.Get<2>(0) != 2.5) ||
+			(csv.Get<0>(1) != "say \"hi\"") || (csv.Get<2>(1) != -1) ||
+			(csv.Get<0>(2) != "two\nlines") || (csv.Get<1>(2) != 3) ||
+			(csv.Get<0>(3) != "plain") || (csv.Get<2>(3) != 1000))
+		{
+
+			throw Exception(
+				"CSV::FromString read the wrong values"
+			);
+		}
+
+		decltype(csv) csv2;
+
+		decltype(csv)::FromString(
+			csv2,
+			csv.ToString()
+		);
+
+		if (csv2.ToString() != csv.ToString())
+		{
+
+			throw Exception(
+				"CSV::FromString did not read CSV::ToString"
+			);
+		}
+
+		static constexpr const char* INVALID[] =
+		{
+			"\"a,1,2\n",
+			"\"a\"b,1,2\n",
+			"a,1\n",
+			"a,1,2,3\n"
+		};
+
+		for (auto lpString : INVALID)
+		{
+			try
+			{
+				decltype(csv)::FromString(
+					csv2,
+					lpString
+				);
+			}
+			catch (const Exception&)
+			{
+
+				continue;
+			}
+
+			throw Exception(
+				"CSV::FromString accepted '%s'",
+				lpString
+			);
+		}
+
+		// a LF without CR is part of the field, a CR before LF is part of the field
+		decltype(csv)::FromString(
+			csv,
+			"a\nb,1,2\r\nc,3,4\r\n",
+			0,
+			TextLineEndings::CRLF
+		);
+
+		decltype(csv)::FromString(
+			csv2,
+			"a\r,1,2\n\"c\",3,4\n",
+			0,
+			TextLineEndings::LF
+		);
+
+		if ((csv.GetLineCount() != 2) || (csv.Get<0>(0) != "a\nb") || (csv.Get<0>(1) != "c") ||
+			(csv2.GetLineCount() != 2) || (csv2.Get<0>(0) != "a\r") || (csv2.Get<0>(1) != "c"))
+		{
+
+			throw Exception(
+				"CSV::FromString ignored lineEnding"
+			);
+		}
+	}
+
+	// skipped lines are raw lines, whatever their column count or quotes
+	{
+		struct Document
+		{
+			const char* lpString;
+			AL::size_t  LineSkip;
+		};
+
+		static constexpr Document DOCUMENTS[] =
+		{
+			{ "# exported 2026-01-01\nname,age\nbob,3\n", 2 },
+			{ "name,age,extra\r\nbob,3\r\n",             1 },
+			{ "title \"x\nname,age\nbob,3\n",             2 }
+		};
+
+		OS::ThreadPool pool(
+			1
+		);
+
+		pool.Start();
+
+		for (auto& document : DOCUMENTS)
+		{
+			CSV<String, uint32> csv;
+			CSV<String, uint32> csv2;
+
+			try
+			{
+				decltype(csv)::FromString(
+					csv,
+					document.lpString,
+					document.LineSkip
+				);
+
+				decltype(csv)::FromString(
+					csv2,
+					pool,
+					document.lpString,
+					document.LineSkip
+				);
+			}
+			catch (const Exception&)
+			{
+				pool.Stop();
+
+				throw;
+			}
+
+			if ((csv.GetLineCount() != 1) || (csv.Get<0>(0) != "bob") || (csv.Get<1>(0) != 3) || (csv2.ToString() != csv.ToString()))
+			{
+				pool.Stop();
+
+				throw Exception(
+					"CSV::FromString did not skip %llu line(s) of '%s'",
+					static_cast<unsigned long long>(document.LineSkip),
+					document.lpString
+				);
+			}
+		}
+
+		pool.Stop();
+	}
+
+	// an output that stops accepting bytes fails instead of spinning
+	{
+		struct Output
+		{
+			AL::size_t Capacity;
+
+			AL::size_t Write(const Void*, AL::size_t size)
+			{
+				size = (size < Capacity) ? size : Capacity;
+
+				Capacity -= size;
+
+				return size;
+			}
+		};
+
+		Output output = { 0x100 };
+		Bool   isThrown = False;
+
+		try
+		{
+			CSVWriter<Output> writer(output);
+
+			writer.Write(
+				String('x', 0x10000)
+			);
+
+			writer.Flush();
+		}
+		catch (const Exception&)
+		{
+			isThrown = True;
+		}
+
+		if (!isThrown || (output.Capacity != 0))
+		{
+
+			throw Exception(
+				"CSVWriter did not fail on a full output"
+			);
+		}
+	}
+
+	// blank lines are skipped whatever the field count
+	{
+		CSV<String> csv;
+
+		decltype(csv)::FromString(
+			csv,
+			"a\n\n\"\"\r\n\r\n\"b\"\"\"\"c\"\n"
+		);
+
+		if ((csv.GetLineCount() != 3) || (csv.Get<0>(0) != "a") || (csv.Get<0>(1) != "") || (csv.Get<0>(2) != "b\"\"c"))
+		{
+
+			throw Exception(
+				"CSV<String>::FromString read %llu lines",
+				static_cast<unsigned long long>(csv.GetLineCount())
+			);
+		}
+	}
+
+	// records cross the read buffer and one is larger than it
+	{
+		static constexpr AL::size_t LINE_COUNT = 20000;
+
+		// line LINE_COUNT / 2 is larger than the read buffer
+		auto GetName = [](AL::size_t line)
+		{
+			if (line == (LINE_COUNT / 2))
+			{
+
+				return String(
+					'x',
+					0x30000
+				);
+			}
+
+			return String::Format(
+				"line \"%llu\"",
+				line
+			);
+		};
+
+		FileSystem::File file(
+			"./csv.tmp"
+		);
+
+		file.Open(
+			FileSystem::FileOpenModes::Write | FileSystem::FileOpenModes::Truncate
+		);
+
+		{
+			CSVWriter<FileSystem::File> writer(file);
+
+			for (AL::size_t i = 0; i < LINE_COUNT; ++i)
+			{
+				writer.Write(
+					GetName(i),
+					static_cast<uint64>(i),
+					WString(L"value")
+				);
+			}
+
+			writer.Flush();
+		}
+
+		file.Close();
+
+		file.Open(
+			FileSystem::FileOpenModes::Read
+		);
+
+		OS::Timer timer;
+
+		CSVReader<String, uint64, WString> reader(
+			file
+		);
+
+		decltype(reader)::Row row;
+
+		AL::size_t lineCount = 0;
+
+		while (reader.Read(row))
+		{
+			if ((row.Get<0>() != GetName(lineCount)) || (row.Get<1>() != lineCount) || (row.Get<2>() != L"value"))
+			{
+				file.Close();
+				file.Delete();
+
+				throw Exception(
+					"CSVReader read the wrong values at line %llu",
+					lineCount
+				);
+			}
+
+			++lineCount;
+		}
+
+		auto elapsed = timer.GetElapsed();
+
+		file.Close();
+		file.Delete();
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		OS::Console::WriteLine(
+			"CSVReader<File> x %llu lines in %lluus",
+			lineCount,
+			elapsed.ToMicroseconds()
+		);
+#endif
+
+		if (lineCount != LINE_COUNT)
+		{
+
+			throw Exception(
+				"CSVReader read %llu of %llu lines",
+				lineCount,
+				LINE_COUNT
+			);
+		}
+	}
+
+	// parallel parsing matches sequential parsing at every pool size
+	{
+		static constexpr AL::size_t LINE_COUNT = 50000;
+
+		StringBuilder sb;
+
+		sb << "name,id,value\n";
+
+		for (AL::size_t i = 0; i < LINE_COUNT; ++i)
+		{
+			// quoted line endings and quotes make every chunk boundary quote aware
+			if ((i % 7) == 0)
+				sb << "\"multi\nline, \"\"" << i << "\"\"\"," << i << "," << (i * 0.5) << "\r\n";
+			else
+				sb << "\"N0CALL-" << i << "\"," << i << "," << (i * 0.5) << "\n";
+		}
+
+		auto string = sb.ToString();
+
+		typedef CSV<String, uint64, Double> T_CSV;
+
+		T_CSV csv;
+
+		OS::Timer timer;
+
+		T_CSV::FromString(
+			csv,
+			string,
+			1
+		);
+
+		auto elapsed = timer.GetElapsed();
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+		OS::Console::WriteLine(
+			"CSV::FromString x %llu lines (%llu bytes) in %lluus",
+			LINE_COUNT,
+			string.GetLength(),
+			elapsed.ToMicroseconds()
+		);
+#endif
+
+		if ((csv.GetLineCount() != LINE_COUNT) || (csv.Get<1>(LINE_COUNT - 1) != (LINE_COUNT - 1)))
+		{
+
+			throw Exception(
+				"CSV::FromString read %llu lines",
+				csv.GetLineCount()
+			);
+		}
+
+		auto expected = csv.ToString();
+
+		for (AL::size_t threadCount = 1; threadCount <= 16; threadCount *= 2)
+		{
+			OS::ThreadPool pool(
+				threadCount
+			);
+
+			pool.Start();
+
+			T_CSV csv2;
+
+			timer.Reset();
+
+			T_CSV::FromString(
+				csv2,
+				pool,
+				string,
+				1
+			);
+
+			elapsed = timer.GetElapsed();
+
+			pool.Stop();
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+			OS::Console::WriteLine(
+				"CSV::FromString x %llu lines on %llu thread(s) in %lluus",
+				LINE_COUNT,
+				threadCount,
+				elapsed.ToMicroseconds()
+			);
+#endif
+
+			if (csv2.ToString() != expected)
+			{
+
+				throw Exception(
+					"CSV::FromString on %llu thread(s) read different lines",
+					threadCount
+				);
+			}
+		}
+
+		OS::ThreadPool pool(
+			2
+		);
+
+		pool.Start();
+
+		// a LF without CR is part of the field when lineEnding is CRLF, chunks must not be split on it
+		{
+			StringBuilder sb;
+
+			for (AL::size_t i = 0; i < LINE_COUNT; ++i)
+			{
+				sb << "N0CALL\n-" << i << "," << i << "," << (i * 0.5) << "\r\n";
+			}
+
+			auto string = sb.ToString();
+
+			T_CSV csv2;
+
+			T_CSV::FromString(
+				csv,
+				string,
+				0,
+				TextLineEndings::CRLF
+			);
+
+			T_CSV::FromString(
+				csv2,
+				pool,
+				string,
+				0,
+				TextLineEndings::CRLF
+			);
+
+			if ((csv.GetLineCount() != LINE_COUNT) || (csv.Get<0>(1) != "N0CALL\n-1") || (csv2.ToString() != csv.ToString()))
+			{
+				pool.Stop();
+
+				throw Exception(
+					"CSV::FromString on a ThreadPool ignored lineEnding"
+				);
+			}
+		}
+
+		// unterminated quote in the last chunk
+		string.Append(
+			"\"N0CALL,1,2\n"
+		);
+
+		String messages[2];
+
+		for (AL::size_t i = 0; i < 2; ++i)
+		{
+			try
+			{
+				if (i == 0)
+					T_CSV::FromString(csv, string, 1);
+				else
+					T_CSV::FromString(csv, pool, string, 1);
+			}
+			catch (const Exception& exception)
+			{
+				messages[i] = exception.GetMessage();
+			}
+		}
+
+		pool.Stop();
+
+		if (messages[0].GetLength() == 0)
+		{
+
+			throw Exception(
+				"CSV::FromString accepted an unterminated quote"
+			);
+		}
+
+		// line numbers count from the start of the string rather than the chunk
+		if (messages[1] != messages[0])
+		{
+
+			throw Exception(
+				"CSV::FromString on a ThreadPool threw '%s' rather than '%s'",
+				messages[1].GetCString(),
+				messages[0].GetCString()
+			);
+		}
+	}
 }
@@ -1,19 +1,821 @@
 #pragma once
 #include <AL/Common.hpp>
 
+#include <AL/OS/Timer.hpp>
 #include <AL/OS/Console.hpp>
 
+#include <AL/FileSystem/File.hpp>
+
 #include <AL/Serialization/JSON.hpp>
 
+// Records every event as text so documents can be compared
+class AL_Serialization_JSON_Handler
+	: public AL::Serialization::IJSONHandler
+{
+public:
+	AL::StringBuilder Events;
+	AL::size_t        EventCount = 0;
+	AL::size_t        StopAfter  = AL::Integer<AL::size_t>::Maximum;
+
+	virtual AL::Bool OnNull() override
+	{
+		Events << "null ";
+
+		return Next();
+	}
+	virtual AL::Bool OnBoolean(AL::Bool value) override
+	{
+		Events << (value ? "true " : "false ");
+
+		return Next();
+	}
+	virtual AL::Bool OnInteger(AL::int64 value) override
+	{
+		Events << 'i' << value << ' ';
+
+		return Next();
+	}
+	virtual AL::Bool OnDecimal(AL::Double value) override
+	{
+		Events << 'd' << AL::String::Format("%g", value) << ' ';
+
+		return Next();
+	}
+	virtual AL::Bool OnString(const AL::StringView& value) override
+	{
+		Events << '"' << value.ToString() << "\" ";
+
+		return Next();
+	}
+
+	virtual AL::Bool OnArrayBegin() override
+	{
+		Events << "[ ";
+
+		return Next();
+	}
+	virtual AL::Bool OnArrayEnd() override
+	{
+		Events << "] ";
+
+		return Next();
+	}
+
+	virtual AL::Bool OnObjectBegin() override
+	{
+		Events << "{ ";
+
+		return Next();
+	}
+	virtual AL::Bool OnObjectKey(const AL::StringView& name) override
+	{
+		Events << name.ToString() << ": ";
+
+		return Next();
+	}
+	virtual AL::Bool OnObjectEnd() override
+	{
+		Events << "} ";
+
+		return Next();
+	}
+
+private:
+	AL::Bool Next()
+	{
+		return ++EventCount < StopAfter;
+	}
+};
+
+// Counts events without virtual calls
+struct AL_Serialization_JSON_Counter
+{
+	AL::size_t Count = 0;
+
+	AL::Bool OnNull()                         { ++Count; return true; }
+	AL::Bool OnBoolean(AL::Bool)              { ++Count; return true; }
+	AL::Bool OnInteger(AL::int64)             { ++Count; return true; }
+	AL::Bool OnDecimal(AL::Double)            { ++Count; return true; }
+	AL::Bool OnString(const AL::StringView&)  { ++Count; return true; }
+	AL::Bool OnArrayBegin()                   { ++Count; return true; }
+	AL::Bool OnArrayEnd()                     { ++Count; return true; }
+	AL::Bool OnObjectBegin()                  { ++Count; return true; }
+	AL::Bool OnObjectKey(const AL::StringView&) { ++Count; return true; }
+	AL::Bool OnObjectEnd()                    { ++Count; return true; }
+};
+
+// @throw AL::Exception
+static AL::String AL_Serialization_JSON_GetEvents(const AL::String& string)
+{
+	AL_Serialization_JSON_Handler handler;
+
+	AL::Serialization::JSONParser::Parse(
+		handler,
+		string
+	);
+
+	return handler.Events.ToString();
+}
+
 // @throw AL::Exception
 static void AL_Serialization_JSON()
 {
 	using namespace AL;
 	using namespace AL::Serialization;
 
-	JSON json;
+	static constexpr const char CONFIG[] =
+		"{\r\n"
+		"\t\"name\": \"server\",\r\n"
+		"\t\"port\": 8080,\r\n"
+		"\t\"timeout\": 2.5,\r\n"
+		"\t\"verbose\": false,\r\n"
+		"\t\"proxy\": null,\r\n"
+		"\t\"hosts\": [\"a.example.com\", \"b.example.com\"],\r\n"
+		"\t\"limits\": { \"connections\": 1024, \"rate\": -1.5e3 }\r\n"
+		"}\r\n";
 
-#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+	{
+		JSON json;
+
+		JSON::FromString(
+			json,
+			CONFIG
+		);
+
+		JSONValue*  lpValue;
+		JSONArray*  lpArray;
+		JSONObject* lpObject;
+
+		if (json.GetSize() != 7)
+		{
+
+			throw Exception(
+				"JSON::FromString read %lu members",
+				json.GetSize()
+			);
+		}
+
+		if (!json.GetMemberByName(lpValue, "name") || !lpValue->IsString() || (lpValue->GetString() != "server") ||
+			!json.GetMemberByName(lpValue, "port") || !lpValue->IsInteger() || (lpValue->GetInteger() != 8080) ||
+			!json.GetMemberByName(lpValue, "timeout") || !lpValue->IsDecimal() || (lpValue->GetDecimal() != 2.5) ||
+			!json.GetMemberByName(lpValue, "verbose") || !lpValue->IsBoolean() || lpValue->GetBoolean() ||
+			!json.GetMemberByName(lpValue, "proxy") || !lpValue->IsNull() ||
+			!json.GetMemberByName(lpArray, "hosts") || (lpArray->GetSize() != 2) ||
+			!json.GetMemberByName(lpObject, "limits") || !lpObject->GetMemberByName(lpValue, "rate") || (lpValue->GetDecimal() != -1500.0))
+		{
+
+			throw Exception(
+				"JSON::FromString read the wrong values"
+			);
+		}
+
+		// parses its own output
+		JSON json2;
+
+		JSON::FromString(
+			json2,
+			json.ToString()
+		);
+
+		if (json2 != json)
+		{
+
+			throw Exception(
+				"JSON::FromString did not read JSON::ToString"
+			);
+		}
+
+		JSONArray array;
+
+		JSONArray::FromString(
+			array,
+			WString(L"[1, [2, [3]], {}]")
+		);
+
+		if ((array.GetSize() != 3) || !array.Get(lpArray, 1) || (lpArray->GetSize() != 2))
+		{
+
+			throw Exception(
+				"JSONArray::FromString read the wrong values"
+			);
+		}
+
+		JSONValue value;
+
+		JSONValue::FromString(
+			value,
+			" \"value\" "
+		);
+
+		if (!value.IsString() || (value.GetString() != "value"))
+		{
+
+			throw Exception(
+				"JSONValue::FromString read the wrong value"
+			);
+		}
+
+		if (JSONValue(static_cast<uint64>(Integer<int64>::Maximum)).GetInteger() != Integer<int64>::Maximum)
+		{
+
+			throw Exception(
+				"JSONValue did not keep the largest integer"
+			);
+		}
+
+		Bool isThrown = False;
+
+		try
+		{
+			JSONValue(
+				static_cast<uint64>(Integer<int64>::Maximum) + 1
+			);
+		}
+		catch (const Exception&)
+		{
+			isThrown = True;
+		}
+
+		if (!isThrown)
+		{
+
+			throw Exception(
+				"JSONValue accepted an integer larger than Integer<int64>::Maximum"
+			);
+		}
+	}
+
+	// members are found through the hash index of large objects and the DOM outlives the document it was parsed from
+	{
+		static constexpr uint32 MEMBER_COUNT = 100;
+
+		StringBuilder sb;
+
+		sb << '{';
+
+		for (uint32 i = 0; i < MEMBER_COUNT; ++i)
+		{
+			sb << "\"key" << i << "\": " << i << ", ";
+		}
+
+		sb << "\"key0\": -1, \"child\": { \"name\": \"child\" } }";
+
+		JSONObject  copy;
+		JSONObject  moved;
+		JSONValue*  lpValue;
+		JSONObject* lpObject;
+
+		{
+			JSON json;
+
+			JSON::FromString(
+				json,
+				sb.ToString()
+			);
+
+			for (uint32 i = 0; i < MEMBER_COUNT; ++i)
+			{
+				if (!json.GetMemberByName(lpValue, String::Format("key%lu", i)) || (lpValue->GetInteger() != i))
+				{
+
+					throw Exception(
+						"JSONObject::GetMemberByName did not find key%lu",
+						i
+					);
+				}
+			}
+
+			if (json.GetMemberByName(lpValue, "key100") || !json.GetMemberByName(lpValue, WString(L"key99")) || (lpValue->GetInteger() != 99))
+			{
+
+				throw Exception(
+					"JSONObject::GetMemberByName found the wrong member"
+				);
+			}
+
+			json.Add(
+				"key50",
+				JSONValue(String("fifty"))
+			);
+
+			json.Add(
+				"key100",
+				JSONValue(100)
+			);
+
+			json.Remove(
+				"key10"
+			);
+
+			if (!json.GetMemberByName(lpValue, "key50") || (lpValue->GetString() != "fifty") ||
+				!json.GetMemberByName(lpValue, "key100") || (lpValue->GetInteger() != 100) ||
+				json.GetMemberByName(lpValue, "key10") ||
+				!json.GetMemberByName(lpValue, "key11") || (lpValue->GetInteger() != 11) ||
+				(json.GetSize() != (MEMBER_COUNT + 2)))
+			{
+
+				throw Exception(
+					"JSONObject::Add or JSONObject::Remove did not update the members"
+				);
+			}
+
+			WString name;
+
+			if (!json.Get(name, lpValue, 0) || (name != L"key0"))
+			{
+
+				throw Exception(
+					"JSONObject::Get returned the wrong name"
+				);
+			}
+
+			if (!json.GetMemberByName(lpObject, "child"))
+			{
+
+				throw Exception(
+					"JSONObject::GetMemberByName did not find child"
+				);
+			}
+
+			copy  = *lpObject;
+			moved = Move(json);
+		}
+
+		if (!copy.GetMemberByName(lpValue, "name") || (lpValue->GetString() != "child") ||
+			!moved.GetMemberByName(lpValue, "key99") || (lpValue->GetInteger() != 99) ||
+			!moved.GetMemberByName(lpObject, "child") || (*lpObject != copy))
+		{
+
+			throw Exception(
+				"JSONObject did not outlive the JSON it was copied or moved from"
+			);
+		}
+	}
+
+	{
+		static constexpr const char* DOCUMENTS[][2] =
+		{
+			{ "[]",                                              "[ ] " },
+			{ "{}",                                              "{ } " },
+			{ "0",                                               "i0 " },
+			{ "-0.0",                                            "d-0 " },
+			{ "[true,false,null]",                               "[ true false null ] " },
+			{ "[9223372036854775807,-9223372036854775808]",      "[ i9223372036854775807 i-9223372036854775808 ] " },
+			{ "[9223372036854775808,1e2,1E-2,0.5]",              "[ d9.22337e+18 d100 d0.01 d0.5 ] " },
+			{ "{\"a\":{\"b\":[{}]},\"c\":\"\"}",                 "{ a: { b: [ { } ] } c: \"\" } " },
+			{ "\"\\\"\\\\\\/\\b\\f\\n\\r\\t\"",                  "\"\"\\/\b\f\n\r\t\" " },
+			{ "\"\\u0041\\u00e9\\u20ac\\ud83d\\ude00\"",         "\"A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\" " },
+			{ "\"{[,:]}\"",                                      "\"{[,:]}\" " },
+			{ "\"\xC3\xA9\xF4\x8F\xBF\xBF\"",                    "\"\xC3\xA9\xF4\x8F\xBF\xBF\" " },
+			{ "{\"a\":1,\"a\":2}",                               "{ a: i1 a: i2 } " }
+		};
+
+		for (auto& document : DOCUMENTS)
+		{
+			auto events = AL_Serialization_JSON_GetEvents(
+				document[0]
+			);
+
+			if (events != document[1])
+			{
+
+				throw Exception(
+					"JSONParser read '%s' as '%s'",
+					document[0],
+					events.GetCString()
+				);
+			}
+		}
+	}
+
+	// escaped quotes and backslashes on either side of a 64 byte block boundary
+	for (AL::size_t i = 0; i < 80; ++i)
+	{
+		String padding(
+			' ',
+			i
+		);
+
+		padding.Append(
+			"[\"\\\\\",\"\\\"\\\\\\\"\",\"x\\\\\"]"
+		);
+
+		auto events = AL_Serialization_JSON_GetEvents(
+			padding
+		);
+
+		if (events != "[ \"\\\" \"\"\\\"\" \"x\\\" ] ")
+		{
 
+			throw Exception(
+				"JSONParser read '%s' after %lu spaces",
+				events.GetCString(),
+				i
+			);
+		}
+	}
+
+	{
+		static constexpr const char* INVALID_DOCUMENTS[] =
+		{
+			"",
+			"   ",
+			"[",
+			"]",
+			"{\"a\"}",
+			"{\"a\":}",
+			"{\"a\":1,}",
+			"[1,]",
+			"[1 2]",
+			"{1:2}",
+			"\"unterminated",
+			"\"control\x01\"",
+			"\"\\x\"",
+			"\"\\u12\"",
+			"\"\\ud83d\"",
+			"\"\\udc00\"",
+			"\"\\udc00\\ud83d\"",
+			"\"\xC0\xAF\"",
+			"\"\xED\xA0\x80\"",
+			"\"\xF4\x90\x80\x80\"",
+			"\"\xE2\x82\"",
+			"\"\xFF\"",
+			"[\"\x80\"]",
+			"01",
+			"1.",
+			"-",
+			"1e",
+			"+1",
+			".5",
+			"tru",
+			"truex",
+			"nul",
+			"[1]]",
+			"{} {}",
+			"1e400"
+		};
+
+		for (auto lpDocument : INVALID_DOCUMENTS)
+		{
+			Bool isThrown = False;
+
+			try
+			{
+				AL_Serialization_JSON_GetEvents(
+					lpDocument
+				);
+			}
+			catch (const Exception&)
+			{
+				isThrown = True;
+			}
+
+			if (!isThrown)
+			{
+
+				throw Exception(
+					"JSONParser accepted '%s'",
+					lpDocument
+				);
+			}
+		}
+
+		String nesting(
+			'[',
+			2000
+		);
+
+		nesting.Append(
+			String(']', 2000)
+		);
+
+		Bool isThrown = False;
+
+		try
+		{
+			AL_Serialization_JSON_GetEvents(
+				nesting
+			);
+		}
+		catch (const Exception&)
+		{
+			isThrown = True;
+		}
+
+		if (!isThrown)
+		{
+
+			throw Exception(
+				"JSONParser accepted 2000 levels of nesting"
+			);
+		}
+	}
+
+	{
+		AL_Serialization_JSON_Handler handler;
+		handler.StopAfter = 3;
+
+		if (JSONParser::Parse(handler, String(CONFIG)) || (handler.EventCount != 3))
+		{
+
+			throw Exception(
+				"JSONParser did not stop when the handler returned false"
+			);
+		}
+	}
+
+	{
+		String buffer(
+			"{\"key\":\"a\\tb\",\"plain\":\"c\"}"
+		);
+
+		struct Handler
+			: public AL_Serialization_JSON_Counter
+		{
+			const char* lpBegin;
+			const char* lpEnd;
+			Bool        IsInSitu = True;
+
+			Bool OnString(const StringView& value)
+			{
+				if ((value.GetBuffer() < lpBegin) || (value.GetBuffer() >= lpEnd))
+				{
+
+					IsInSitu = False;
+				}
+
+				return AL_Serialization_JSON_Counter::OnString(value);
+			}
+		} handler;
+
+		handler.lpBegin = buffer.GetCString();
+		handler.lpEnd   = buffer.GetCString() + buffer.GetLength();
+
+		JSONParser::ParseInSitu(
+			handler,
+			&buffer[0],
+			buffer.GetLength()
+		);
+
+		if (!handler.IsInSitu || (handler.Count != 6) || !StringView(&buffer[8], 3).Compare("a\tb"))
+		{
+
+			throw Exception(
+				"JSONParser::ParseInSitu did not decode in place"
+			);
+		}
+	}
+
+	{
+		StringBuilder             sb;
+		JSONWriter<StringBuilder> writer(sb);
+
+		writer.BeginObject();
+		writer.WriteKey("null");
+		writer.WriteNull();
+		writer.WriteKey("values");
+		writer.BeginArray();
+		writer.WriteBoolean(True);
+		writer.WriteInteger(-9223372036854775807 - 1);
+		writer.WriteDecimal(2.0);
+		writer.WriteDecimal(0.1);
+		writer.WriteDecimal(1.0 / 0.0);
+		writer.BeginObject();
+		writer.EndObject();
+		writer.WriteString("\"\\/\b\f\n\r\t\x01\x1F\xC3\xA9");
+		writer.EndArray();
+		writer.EndObject();
+		writer.Flush();
+
+		static constexpr const char EXPECTED[] = "{\"null\":null,\"values\":[true,-9223372036854775808,2.0,0.1,null,{},\"\\\"\\\\/\\b\\f\\n\\r\\t\\u0001\\u001f\xC3\xA9\"]}";
+
+		if (sb.ToString() != EXPECTED)
+		{
+
+			throw Exception(
+				"JSONWriter wrote '%s'",
+				sb.ToString().GetCString()
+			);
+		}
+
+		// reads back to the same DOM
+		JSON json;
+		JSON json2;
+
+		JSON::FromString(
+			json,
+			CONFIG
+		);
+
+		JSON::FromString(
+			json2,
+			json.ToString()
+		);
+
+		if ((json2 != json) || (json2.ToString() != json.ToString()) || (json.ToWString() != json.ToString().ToWString()))
+		{
+
+			throw Exception(
+				"JSON::ToString did not read back"
+			);
+		}
+
+		// strings longer than the buffer are written through
+		String string(
+			'x',
+			0x10000
+		);
+
+		string[0x8000] = '\n';
+
+		FileSystem::File file(
+			"./json.tmp"
+		);
+
+		file.Open(
+			FileSystem::FileOpenModes::Write | FileSystem::FileOpenModes::Truncate
+		);
+
+		{
+			JSONWriter<FileSystem::File> writer(file);
+
+			writer.BeginArray();
+			writer.WriteString(string);
+			writer.Write(json);
+			writer.EndArray();
+			writer.Flush();
+		}
+
+		file.Close();
+
+		file.Open(
+			FileSystem::FileOpenModes::Read
+		);
+
+		String buffer(
+			'\0',
+			static_cast<AL::size_t>(file.GetSize())
+		);
+
+		file.Read(
+			&buffer[0],
+			buffer.GetLength()
+		);
+
+		file.Close();
+		file.Delete();
+
+		JSONArray array;
+
+		JSONArray::FromString(
+			array,
+			buffer
+		);
+
+		JSONValue*  lpValue;
+		JSONObject* lpObject;
+
+		if ((array.GetSize() != 2) || !array.Get(lpValue, 0) || (lpValue->GetString() != string) || !array.Get(lpObject, 1) || (*lpObject != json))
+		{
+
+			throw Exception(
+				"JSONWriter<File> did not read back"
+			);
+		}
+
+		// an output that stops accepting bytes fails instead of spinning
+		struct Output
+		{
+			AL::size_t Capacity;
+
+			AL::size_t Write(const Void*, AL::size_t size)
+			{
+				size = (size < Capacity) ? size : Capacity;
+
+				Capacity -= size;
+
+				return size;
+			}
+		};
+
+		Output output = { 0x100 };
+		Bool   isThrown = False;
+
+		try
+		{
+			JSONWriter<Output> writer(output);
+
+			writer.WriteString(string);
+			writer.Flush();
+		}
+		catch (const Exception&)
+		{
+			isThrown = True;
+		}
+
+		if (!isThrown || (output.Capacity != 0))
+		{
+
+			throw Exception(
+				"JSONWriter did not fail on a full output"
+			);
+		}
+	}
+
+	{
+		static constexpr uint32 COUNT = 200;
+
+		StringBuilder api;
+
+		api << '[';
+
+		for (uint32 i = 0; i < 100; ++i)
+		{
+			api << (i ? "," : "") << "{\"id\":" << i << ",\"login\":\"user" << i << "\",\"score\":" << (i * 0.25)
+				<< ",\"admin\":" << ((i % 10) == 0) << ",\"tags\":[\"a\",\"b\\n\"],\"bio\":\"Lorem ipsum dolor sit amet, consectetur adipiscing elit\"}";
+		}
+
+		api << ']';
+
+		String payloads[] =
+		{
+			CONFIG,
+			api.ToString()
+		};
+
+		for (auto& payload : payloads)
+		{
+			OS::Timer timer;
+
+			for (uint32 i = 0; i < COUNT; ++i)
+			{
+				JSONArray array;
+				JSON      json;
+
+				if (payload.StartsWith('['))
+					JSONArray::FromString(array, payload);
+				else
+					JSON::FromString(json, payload);
+			}
+
+			auto elapsed = timer.GetElapsed();
+
+			AL_Serialization_JSON_Counter counter;
+
+			timer.Reset();
+
+			for (uint32 i = 0; i < COUNT; ++i)
+			{
+				JSONParser::Parse(
+					counter,
+					payload
+				);
+			}
+
+			auto elapsed_SAX = timer.GetElapsed();
+
+			String buffer;
+
+			timer.Reset();
+
+			for (uint32 i = 0; i < COUNT; ++i)
+			{
+				buffer = payload;
+
+				JSONParser::ParseInSitu(
+					counter,
+					&buffer[0],
+					buffer.GetLength()
+				);
+			}
+
+			auto elapsed_InSitu = timer.GetElapsed();
+
+			JSONArray array;
+
+			JSONArray::FromString(
+				array,
+				String::Format("[%s]", payload.GetCString())
+			);
+
+			timer.Reset();
+
+			for (uint32 i = 0; i < COUNT; ++i)
+			{
+				array.ToString();
+			}
+
+#if defined(AL_TEST_SHOW_CONSOLE_OUTPUT)
+			OS::Console::WriteLine(
+				"%lu bytes x %lu: DOM in %lluus, SAX in %lluus, SAX in situ in %lluus, ToString in %lluus",
+				payload.GetLength(),
+				COUNT,
+				elapsed.ToMicroseconds(),
+				elapsed_SAX.ToMicroseconds(),
+				elapsed_InSitu.ToMicroseconds(),
+				timer.GetElapsed().ToMicroseconds()
+			);
 #endif
+		}
+	}
 }
@@ -6,17 +6,28 @@
 #include <AL/OS/Thread.hpp>
 #include <AL/OS/Process.hpp>
 
+#include "APRS/Client.hpp"
+
+#include "Collections/Arena.hpp"
 #include "Collections/Array.hpp"
 #include "Collections/ArrayList.hpp"
 #include "Collections/Dictionary.hpp"
+#include "Collections/HashDictionary.hpp"
 #include "Collections/LinkedList.hpp"
+#include "Collections/MPMCQueue.hpp"
 #include "Collections/MPSCQueue.hpp"
+#include "Collections/WorkStealingDeque.hpp"
 #include "Collections/Queue.hpp"
 #include "Collections/CircularQueue.hpp"
+#include "Collections/RingBuffer.hpp"
 #include "Collections/String.hpp"
 #include "Collections/StringBuilder.hpp"
+#include "Collections/UnorderedSet.hpp"
 
+#include "Common/Future.hpp"
 #include "Common/Function.hpp"
+#include "Common/Format.hpp"
+#include "Common/Regex.hpp"
 
 #include "FileSystem/File.hpp"
 #include "FileSystem/WaveFile.hpp"
@@ -27,6 +38,11 @@
 #include "Game/FileSystem/ConfigFile.hpp"
 
 #include "Game/Network/ClientServer.hpp"
+#include "Game/Network/ServerLoad.hpp"
+#include "Game/Network/ServerShard.hpp"
+#include "Game/Network/ServerSend.hpp"
+#include "Game/Network/ServerUpdate.hpp"
+#include "Game/Network/SessionReceive.hpp"
 
 #if defined(AL_PLATFORM_LINUX)
 	#include "Hardware/Drivers/AT24C256.hpp"
@@ -36,18 +52,22 @@
 
 #include "Network/Adapter.hpp"
 #include "Network/UdpSocket.hpp"
+#include "Network/SocketPoller.hpp"
 
 #include "Network/HTTP/Request.hpp"
 
+#include "OS/Parallel.hpp"
 #include "OS/Process.hpp"
 #include "OS/Thread.hpp"
 #include "OS/ThreadPool.hpp"
 #include "OS/Window.hpp"
 
+#include "Serialization/APRS/Packet.hpp"
 #include "Serialization/CSV.hpp"
 #include "Serialization/HTML.hpp"
 #include "Serialization/JSON.hpp"
 #include "Serialization/NMEA.hpp"
+#include "Serialization/Uri.hpp"
 
 #include "SQLite3/Database.hpp"
 
@@ -270,17 +290,28 @@ void main_execute_tests(AL::uint32& testCount, AL::uint32& testFailCount)
 		AL::OS::Console::WriteLine();
 	};
 
+	main_execute_test(AL_APRS_Client);
+
+	main_execute_test(AL_Collections_Arena);
 	main_execute_test(AL_Collections_Array);
 	main_execute_test(AL_Collections_ArrayList);
 	main_execute_test(AL_Collections_Dictionary);
+	main_execute_test(AL_Collections_HashDictionary);
 	main_execute_test(AL_Collections_LinkedList);
+	main_execute_test(AL_Collections_MPMCQueue);
 	main_execute_test(AL_Collections_MPSCQueue);
+	main_execute_test(AL_Collections_WorkStealingDeque);
 	main_execute_test(AL_Collections_Queue);
 	main_execute_test(AL_Collections_CircularQueue);
+	main_execute_test(AL_Collections_RingBuffer);
 	main_execute_test(AL_Collections_String);
 	main_execute_test(AL_Collections_StringBuilder);
+	main_execute_test(AL_Collections_UnorderedSet);
 
+	main_execute_test(AL_Future);
 	main_execute_test(AL_Function);
+	main_execute_test(AL_Format);
+	main_execute_test(AL_Regex);
 
 	main_execute_test(AL_FileSystem_File);
 	main_execute_test(AL_FileSystem_WaveFile);
@@ -291,6 +322,11 @@ void main_execute_tests(AL::uint32& testCount, AL::uint32& testFailCount)
 	main_execute_test(AL_Game_FileSystem_ConfigFile);
 
 	main_execute_test(AL_Game_Network_ClientServer);
+	main_execute_test(AL_Game_Network_ServerLoad);
+	main_execute_test(AL_Game_Network_ServerShard);
+	main_execute_test(AL_Game_Network_ServerSend);
+	main_execute_test(AL_Game_Network_ServerUpdate);
+	main_execute_test(AL_Game_Network_SessionReceive);
 
 #if defined(AL_PLATFORM_LINUX)
 	main_execute_test(AL_Hardware_Drivers_AT24C256);
@@ -300,18 +336,22 @@ void main_execute_tests(AL::uint32& testCount, AL::uint32& testFailCount)
 
 	main_execute_test(AL_Network_Adapter);
 	main_execute_test(AL_Network_UdpSocket);
+	main_execute_test(AL_Network_SocketPoller);
 
 	main_execute_test(AL_Network_HTTP_Request);
 
+	main_execute_test(AL_OS_Parallel);
 	main_execute_test(AL_OS_Process);
 	main_execute_test(AL_OS_Thread);
 	main_execute_test(AL_OS_ThreadPool);
 	main_execute_test(AL_OS_Window);
 
+	main_execute_test(AL_Serialization_APRS_Packet);
 	main_execute_test(AL_Serialization_CSV);
 	main_execute_test(AL_Serialization_HTML);
 	main_execute_test(AL_Serialization_JSON);
 	main_execute_test(AL_Serialization_NMEA);
+	main_execute_test(AL_Serialization_Uri);
 
 	main_execute_test(AL_SQLite3_Database);
 }